@@ -34,6 +34,9 @@
 #define SHADERIDE_STATUSBAR_TIMEOUT 10000 // 10 Seconds
 #define SHADERIDE_SURFACEFORMAT_NUM_SAMPLES 8
 #define SHADERIDE_CODE_EDITOR_TAB_WIDTH 4
+#define SHADERIDE_CODE_EDITOR_COMPILE_DELAY 300 // Milliseconds
+#define SHADERIDE_CODE_EDITOR_SEPARABLE_STAGES false
+#define SHADERIDE_TEXTURE_MEMORY_PER_SLOT 256 // Megabytes, larger images are streamed
 #define SHADERIDE_LOGO_PATH ":/app/logo-light.png"
 #define SHADERIDE_LICENSE_URL "https://github.com/thedamncoder/shaderide/blob/master/LICENSE"
 #define SHADERIDE_GITHUB_URL "https://github.com/thedamncoder/shaderide"
@@ -39,17 +39,20 @@ namespace ShaderIDE {
     public:
         explicit GeneralException(const QString& message)
                 : std::exception(),
-                  message(message)
+                  message(message),
+                  utf8Message(message.toStdString())
         {}
 
         [[nodiscard]]
         const char* what() const noexcept override
         {
-            return message.toStdString().c_str();
+            // The buffer has to outlive the call.
+            return utf8Message.c_str();
         }
 
     private:
         QString message;
+        std::string utf8Message;
     };
 }
 
@@ -0,0 +1,84 @@
+/**
+ * Hash Class
+ *
+ * Incremental 64 bit FNV-1a hash, i.e. for change detection and cache keys.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_CORE_HASH_HPP
+#define SHADERIDE_CORE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <QString>
+
+namespace ShaderIDE {
+
+    class Hash
+    {
+        static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    public:
+        Hash& Add(const void* data, const size_t& size)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                value ^= bytes[i];
+                value *= FNV_PRIME;
+            }
+
+            return *this;
+        }
+
+        Hash& Add(const QString& string)
+        {
+            return Add(string.constData(), string.size() * sizeof(QChar));
+        }
+
+        template<typename T>
+        Hash& Add(const T& data)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "Only trivially copyable types can be hashed bytewise.");
+
+            return Add(&data, sizeof(T));
+        }
+
+        uint64_t Value() const
+        {
+            return value;
+        }
+
+    private:
+        uint64_t value{ FNV_OFFSET_BASIS };
+    };
+}
+
+#endif // SHADERIDE_CORE_HASH_HPP
@@ -49,6 +49,31 @@ namespace ShaderIDE {
             
             return value;
         }
+
+        /**
+         * Halton Sequence
+         *
+         * Low discrepancy sequence in [0, 1), i.e. for sub-pixel
+         * jitter offsets. The index should start at 1.
+         *
+         * @param int index
+         * @param int base
+         * @return float
+         */
+        static float halton(int index, const int& base)
+        {
+            float result = 0.0f;
+            float fraction = 1.0f;
+
+            while (index > 0)
+            {
+                fraction /= static_cast<float>(base);
+                result += fraction * static_cast<float>(index % base);
+                index /= base;
+            }
+
+            return result;
+        }
     };
 }
 
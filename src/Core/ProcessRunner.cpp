@@ -0,0 +1,221 @@
+/**
+ * ProcessRunner Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ProcessRunner.hpp"
+#include "Memory.hpp"
+
+using namespace ShaderIDE;
+
+bool ProcessResult::Succeeded() const
+{
+    return started && !timedOut && exitCode == 0;
+}
+
+ProcessRunner::ProcessRunner(int maxConcurrent, QObject* parent)
+        : QObject(parent),
+          maxConcurrent(qMax(1, maxConcurrent))
+{}
+
+ProcessRunner::~ProcessRunner()
+{
+    CancelAll();
+}
+
+uint64_t ProcessRunner::Run(const QString& program,
+                            const QStringList& arguments,
+                            int timeout,
+                            const QString& workingDirectory)
+{
+    auto* job = new Job();
+    job->id = nextID++;
+    job->program = program;
+    job->arguments = arguments;
+    job->timeout = timeout;
+    job->workingDirectory = workingDirectory;
+    job->result.program = program;
+    job->result.arguments = arguments;
+
+    queuedJobs.push_back(job);
+    StartQueuedJobs();
+
+    return job->id;
+}
+
+void ProcessRunner::CancelAll()
+{
+    for (auto* job : queuedJobs) {
+        Memory::Release(job);
+    }
+
+    queuedJobs.clear();
+
+    // Killed without notifications, the receivers may already be gone.
+    for (auto* job : runningJobs)
+    {
+        job->process->disconnect(this);
+        job->process->kill();
+        job->process->waitForFinished();
+
+        Memory::Release(job->timeoutTimer);
+        Memory::Release(job->process);
+        Memory::Release(job);
+    }
+
+    runningJobs.clear();
+}
+
+int ProcessRunner::Running() const
+{
+    return runningJobs.size();
+}
+
+int ProcessRunner::Queued() const
+{
+    return static_cast<int>(queuedJobs.size());
+}
+
+bool ProcessRunner::Idle() const
+{
+    return runningJobs.isEmpty() && queuedJobs.empty();
+}
+
+void ProcessRunner::StartQueuedJobs()
+{
+    while (!queuedJobs.empty() && runningJobs.size() < maxConcurrent)
+    {
+        auto* job = queuedJobs.front();
+        queuedJobs.pop_front();
+        Start(job);
+    }
+}
+
+void ProcessRunner::Start(Job* job)
+{
+    runningJobs.insert(job->id, job);
+
+    job->process = new QProcess();
+    job->process->setProgram(job->program);
+    job->process->setArguments(job->arguments);
+
+    if (!job->workingDirectory.isEmpty()) {
+        job->process->setWorkingDirectory(job->workingDirectory);
+    }
+
+    // Output is read while the process is running, so
+    // it never blocks on full stdout or stderr pipes.
+    connect(job->process, &QProcess::started, this, [job]() {
+        job->result.started = true;
+    });
+
+    connect(job->process, &QProcess::readyReadStandardOutput, this, [this, job]() {
+        ReadLines(job, QProcess::StandardOutput);
+    });
+
+    connect(job->process, &QProcess::readyReadStandardError, this, [this, job]() {
+        ReadLines(job, QProcess::StandardError);
+    });
+
+    connect(job->process, &QProcess::finished, this, [this, job](int exitCode, QProcess::ExitStatus exitStatus) {
+        job->result.exitCode = exitStatus == QProcess::NormalExit ? exitCode : -1;
+        Finish(job);
+    });
+
+    connect(job->process, &QProcess::errorOccurred, this, [this, job](QProcess::ProcessError error) {
+        // Crashes and kills are followed by finished().
+        if (error == QProcess::FailedToStart)
+        {
+            job->result.standardError += job->process->errorString();
+            Finish(job);
+        }
+    });
+
+    if (job->timeout > 0)
+    {
+        job->timeoutTimer = new QTimer();
+        job->timeoutTimer->setSingleShot(true);
+
+        connect(job->timeoutTimer, &QTimer::timeout, this, [job]() {
+            job->result.timedOut = true;
+            job->process->kill();
+        });
+
+        job->timeoutTimer->start(job->timeout);
+    }
+
+    job->durationTimer.start();
+    job->process->start();
+}
+
+void ProcessRunner::Finish(Job* job)
+{
+    if (!runningJobs.contains(job->id)) {
+        return;
+    }
+
+    runningJobs.remove(job->id);
+
+    // Remaining partial lines
+    ReadLines(job, QProcess::StandardOutput);
+    ReadLines(job, QProcess::StandardError);
+
+    job->result.duration = job->durationTimer.elapsed();
+    const auto result = job->result;
+    const auto id = job->id;
+
+    // Deleted later, Finish() is called from signals of the process.
+    job->process->disconnect(this);
+    job->process->deleteLater();
+    Memory::Release(job->timeoutTimer);
+    Memory::Release(job);
+
+    emit NotifyFinished(id, result);
+    StartQueuedJobs();
+}
+
+void ProcessRunner::ReadLines(Job* job, QProcess::ProcessChannel channel)
+{
+    const auto finished = !runningJobs.contains(job->id);
+    job->process->setReadChannel(channel);
+
+    while (job->process->canReadLine() || (finished && job->process->bytesAvailable() > 0))
+    {
+        const auto line = QString::fromLocal8Bit(
+                job->process->canReadLine() ? job->process->readLine() : job->process->readAll()
+        ).trimmed();
+
+        if (channel == QProcess::StandardOutput)
+        {
+            job->result.standardOutput += line + "\n";
+            emit NotifyOutput(job->id, line);
+
+        } else {
+            job->result.standardError += line + "\n";
+            emit NotifyErrorOutput(job->id, line);
+        }
+    }
+}
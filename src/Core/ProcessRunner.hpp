@@ -0,0 +1,118 @@
+/**
+ * ProcessRunner Class
+ *
+ * Runs external tools (i.e. export hooks) asynchronously with QProcess.
+ * Output is streamed line by line, processes exceeding their timeout are
+ * killed and at most maxConcurrent processes run at the same time.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_CORE_PROCESSRUNNER_HPP
+#define SHADERIDE_CORE_PROCESSRUNNER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <QObject>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QProcess>
+#include <QTimer>
+#include <QElapsedTimer>
+
+namespace ShaderIDE {
+
+    struct ProcessResult
+    {
+        QString program{ "" };
+        QStringList arguments;
+        bool started{ false };
+        bool timedOut{ false };
+        int exitCode{ -1 };
+        QString standardOutput{ "" };
+        QString standardError{ "" };
+        qint64 duration{ 0 }; // Milliseconds
+
+        bool Succeeded() const;
+    };
+
+    class ProcessRunner : public QObject
+    {
+        Q_OBJECT
+
+        struct Job
+        {
+            uint64_t id{ 0 };
+            QString program{ "" };
+            QStringList arguments;
+            QString workingDirectory{ "" };
+            int timeout{ 0 };
+
+            QProcess* process{ nullptr };
+            QTimer* timeoutTimer{ nullptr };
+            QElapsedTimer durationTimer;
+            ProcessResult result;
+        };
+
+    public:
+        static constexpr int DEFAULT_TIMEOUT = 30000; // Milliseconds
+
+        explicit ProcessRunner(int maxConcurrent = 4, QObject* parent = nullptr);
+        ~ProcessRunner() override;
+
+        uint64_t Run(const QString& program,
+                     const QStringList& arguments,
+                     int timeout = DEFAULT_TIMEOUT,
+                     const QString& workingDirectory = "");
+
+        void CancelAll();
+
+        int Running() const;
+        int Queued() const;
+        bool Idle() const;
+
+    signals:
+        void NotifyOutput(uint64_t id, const QString& line);
+        void NotifyErrorOutput(uint64_t id, const QString& line);
+        void NotifyFinished(uint64_t id, const ShaderIDE::ProcessResult& result);
+
+    private:
+        int maxConcurrent{ 4 };
+        uint64_t nextID{ 1 };
+
+        std::deque<Job*> queuedJobs;
+        QMap<uint64_t, Job*> runningJobs;
+
+        void StartQueuedJobs();
+        void Start(Job* job);
+        void Finish(Job* job);
+        void ReadLines(Job* job, QProcess::ProcessChannel channel);
+    };
+}
+
+Q_DECLARE_METATYPE(ShaderIDE::ProcessResult)
+
+#endif // SHADERIDE_CORE_PROCESSRUNNER_HPP
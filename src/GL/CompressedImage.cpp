@@ -0,0 +1,568 @@
+/**
+ * CompressedImage Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include <algorithm>
+#include <QtEndian>
+#include <QFileInfo>
+#include <QThread>
+#include <QThreadPool>
+#include "CompressedImage.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    // GL_EXT_texture_compression_s3tc, RGTC and BPTC are core formats.
+    constexpr GLenum COMPRESSED_RGBA_S3TC_DXT1 = 0x83F1;
+    constexpr GLenum COMPRESSED_RGBA_S3TC_DXT5 = 0x83F3;
+    constexpr GLenum COMPRESSED_RG_RGTC2 = 0x8DBD;
+    constexpr GLenum COMPRESSED_RGBA_BPTC_UNORM = 0x8E8C;
+
+    constexpr std::array<uchar, 12> KTX2_IDENTIFIER = {
+            0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'
+    };
+
+    constexpr qint64 KTX2_HEADER_SIZE = 80;
+    constexpr qint64 KTX2_LEVEL_INDEX_SIZE = 24;
+    constexpr qint64 DDS_HEADER_SIZE = 128;
+    constexpr qint64 DDS_DX10_HEADER_SIZE = 20;
+    constexpr quint32 DDS_CUBEMAP = 0x200;
+
+    constexpr quint32 FourCC(const char* code)
+    {
+        return static_cast<quint32>(code[0])
+               | static_cast<quint32>(code[1]) << 8
+               | static_cast<quint32>(code[2]) << 16
+               | static_cast<quint32>(code[3]) << 24;
+    }
+
+    quint32 ReadUInt32(const QByteArray& data, qint64 offset)
+    {
+        return qFromLittleEndian<quint32>(data.constData() + offset);
+    }
+
+    quint64 ReadUInt64(const QByteArray& data, qint64 offset)
+    {
+        return qFromLittleEndian<quint64>(data.constData() + offset);
+    }
+
+    void RequireBytes(const QByteArray& data, qint64 bytes)
+    {
+        if (data.size() < bytes) {
+            throw GeneralException("The compressed texture data is truncated.");
+        }
+    }
+
+    CompressedImage::FORMAT DXGIFormat(const QByteArray& data)
+    {
+        RequireBytes(data, DDS_HEADER_SIZE + DDS_DX10_HEADER_SIZE);
+        const auto dxgiFormat = ReadUInt32(data, DDS_HEADER_SIZE);
+        const auto arraySize = ReadUInt32(data, DDS_HEADER_SIZE + 12);
+
+        if (arraySize > 1) {
+            throw GeneralException("DDS texture arrays are not supported.");
+        }
+
+        switch (dxgiFormat)
+        {
+            case 70: // DXGI_FORMAT_BC1_TYPELESS
+            case 71:
+            case 72:
+                return CompressedImage::FORMAT::BC1;
+
+            case 76: // DXGI_FORMAT_BC3_TYPELESS
+            case 77:
+            case 78:
+                return CompressedImage::FORMAT::BC3;
+
+            case 82: // DXGI_FORMAT_BC5_TYPELESS
+            case 83:
+                return CompressedImage::FORMAT::BC5;
+
+            case 97: // DXGI_FORMAT_BC7_TYPELESS
+            case 98:
+            case 99:
+                return CompressedImage::FORMAT::BC7;
+
+            default:
+                throw GeneralException(QString("DXGI format %1 is not supported, BC1, BC3, BC5 and BC7 are.").arg(dxgiFormat));
+        }
+    }
+
+    uchar Expand5(uint32_t value)
+    {
+        return static_cast<uchar>((value << 3) | (value >> 2));
+    }
+
+    uchar Expand6(uint32_t value)
+    {
+        return static_cast<uchar>((value << 2) | (value >> 4));
+    }
+}
+
+CompressedImage CompressedImage::FromData(const QByteArray& data)
+{
+    if (data.startsWith(QByteArray(reinterpret_cast<const char*>(KTX2_IDENTIFIER.data()), KTX2_IDENTIFIER.size()))) {
+        return FromKTX2(data);
+    }
+
+    if (data.startsWith("DDS ")) {
+        return FromDDS(data);
+    }
+
+    throw GeneralException("Unknown compressed texture format, KTX2 and DDS files are supported.");
+}
+
+bool CompressedImage::IsCompressed(const QByteArray& data)
+{
+    return data.startsWith(QByteArray(reinterpret_cast<const char*>(KTX2_IDENTIFIER.data()), KTX2_IDENTIFIER.size()))
+           || data.startsWith("DDS ");
+}
+
+bool CompressedImage::IsCompressedFile(const QString& path)
+{
+    const auto suffix = QFileInfo(path).suffix().toLower();
+    return suffix == "ktx2" || suffix == "dds";
+}
+
+bool CompressedImage::IsNull() const
+{
+    return levels.isEmpty();
+}
+
+CompressedImage::FORMAT CompressedImage::Format() const
+{
+    return format;
+}
+
+QSize CompressedImage::Size() const
+{
+    return size;
+}
+
+const QList<CompressedLevel>& CompressedImage::Levels() const
+{
+    return levels;
+}
+
+qint64 CompressedImage::Bytes() const
+{
+    qint64 bytes = 0;
+
+    for (const auto& level : levels) {
+        bytes += level.data.size();
+    }
+
+    return bytes;
+}
+
+GLenum CompressedImage::InternalFormat() const
+{
+    switch (format)
+    {
+        case FORMAT::BC1:
+            return COMPRESSED_RGBA_S3TC_DXT1;
+
+        case FORMAT::BC3:
+            return COMPRESSED_RGBA_S3TC_DXT5;
+
+        case FORMAT::BC5:
+            return COMPRESSED_RG_RGTC2;
+
+        case FORMAT::BC7:
+            return COMPRESSED_RGBA_BPTC_UNORM;
+    }
+
+    return 0;
+}
+
+QString CompressedImage::Description() const
+{
+    return QString("%1 %2 x %3, %4 levels")
+            .arg(FormatName(format))
+            .arg(size.width())
+            .arg(size.height())
+            .arg(levels.size());
+}
+
+bool CompressedImage::Decodable() const
+{
+    return !IsNull() && format != FORMAT::BC7;
+}
+
+QImage CompressedImage::Decode(int level) const
+{
+    if (!Decodable() || level < 0 || level >= levels.size()) {
+        return {};
+    }
+
+    const auto& source = levels.at(level);
+    const auto blockBytes = BlockBytes(format);
+    const auto blocksX = (source.size.width() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const auto blocksY = (source.size.height() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    QImage image(source.size, QImage::Format_RGBA8888);
+
+    if (image.isNull()) {
+        return {};
+    }
+
+    // Each worker decodes a band of block rows into its own image rows.
+    auto* bits = image.bits();
+    const auto stride = image.bytesPerLine();
+    const auto* blocks = reinterpret_cast<const uchar*>(source.data.constData());
+    const auto bands = std::min(blocksY, std::max(1, QThread::idealThreadCount()));
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(bands);
+
+    for (int band = 0; band < bands; band++)
+    {
+        const auto firstRow = blocksY * band / bands;
+        const auto lastRow = blocksY * (band + 1) / bands;
+
+        threadPool.start([=]() {
+            std::array<uchar, BLOCK_SIZE * BLOCK_SIZE * 4> pixels{};
+
+            for (int by = firstRow; by < lastRow; by++)
+            {
+                for (int bx = 0; bx < blocksX; bx++)
+                {
+                    const auto* block = blocks + (static_cast<qint64>(by) * blocksX + bx) * blockBytes;
+
+                    switch (format)
+                    {
+                        case FORMAT::BC1:
+                            DecodeColorBlock(block, false, pixels.data());
+                            break;
+
+                        case FORMAT::BC3:
+                            DecodeColorBlock(block + 8, true, pixels.data());
+                            DecodeChannelBlock(block, 3, pixels.data());
+                            break;
+
+                        case FORMAT::BC5:
+                            pixels.fill(0);
+                            DecodeChannelBlock(block, 0, pixels.data());
+                            DecodeChannelBlock(block + 8, 1, pixels.data());
+
+                            for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; i++) {
+                                pixels.at(i * 4 + 3) = 255;
+                            }
+                            break;
+
+                        case FORMAT::BC7:
+                            break;
+                    }
+
+                    // Blocks at the right and bottom edge may be partial.
+                    const auto width = std::min(BLOCK_SIZE, source.size.width() - bx * BLOCK_SIZE);
+                    const auto height = std::min(BLOCK_SIZE, source.size.height() - by * BLOCK_SIZE);
+
+                    for (int y = 0; y < height; y++)
+                    {
+                        auto* row = bits + (by * BLOCK_SIZE + y) * stride + bx * BLOCK_SIZE * 4;
+                        std::copy_n(pixels.data() + y * BLOCK_SIZE * 4, width * 4, row);
+                    }
+                }
+            }
+        });
+    }
+
+    threadPool.waitForDone();
+    return image;
+}
+
+int CompressedImage::LevelForExtent(int extent) const
+{
+    auto result = 0;
+
+    for (int i = 0; i < levels.size(); i++)
+    {
+        const auto& levelSize = levels.at(i).size;
+
+        if (std::max(levelSize.width(), levelSize.height()) >= extent) {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+int CompressedImage::BlockBytes(const FORMAT& format)
+{
+    return format == FORMAT::BC1 ? 8 : 16;
+}
+
+qint64 CompressedImage::LevelBytes(const FORMAT& format, const QSize& size)
+{
+    const qint64 blocksX = (size.width() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const qint64 blocksY = (size.height() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    return blocksX * blocksY * BlockBytes(format);
+}
+
+QString CompressedImage::FormatName(const FORMAT& format)
+{
+    switch (format)
+    {
+        case FORMAT::BC1:
+            return "BC1";
+
+        case FORMAT::BC3:
+            return "BC3";
+
+        case FORMAT::BC5:
+            return "BC5";
+
+        case FORMAT::BC7:
+            return "BC7";
+    }
+
+    return "";
+}
+
+CompressedImage CompressedImage::FromKTX2(const QByteArray& data)
+{
+    RequireBytes(data, KTX2_HEADER_SIZE);
+
+    const auto vkFormat = ReadUInt32(data, 12);
+    const auto width = ReadUInt32(data, 20);
+    const auto height = ReadUInt32(data, 24);
+    const auto depth = ReadUInt32(data, 28);
+    const auto layerCount = ReadUInt32(data, 32);
+    const auto faceCount = ReadUInt32(data, 36);
+    const auto levelCount = std::max<quint32>(1, ReadUInt32(data, 40));
+    const auto supercompression = ReadUInt32(data, 44);
+
+    if (supercompression != 0) {
+        throw GeneralException("Supercompressed KTX2 files (Basis Universal, Zstandard) are not supported.");
+    }
+
+    if (depth > 1 || layerCount > 1 || faceCount != 1) {
+        throw GeneralException("Only 2D KTX2 textures are supported, arrays, cube maps and 3D textures are not.");
+    }
+
+    CompressedImage image;
+
+    // sRGB formats are sampled like the RGBA8 slots, without conversion.
+    switch (vkFormat)
+    {
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132:
+        case 133:
+        case 134:
+            image.format = FORMAT::BC1;
+            break;
+
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138:
+            image.format = FORMAT::BC3;
+            break;
+
+        case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+            image.format = FORMAT::BC5;
+            break;
+
+        case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+        case 146:
+            image.format = FORMAT::BC7;
+            break;
+
+        default:
+            throw GeneralException(QString("KTX2 format %1 is not supported, BC1, BC3, BC5 and BC7 are.").arg(vkFormat));
+    }
+
+    image.size = QSize(static_cast<int>(width), static_cast<int>(height));
+    RequireBytes(data, KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_SIZE * levelCount);
+
+    for (quint32 level = 0; level < levelCount; level++)
+    {
+        const auto index = KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_SIZE * level;
+        image.AddLevel(data,
+                       static_cast<qint64>(ReadUInt64(data, index)),
+                       static_cast<qint64>(ReadUInt64(data, index + 8)));
+    }
+
+    return image;
+}
+
+CompressedImage CompressedImage::FromDDS(const QByteArray& data)
+{
+    RequireBytes(data, DDS_HEADER_SIZE);
+
+    const auto height = ReadUInt32(data, 12);
+    const auto width = ReadUInt32(data, 16);
+    const auto levelCount = std::max<quint32>(1, ReadUInt32(data, 28));
+    const auto fourCC = ReadUInt32(data, 84);
+    const auto caps2 = ReadUInt32(data, 112);
+    auto offset = DDS_HEADER_SIZE;
+
+    if ((caps2 & DDS_CUBEMAP) != 0) {
+        throw GeneralException("DDS cube maps are not supported.");
+    }
+
+    CompressedImage image;
+
+    if (fourCC == FourCC("DXT1")) {
+        image.format = FORMAT::BC1;
+
+    } else if (fourCC == FourCC("DXT5")) {
+        image.format = FORMAT::BC3;
+
+    } else if (fourCC == FourCC("ATI2") || fourCC == FourCC("BC5U")) {
+        image.format = FORMAT::BC5;
+
+    } else if (fourCC == FourCC("DX10")) {
+        image.format = DXGIFormat(data);
+        offset += DDS_DX10_HEADER_SIZE;
+
+    } else {
+        throw GeneralException("Only block compressed DDS files (BC1, BC3, BC5, BC7) are supported.");
+    }
+
+    // Levels follow each other without padding.
+    image.size = QSize(static_cast<int>(width), static_cast<int>(height));
+    image.AddLevels(data, offset, static_cast<int>(levelCount));
+
+    return image;
+}
+
+void CompressedImage::AddLevels(const QByteArray& data, qint64 offset, int levelCount)
+{
+    for (int level = 0; level < levelCount; level++)
+    {
+        const auto levelSize = QSize(std::max(1, size.width() >> level), std::max(1, size.height() >> level));
+        const auto length = LevelBytes(format, levelSize);
+        AddLevel(data, offset, length);
+        offset += length;
+    }
+}
+
+void CompressedImage::AddLevel(const QByteArray& data, qint64 offset, qint64 length)
+{
+    const auto level = static_cast<int>(levels.size());
+
+    if (size.isEmpty() || level >= 32) {
+        throw GeneralException("The compressed texture has an invalid size.");
+    }
+
+    const auto levelSize = QSize(std::max(1, size.width() >> level), std::max(1, size.height() >> level));
+
+    if (length < LevelBytes(format, levelSize) || offset < 0 || offset + length > data.size())
+    {
+        throw GeneralException(
+                QString("Mip level %1 of the compressed texture is truncated.").arg(level)
+        );
+    }
+
+    levels << CompressedLevel{ levelSize, data.mid(offset, LevelBytes(format, levelSize)) };
+}
+
+void CompressedImage::DecodeColorBlock(const uchar* block, bool fourColors, uchar* pixels)
+{
+    const auto color0 = qFromLittleEndian<quint16>(block);
+    const auto color1 = qFromLittleEndian<quint16>(block + 2);
+    const auto indices = qFromLittleEndian<quint32>(block + 4);
+
+    std::array<std::array<int, 4>, 4> palette{};
+
+    for (int i = 0; i < 2; i++)
+    {
+        const auto color = i == 0 ? color0 : color1;
+        palette.at(i) = { Expand5((color >> 11) & 0x1F), Expand6((color >> 5) & 0x3F), Expand5(color & 0x1F), 255 };
+    }
+
+    const auto& c0 = palette.at(0);
+    const auto& c1 = palette.at(1);
+
+    // BC1 blocks with color0 <= color1 have three colors and transparent black.
+    if (fourColors || color0 > color1)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            palette.at(2).at(c) = (2 * c0.at(c) + c1.at(c)) / 3;
+            palette.at(3).at(c) = (c0.at(c) + 2 * c1.at(c)) / 3;
+        }
+
+        palette.at(2).at(3) = 255;
+        palette.at(3).at(3) = 255;
+
+    } else {
+        for (int c = 0; c < 3; c++) {
+            palette.at(2).at(c) = (c0.at(c) + c1.at(c)) / 2;
+        }
+
+        palette.at(2).at(3) = 255;
+        palette.at(3) = { 0, 0, 0, 0 };
+    }
+
+    for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; i++)
+    {
+        const auto& color = palette.at((indices >> (2 * i)) & 0x3);
+
+        for (int c = 0; c < 4; c++) {
+            pixels[i * 4 + c] = static_cast<uchar>(color.at(c));
+        }
+    }
+}
+
+void CompressedImage::DecodeChannelBlock(const uchar* block, int channel, uchar* pixels)
+{
+    const int value0 = block[0];
+    const int value1 = block[1];
+
+    std::array<int, 8> values{ value0, value1 };
+
+    if (value0 > value1)
+    {
+        for (int i = 1; i < 7; i++) {
+            values.at(i + 1) = ((7 - i) * value0 + i * value1) / 7;
+        }
+
+    } else {
+        for (int i = 1; i < 5; i++) {
+            values.at(i + 1) = ((5 - i) * value0 + i * value1) / 5;
+        }
+
+        values.at(6) = 0;
+        values.at(7) = 255;
+    }
+
+    // 16 indices of 3 bits.
+    quint64 indices = 0;
+
+    for (int i = 0; i < 6; i++) {
+        indices |= static_cast<quint64>(block[2 + i]) << (8 * i);
+    }
+
+    for (int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; i++) {
+        pixels[i * 4 + channel] = static_cast<uchar>(values.at((indices >> (3 * i)) & 0x7));
+    }
+}
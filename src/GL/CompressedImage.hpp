@@ -0,0 +1,102 @@
+/**
+ * CompressedImage Class
+ *
+ * Block compressed texture (BC1, BC3, BC5, BC7) read from KTX2 or DDS data,
+ * all mip levels are kept as stored and uploaded without decoding.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_COMPRESSEDIMAGE_HPP
+#define SHADERIDE_GL_COMPRESSEDIMAGE_HPP
+
+#include <QList>
+#include <QSize>
+#include <QImage>
+#include <QString>
+#include <QByteArray>
+#include <QtGui/qopengl.h>
+
+namespace ShaderIDE::GL {
+
+    struct CompressedLevel
+    {
+        QSize size;
+        QByteArray data;
+    };
+
+    class CompressedImage
+    {
+    public:
+        enum class FORMAT
+        {
+            BC1,
+            BC3,
+            BC5,
+            BC7
+        };
+
+        static constexpr int BLOCK_SIZE = 4;
+
+        // Throws GeneralException for files, which are no 2D BCn texture.
+        static CompressedImage FromData(const QByteArray& data);
+        static bool IsCompressed(const QByteArray& data); // KTX2 or DDS identifier
+        static bool IsCompressedFile(const QString& path); // By suffix
+
+        bool IsNull() const;
+        FORMAT Format() const;
+        QSize Size() const;
+        const QList<CompressedLevel>& Levels() const;
+        qint64 Bytes() const;
+        GLenum InternalFormat() const;
+        QString Description() const;
+
+        // RGBA8888 with the rows in file order, blocks are decoded in parallel.
+        // BC7 is not decoded, it is supported by every OpenGL 4.2 driver.
+        bool Decodable() const;
+        QImage Decode(int level) const;
+        int LevelForExtent(int extent) const; // Smallest level of at least extent pixels
+
+        static int BlockBytes(const FORMAT& format);
+        static qint64 LevelBytes(const FORMAT& format, const QSize& size);
+        static QString FormatName(const FORMAT& format);
+
+    private:
+        FORMAT format{ FORMAT::BC1 };
+        QSize size;
+        QList<CompressedLevel> levels;
+
+        static CompressedImage FromKTX2(const QByteArray& data);
+        static CompressedImage FromDDS(const QByteArray& data);
+        void AddLevels(const QByteArray& data, qint64 offset, int levelCount);
+        void AddLevel(const QByteArray& data, qint64 offset, qint64 length);
+
+        // 4x4 RGBA pixels
+        static void DecodeColorBlock(const uchar* block, bool fourColors, uchar* pixels);
+        static void DecodeChannelBlock(const uchar* block, int channel, uchar* pixels);
+    };
+}
+
+#endif // SHADERIDE_GL_COMPRESSEDIMAGE_HPP
@@ -0,0 +1,141 @@
+/**
+ * ComputeBindings Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#include <QRegularExpression>
+#include <QStringList>
+#include "ComputeBindings.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    const QRegularExpression BUFFER_PATTERN(R"(^buffer\s+(\d{1,9})\s+(\d{1,10})$)");
+    const QRegularExpression IMAGE_PATTERN(R"(^image\s+(\d{1,9})\s+(\d{1,9})\s*x\s*(\d{1,9})$)");
+}
+
+bool ComputeBinding::operator==(const ComputeBinding& other) const
+{
+    return type == other.type
+           && binding == other.binding
+           && size == other.size
+           && width == other.width
+           && height == other.height;
+}
+
+ComputeBindingList ComputeBindings::Parse(const QString& text)
+{
+    ComputeBindingList bindings;
+    const auto lines = text.split('\n');
+
+    for (int i = 0; i < lines.size(); i++)
+    {
+        const auto line = lines.at(i).trimmed();
+
+        if (line.isEmpty() || line.startsWith("//")) {
+            continue;
+        }
+
+        ComputeBinding binding;
+        const auto bufferMatch = BUFFER_PATTERN.match(line);
+        const auto imageMatch = IMAGE_PATTERN.match(line);
+
+        if (bufferMatch.hasMatch())
+        {
+            binding.type = ComputeBinding::TYPE::BUFFER;
+            binding.binding = bufferMatch.captured(1).toInt();
+            binding.size = bufferMatch.captured(2).toInt();
+
+            if (binding.size <= 0 || binding.size > MAX_BUFFER_SIZE) {
+                throw GeneralException(QString("Line %1: buffers hold 1 to %2 bytes.").arg(i + 1).arg(MAX_BUFFER_SIZE));
+            }
+
+        } else if (imageMatch.hasMatch()) {
+            binding.type = ComputeBinding::TYPE::IMAGE;
+            binding.binding = imageMatch.captured(1).toInt();
+            binding.width = imageMatch.captured(2).toInt();
+            binding.height = imageMatch.captured(3).toInt();
+
+            if (binding.width <= 0 || binding.height <= 0
+                || binding.width > MAX_IMAGE_SIZE || binding.height > MAX_IMAGE_SIZE)
+            {
+                throw GeneralException(QString("Line %1: images are 1 to %2 pixels wide and high.").arg(i + 1).arg(MAX_IMAGE_SIZE));
+            }
+
+        } else {
+            throw GeneralException(QString("Line %1: expected buffer <binding> <bytes> or image <binding> <width>x<height>.").arg(i + 1));
+        }
+
+        if (binding.binding > MAX_BINDING) {
+            throw GeneralException(QString("Line %1: bindings range from 0 to %2.").arg(i + 1).arg(MAX_BINDING));
+        }
+
+        // Buffers and images have separate binding points.
+        for (const auto& other : bindings)
+        {
+            if (other.type == binding.type && other.binding == binding.binding) {
+                throw GeneralException(QString("Line %1: binding %2 is declared twice.").arg(i + 1).arg(binding.binding));
+            }
+        }
+
+        bindings << binding;
+    }
+
+    return bindings;
+}
+
+QString ComputeBindings::Format(const ComputeBindingList& bindings)
+{
+    QStringList lines;
+
+    for (const auto& binding : bindings)
+    {
+        if (binding.type == ComputeBinding::TYPE::BUFFER) {
+            lines << QString("buffer %1 %2").arg(binding.binding).arg(binding.size);
+
+        } else {
+            lines << QString("image %1 %2x%3").arg(binding.binding).arg(binding.width).arg(binding.height);
+        }
+    }
+
+    return lines.join('\n');
+}
+
+int ComputeBindings::OutputIndex(const ComputeBindingList& bindings)
+{
+    for (int i = 0; i < bindings.size(); i++)
+    {
+        if (bindings.at(i).type == ComputeBinding::TYPE::IMAGE) {
+            return i;
+        }
+    }
+
+    return -1;
+}
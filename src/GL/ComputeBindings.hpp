@@ -0,0 +1,87 @@
+/**
+ * ComputeBindings Class
+ *
+ * Buffers and images bound to the compute shader, declared one
+ * per line (i.e. buffer 0 1024 or image 0 512x512).
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#ifndef SHADERIDE_GL_COMPUTEBINDINGS_HPP
+#define SHADERIDE_GL_COMPUTEBINDINGS_HPP
+
+#include <QList>
+#include <QString>
+
+namespace ShaderIDE::GL {
+
+    struct ComputeBinding
+    {
+        enum class TYPE
+        {
+            BUFFER, // Shader storage buffer, zero initialized
+            IMAGE // rgba32f image
+        };
+
+        TYPE type{ TYPE::IMAGE };
+        int binding{ 0 };
+        int size{ 0 }; // Bytes, buffers only
+        int width{ 0 };
+        int height{ 0 };
+
+        bool operator==(const ComputeBinding& other) const;
+    };
+
+    using ComputeBindingList = QList<ComputeBinding>;
+
+    struct ComputeSettings
+    {
+        bool enabled{ false };
+        bool everyFrame{ true }; // Dispatched again, if any input changed.
+        int groupsX{ 64 };
+        int groupsY{ 64 };
+        int groupsZ{ 1 };
+        ComputeBindingList bindings;
+    };
+
+    class ComputeBindings
+    {
+    public:
+        static constexpr int MAX_BINDING = 7; // Minimum of GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS and GL_MAX_IMAGE_UNITS
+        static constexpr int MAX_BUFFER_SIZE = 256 * 1024 * 1024;
+        static constexpr int MAX_IMAGE_SIZE = 8192;
+        static constexpr int MAX_GROUPS = 65535; // Minimum of GL_MAX_COMPUTE_WORK_GROUP_COUNT
+
+        // One binding per line: buffer <binding> <bytes> | image <binding> <width>x<height>
+        static ComputeBindingList Parse(const QString& text);
+        static QString Format(const ComputeBindingList& bindings);
+
+        // The first image is shown as computeOutput.
+        static int OutputIndex(const ComputeBindingList& bindings);
+    };
+}
+
+#endif // SHADERIDE_GL_COMPUTEBINDINGS_HPP
@@ -0,0 +1,268 @@
+/**
+ * ComputeStage Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#include <algorithm>
+#include <vector>
+#include "ComputeStage.hpp"
+
+using namespace ShaderIDE::GL;
+
+void ComputeStage::Init()
+{
+    initializeOpenGLFunctions();
+    glCreateQueries(GL_TIME_ELAPSED, NUM_QUERIES, queries.data());
+}
+
+void ComputeStage::Release()
+{
+    DeleteResources();
+    glDeleteProgram(program);
+    program = 0;
+    programKey = 0;
+
+    glDeleteQueries(NUM_QUERIES, queries.data());
+    queries.fill(0);
+    queriesPending.fill(false);
+    times.clear();
+    dispatches = 0;
+}
+
+void ComputeStage::SetSettings(const ComputeSettings& newSettings)
+{
+    if (newSettings.bindings == settings.bindings)
+    {
+        settings = newSettings;
+        return;
+    }
+
+    // Contents are lost, resources are zero initialized again.
+    DeleteResources();
+    settings = newSettings;
+    CreateResources();
+}
+
+const ComputeSettings& ComputeStage::Settings() const
+{
+    return settings;
+}
+
+bool ComputeStage::Active() const
+{
+    return settings.enabled && program != 0;
+}
+
+void ComputeStage::SwapProgram(GLuint newProgram, uint64_t key)
+{
+    glDeleteProgram(program);
+    program = newProgram;
+    programKey = key;
+
+    // Timings of the previous program are meaningless now.
+    times.clear();
+    dispatches = 0;
+}
+
+GLuint ComputeStage::Program() const
+{
+    return program;
+}
+
+uint64_t ComputeStage::ProgramKey() const
+{
+    return programKey;
+}
+
+void ComputeStage::Dispatch()
+{
+    if (!Active()) {
+        return;
+    }
+
+    // The oldest query is reused, its result is
+    // read first, if it was not picked up yet.
+    if (queriesPending.at(nextQuery)) {
+        ReadQuery(nextQuery);
+    }
+
+    glUseProgram(program);
+    BindResources();
+
+    glBeginQuery(GL_TIME_ELAPSED, queries.at(nextQuery));
+    glDispatchCompute(settings.groupsX, settings.groupsY, settings.groupsZ);
+    glEndQuery(GL_TIME_ELAPSED);
+
+    queriesPending.at(nextQuery) = true;
+    nextQuery = (nextQuery + 1) % NUM_QUERIES;
+    dispatches++;
+
+    // Writes are visible to samplers, images and buffers of the following draws.
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+                    | GL_TEXTURE_FETCH_BARRIER_BIT
+                    | GL_SHADER_STORAGE_BARRIER_BIT
+                    | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    glUseProgram(0);
+}
+
+GLuint ComputeStage::OutputTexture() const
+{
+    return settings.enabled ? outputTexture : 0;
+}
+
+bool ComputeStage::PollTimings()
+{
+    bool updated = false;
+
+    // Oldest first, results become available in submission order.
+    for (int i = 0; i < NUM_QUERIES; i++)
+    {
+        const auto index = (nextQuery + i) % NUM_QUERIES;
+
+        if (!queriesPending.at(index)) {
+            continue;
+        }
+
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(queries.at(index), GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available != GL_TRUE) {
+            break;
+        }
+
+        ReadQuery(index);
+        updated = true;
+    }
+
+    return updated;
+}
+
+bool ComputeStage::TimingsPending() const
+{
+    return std::any_of(queriesPending.begin(), queriesPending.end(), [](bool pending) { return pending; });
+}
+
+double ComputeStage::LastTime() const
+{
+    return times.empty() ? 0.0 : times.back();
+}
+
+double ComputeStage::MedianTime() const
+{
+    if (times.empty()) {
+        return 0.0;
+    }
+
+    std::vector<double> sorted(times.begin(), times.end());
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<long>(sorted.size() / 2), sorted.end());
+    return sorted.at(sorted.size() / 2);
+}
+
+int ComputeStage::Dispatches() const
+{
+    return dispatches;
+}
+
+void ComputeStage::CreateResources()
+{
+    const auto outputIndex = ComputeBindings::OutputIndex(settings.bindings);
+
+    for (int i = 0; i < settings.bindings.size(); i++)
+    {
+        const auto& binding = settings.bindings.at(i);
+        GLuint resource = 0;
+
+        if (binding.type == ComputeBinding::TYPE::BUFFER)
+        {
+            glCreateBuffers(1, &resource);
+            glNamedBufferStorage(resource, binding.size, nullptr, GL_DYNAMIC_STORAGE_BIT);
+            glClearNamedBufferData(resource, GL_R32F, GL_RED, GL_FLOAT, nullptr);
+
+        } else {
+            glCreateTextures(GL_TEXTURE_2D, 1, &resource);
+            glTextureStorage2D(resource, 1, GL_RGBA32F, binding.width, binding.height);
+            glTextureParameteri(resource, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(resource, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(resource, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(resource, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glClearTexImage(resource, 0, GL_RGBA, GL_FLOAT, nullptr);
+        }
+
+        if (i == outputIndex) {
+            outputTexture = resource;
+        }
+
+        resources << resource;
+    }
+}
+
+void ComputeStage::DeleteResources()
+{
+    for (int i = 0; i < resources.size() && i < settings.bindings.size(); i++)
+    {
+        auto resource = resources.at(i);
+
+        if (settings.bindings.at(i).type == ComputeBinding::TYPE::BUFFER) {
+            glDeleteBuffers(1, &resource);
+
+        } else {
+            glDeleteTextures(1, &resource);
+        }
+    }
+
+    resources.clear();
+    outputTexture = 0;
+}
+
+void ComputeStage::BindResources()
+{
+    for (int i = 0; i < resources.size(); i++)
+    {
+        const auto& binding = settings.bindings.at(i);
+
+        if (binding.type == ComputeBinding::TYPE::BUFFER) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding.binding, resources.at(i));
+
+        } else {
+            glBindImageTexture(binding.binding, resources.at(i), 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA32F);
+        }
+    }
+}
+
+void ComputeStage::ReadQuery(int index)
+{
+    GLuint64 elapsed = 0;
+    glGetQueryObjectui64v(queries.at(index), GL_QUERY_RESULT, &elapsed);
+    queriesPending.at(index) = false;
+
+    times.push_back(static_cast<double>(elapsed) / 1000000.0);
+
+    if (times.size() > MAX_TIMES) {
+        times.pop_front();
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * ComputeStage Class
+ *
+ * Compute program, its storage buffers and images. Dispatches are
+ * timed with GL_TIME_ELAPSED queries, which are read without stalling.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#ifndef SHADERIDE_GL_COMPUTESTAGE_HPP
+#define SHADERIDE_GL_COMPUTESTAGE_HPP
+
+#include <cstdint>
+#include <array>
+#include <deque>
+#include <QList>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "ComputeBindings.hpp"
+
+namespace ShaderIDE::GL {
+
+    class ComputeStage : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr int NUM_QUERIES = 4;
+        static constexpr size_t MAX_TIMES = 64;
+
+    public:
+        // Render Thread
+        void Init();
+        void Release();
+
+        // Resources are recreated, if the bindings changed.
+        void SetSettings(const ComputeSettings& newSettings);
+        const ComputeSettings& Settings() const;
+        bool Active() const;
+
+        void SwapProgram(GLuint newProgram, uint64_t key);
+        GLuint Program() const;
+        uint64_t ProgramKey() const;
+
+        void Dispatch();
+        GLuint OutputTexture() const;
+
+        // Timings (Milliseconds)
+        bool PollTimings();
+        bool TimingsPending() const;
+        double LastTime() const;
+        double MedianTime() const;
+        int Dispatches() const;
+
+    private:
+        ComputeSettings settings;
+        GLuint program{ 0 };
+        uint64_t programKey{ 0 };
+
+        QList<GLuint> resources; // Buffer or texture of each binding
+        GLuint outputTexture{ 0 };
+
+        std::array<GLuint, NUM_QUERIES> queries{};
+        std::array<bool, NUM_QUERIES> queriesPending{};
+        int nextQuery{ 0 };
+        std::deque<double> times;
+        int dispatches{ 0 };
+
+        void CreateResources();
+        void DeleteResources();
+        void BindResources();
+        void ReadQuery(int index);
+    };
+}
+
+#endif // SHADERIDE_GL_COMPUTESTAGE_HPP
@@ -0,0 +1,85 @@
+/**
+ * FrameExchange Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <utility>
+#include <QMutexLocker>
+#include "FrameExchange.hpp"
+
+using namespace ShaderIDE::GL;
+
+int FrameExchange::BackIndex()
+{
+    QMutexLocker locker(&mutex);
+    return back;
+}
+
+GLsync FrameExchange::TakePresentFence(int index)
+{
+    QMutexLocker locker(&mutex);
+    return std::exchange(frames.at(index).presentFence, nullptr);
+}
+
+GLsync FrameExchange::TakeRenderFence(int index)
+{
+    QMutexLocker locker(&mutex);
+    return std::exchange(frames.at(index).renderFence, nullptr);
+}
+
+void FrameExchange::PublishBack(GLuint texture, GLsync renderFence)
+{
+    QMutexLocker locker(&mutex);
+
+    frames.at(back).texture = texture;
+    frames.at(back).renderFence = renderFence;
+
+    // A frame, which was never presented, is simply replaced.
+    std::swap(back, ready);
+    fresh = true;
+}
+
+bool FrameExchange::AcquireFront(GLuint& texture, GLsync& renderFence)
+{
+    QMutexLocker locker(&mutex);
+
+    if (fresh)
+    {
+        std::swap(front, ready);
+        fresh = false;
+    }
+
+    texture = frames.at(front).texture;
+    renderFence = std::exchange(frames.at(front).renderFence, nullptr);
+
+    return texture != 0;
+}
+
+GLsync FrameExchange::ReplacePresentFence(GLsync presentFence)
+{
+    QMutexLocker locker(&mutex);
+    return std::exchange(frames.at(front).presentFence, presentFence);
+}
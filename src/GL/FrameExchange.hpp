@@ -0,0 +1,78 @@
+/**
+ * FrameExchange Class
+ *
+ * Triple buffered hand-over of rendered frames between the
+ * render thread (producer) and the viewport (consumer).
+ * Only texture names and sync objects are exchanged, both
+ * contexts have to be in the same share group.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_FRAMEEXCHANGE_HPP
+#define SHADERIDE_GL_FRAMEEXCHANGE_HPP
+
+#include <array>
+#include <QMutex>
+#include <QtGui/qopengl.h>
+
+namespace ShaderIDE::GL {
+
+    class FrameExchange
+    {
+    public:
+        static constexpr int NUM_FRAMES = 3;
+
+        FrameExchange() = default;
+
+        // Producer (Render Thread)
+        int BackIndex();
+        GLsync TakePresentFence(int index);
+        GLsync TakeRenderFence(int index);
+        void PublishBack(GLuint texture, GLsync renderFence);
+
+        // Consumer (Viewport)
+        bool AcquireFront(GLuint& texture, GLsync& renderFence);
+        GLsync ReplacePresentFence(GLsync presentFence);
+
+    private:
+        struct Frame
+        {
+            GLuint texture{ 0 };
+            GLsync renderFence{ nullptr };
+            GLsync presentFence{ nullptr };
+        };
+
+        QMutex mutex;
+        std::array<Frame, NUM_FRAMES> frames{};
+
+        int back{ 0 };
+        int ready{ 1 };
+        int front{ 2 };
+        bool fresh{ false };
+    };
+}
+
+#endif // SHADERIDE_GL_FRAMEEXCHANGE_HPP
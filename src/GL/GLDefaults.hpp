@@ -97,10 +97,63 @@
     "    fragColor          = tex * lightVal * lightInt;\n" \
     "}"
 
-#define GLSL_TEXTURE_SLOT_0_NAME "tex0"
-#define GLSL_TEXTURE_SLOT_1_NAME "tex1"
-#define GLSL_TEXTURE_SLOT_2_NAME "tex2"
-#define GLSL_TEXTURE_SLOT_3_NAME "tex3"
+#define GLSL_DEFAULT_CS_SOURCE \
+    "#version 450 core\n" \
+    "\n" \
+    "layout(local_size_x = 8, local_size_y = 8) in;\n" \
+    "\n" \
+    "// Shown as computeOutput on the plane or mesh.\n" \
+    "layout(rgba32f, binding = 0) uniform writeonly image2D outputImage;\n" \
+    "\n" \
+    "uniform float time;\n" \
+    "\n" \
+    "void main()\n" \
+    "{\n" \
+    "    ivec2 pixel = ivec2(gl_GlobalInvocationID.xy);\n" \
+    "    ivec2 size  = imageSize(outputImage);\n" \
+    "\n" \
+    "    if (pixel.x >= size.x || pixel.y >= size.y) {\n" \
+    "        return;\n" \
+    "    }\n" \
+    "\n" \
+    "    vec2 uv = (vec2(pixel) + 0.5f) / vec2(size);\n" \
+    "    imageStore(outputImage, pixel, vec4(uv, 0.5f + 0.5f * sin(time), 1.0f));\n" \
+    "}"
+
+#define GLSL_DEFAULT_COMPUTE_BINDINGS "image 0 512x512"
+#define GLSL_COMPUTE_OUTPUT_NAME "computeOutput"
+
+#define GLSL_TEXTURE_SLOT_PREFIX "tex" // tex0, tex1, ...
+#define GLSL_TEXTURE_SLOTS_DEFAULT 4
+#define GLSL_TEXTURE_SLOTS_MAX 16
+#define GLSL_TEXTURE_ARRAY_NAME "texArray"
+
+#define GLSL_SCREENQUAD_VS_SOURCE \
+    "#version 450 core\n" \
+    "\n" \
+    "out vec2 vUV;\n" \
+    "\n" \
+    "void main()" \
+    "{\n" \
+    "    vUV            = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n" \
+    "    gl_Position    = vec4(vUV * 2.0f - 1.0f, 0.0f, 1.0f);\n" \
+    "}"
+
+#define GLSL_SCREENQUAD_FS_SOURCE \
+    "#version 450 core\n" \
+    "\n" \
+    "uniform sampler2D screenTexture;\n" \
+    "\n" \
+    "in vec2 vUV;\n" \
+    "\n" \
+    "out vec4 fragColor;\n" \
+    "\n" \
+    "void main()" \
+    "{\n" \
+    "    fragColor      = texture(screenTexture, vUV);\n" \
+    "}"
+
+#define GLSL_SCREENQUAD_TEXTURE_NAME "screenTexture"
 
 #define OPENGLWIDGET_DEFAULT_MODEL_ROTATION \
     glm::vec3(glm::radians(35.0f), glm::radians(45.0f), 0)
@@ -26,7 +26,7 @@
  * SOFTWARE.
  */
 
-#include <QRegularExpression>
+#include <algorithm>
 #include "GLSLCompileError.hpp"
 
 using namespace ShaderIDE::GL;
@@ -42,19 +42,24 @@ ShaderType GLSLCompileError::GetShaderType()
     return type;
 }
 
+uint32_t GLSLCompileError::SourceIndex()
+{
+    return first.sourceIndex;
+}
+
 uint32_t GLSLCompileError::Line()
 {
-    return line;
+    return first.line;
 }
 
 QString GLSLCompileError::Code()
 {
-    return code;
+    return first.code;
 }
 
 QString GLSLCompileError::Message()
 {
-    return message;
+    return first.message;
 }
 
 QString GLSLCompileError::Raw()
@@ -62,20 +67,51 @@ QString GLSLCompileError::Raw()
     return raw;
 }
 
+QString GLSLCompileError::File()
+{
+    return first.file;
+}
+
+GLSLDiagnosticList GLSLCompileError::Diagnostics()
+{
+    return diagnostics;
+}
+
+int GLSLCompileError::ErrorCount()
+{
+    return static_cast<int>(std::count_if(diagnostics.begin(), diagnostics.end(), [](const auto& diagnostic) {
+        return diagnostic.severity == GLSLDiagnostic::SEVERITY::FAILURE;
+    }));
+}
+
+int GLSLCompileError::WarningCount()
+{
+    return static_cast<int>(diagnostics.size()) - ErrorCount();
+}
+
+void GLSLCompileError::ResolveFiles(const std::function<QString(uint32_t)>& fileName)
+{
+    for (auto& diagnostic : diagnostics) {
+        diagnostic.file = fileName(diagnostic.sourceIndex);
+    }
+
+    first.file = fileName(first.sourceIndex);
+}
+
 void GLSLCompileError::Parse(const QString& rawError)
 {
-    // 0(0) : error C0000: MESSAGE
-    auto errorPattern = R"(\((\d+)\)\s*:\s*error\s*([C0-9]+)\s*:\s*(.*))";
-
-    QRegularExpression expr(errorPattern);
-    auto matches = expr.globalMatch(rawError);
-
-    while (matches.hasNext())
-    {
-        auto match = matches.next();
-        line = match.captured(1).toUInt();
-        code = match.captured(2);
-        message = match.captured(3);
+    // The source string number is 0 for the editor (see #line).
+    diagnostics = GLSLDiagnostics::Parse(rawError);
+
+    const auto error = std::find_if(diagnostics.begin(), diagnostics.end(), [](const auto& diagnostic) {
+        return diagnostic.severity == GLSLDiagnostic::SEVERITY::FAILURE;
+    });
+
+    if (error != diagnostics.end()) {
+        first = *error;
+
+    } else if (!diagnostics.isEmpty()) {
+        first = diagnostics.first();
     }
 
     raw = rawError;
@@ -31,8 +31,11 @@
 #ifndef SHADERIDE_GL_GLSLCOMPILEERROR_HPP
 #define SHADERIDE_GL_GLSLCOMPILEERROR_HPP
 
+#include <functional>
 #include <QString>
+#include <QMetaType>
 #include "Shader.hpp"
+#include "GLSLDiagnostics.hpp"
 
 namespace ShaderIDE::GL {
 
@@ -42,16 +45,29 @@ namespace ShaderIDE::GL {
         explicit GLSLCompileError(const ShaderType& shaderType, const QString& rawError);
 
         ShaderType GetShaderType();
+
+        // First error of the log.
+        uint32_t SourceIndex();
         uint32_t Line();
         QString Code();
         QString Message();
         QString Raw();
 
+        // Included file the error refers to, empty for the editor.
+        QString File();
+
+        // All errors and warnings of the log.
+        GLSLDiagnosticList Diagnostics();
+        int ErrorCount();
+        int WarningCount();
+
+        // Maps the source string numbers to the included files.
+        void ResolveFiles(const std::function<QString(uint32_t)>& fileName);
+
     private:
         ShaderType type;
-        uint32_t line{ 0 };
-        QString code{ "" };
-        QString message{ "" };
+        GLSLDiagnosticList diagnostics;
+        GLSLDiagnostic first;
         QString raw{ "" };
 
     private:
@@ -59,4 +75,7 @@ namespace ShaderIDE::GL {
     };
 }
 
+// Compile errors are emitted by the render thread.
+Q_DECLARE_METATYPE(ShaderIDE::GL::GLSLCompileError)
+
 #endif // SHADERIDE_GL_GLSLCOMPILEERROR_HPP
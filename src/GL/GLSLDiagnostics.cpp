@@ -0,0 +1,105 @@
+/**
+ * GLSLDiagnostics Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QRegularExpression>
+#include "GLSLDiagnostics.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    // Compiled once, logs of broken shaders contain hundreds of lines.
+    const QRegularExpression NVIDIA_PATTERN(
+            R"(^\s*(\d+)\((\d+)\)\s*:\s*(error|warning)\s*([A-Z]?\d+)?\s*:\s*(.*)$)",
+            QRegularExpression::CaseInsensitiveOption
+    );
+
+    const QRegularExpression MESA_PATTERN(
+            R"(^\s*(\d+):(\d+)\((\d+)\)\s*:\s*(error|warning)\s*:\s*(.*)$)",
+            QRegularExpression::CaseInsensitiveOption
+    );
+
+    const QRegularExpression AMD_PATTERN(
+            R"(^\s*(ERROR|WARNING)\s*:\s*(\d+):(\d+)\s*:\s*(.*)$)",
+            QRegularExpression::CaseInsensitiveOption
+    );
+
+    GLSLDiagnostic::SEVERITY Severity(const QString& severity)
+    {
+        return severity.compare("warning", Qt::CaseInsensitive) == 0
+                ? GLSLDiagnostic::SEVERITY::WARNING
+                : GLSLDiagnostic::SEVERITY::FAILURE;
+    }
+}
+
+GLSLDiagnosticList GLSLDiagnostics::Parse(const QString& log)
+{
+    GLSLDiagnosticList diagnostics;
+
+    for (const auto& line : log.split('\n'))
+    {
+        GLSLDiagnostic diagnostic;
+
+        if (const auto nvidia = NVIDIA_PATTERN.match(line); nvidia.hasMatch())
+        {
+            diagnostic.sourceIndex = nvidia.captured(1).toUInt();
+            diagnostic.line = nvidia.captured(2).toUInt();
+            diagnostic.severity = Severity(nvidia.captured(3));
+            diagnostic.code = nvidia.captured(4);
+            diagnostic.message = nvidia.captured(5).trimmed();
+
+        } else if (const auto mesa = MESA_PATTERN.match(line); mesa.hasMatch()) {
+            diagnostic.sourceIndex = mesa.captured(1).toUInt();
+            diagnostic.line = mesa.captured(2).toUInt();
+            diagnostic.column = mesa.captured(3).toUInt();
+            diagnostic.severity = Severity(mesa.captured(4));
+            diagnostic.message = mesa.captured(5).trimmed();
+
+        } else if (const auto amd = AMD_PATTERN.match(line); amd.hasMatch()) {
+            diagnostic.severity = Severity(amd.captured(1));
+            diagnostic.sourceIndex = amd.captured(2).toUInt();
+            diagnostic.line = amd.captured(3).toUInt();
+            diagnostic.message = amd.captured(4).trimmed();
+
+        } else {
+            continue;
+        }
+
+        diagnostics << diagnostic;
+    }
+
+    // Unknown formats and messages without a line (i.e. link errors).
+    if (diagnostics.isEmpty() && !log.trimmed().isEmpty())
+    {
+        GLSLDiagnostic diagnostic;
+        diagnostic.message = log.trimmed();
+        diagnostics << diagnostic;
+    }
+
+    return diagnostics;
+}
@@ -0,0 +1,71 @@
+/**
+ * GLSLDiagnostics Class
+ *
+ * Extracts all errors and warnings from driver info logs. Known formats:
+ * NVIDIA  0(12) : error C0000: message
+ * Mesa    0:12(3): error: message
+ * AMD     ERROR: 0:12: message
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_GLSLDIAGNOSTICS_HPP
+#define SHADERIDE_GL_GLSLDIAGNOSTICS_HPP
+
+#include <cstdint>
+#include <QList>
+#include <QString>
+#include <QMetaType>
+
+namespace ShaderIDE::GL {
+
+    struct GLSLDiagnostic
+    {
+        enum class SEVERITY
+        {
+            FAILURE, // Not ERROR, a macro of wingdi.h
+            WARNING
+        };
+
+        SEVERITY severity{ SEVERITY::FAILURE };
+        uint32_t sourceIndex{ 0 }; // Source string number, see #line.
+        uint32_t line{ 0 }; // 0 if unknown
+        uint32_t column{ 0 }; // 0 if unknown
+        QString code{ "" };
+        QString message{ "" };
+        QString file{ "" }; // Included file, empty for the editor.
+    };
+
+    using GLSLDiagnosticList = QList<GLSLDiagnostic>;
+
+    class GLSLDiagnostics
+    {
+    public:
+        // Logs without any known diagnostic result in a single error.
+        static GLSLDiagnosticList Parse(const QString& log);
+    };
+}
+
+#endif // SHADERIDE_GL_GLSLDIAGNOSTICS_HPP
@@ -0,0 +1,185 @@
+/**
+ * GLSLFingerprint Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include "GLSLFingerprint.hpp"
+#include "src/Core/Hash.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    // Multi character operators of the GLSL lexer, longest first.
+    const std::array<const char*, 21> OPERATORS = {
+            "<<=", ">>=",
+            "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||", "^^",
+            "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^="
+    };
+
+    bool IsWordChar(const QChar& c)
+    {
+        return c.isLetterOrNumber() || c == '_' || c == '.';
+    }
+}
+
+QString GLSLFingerprint::Normalize(const QString& source)
+{
+    QString normalized;
+    normalized.reserve(source.size());
+
+    const auto length = source.size();
+    bool lineStart = true;
+    bool directive = false;
+    bool directiveName = false;
+    bool macroName = false;
+    qsizetype i = 0;
+
+    auto addToken = [&](const QString& token) {
+        if (!normalized.isEmpty() && !normalized.endsWith('\n')) {
+            normalized += ' ';
+        }
+
+        normalized += token;
+        lineStart = false;
+    };
+
+    while (i < length)
+    {
+        const auto c = source.at(i);
+        const auto next = i + 1 < length ? source.at(i + 1) : QChar();
+
+        // Line Comment
+        if (c == '/' && next == '/')
+        {
+            while (i < length && source.at(i) != '\n') {
+                i++;
+            }
+
+            continue;
+        }
+
+        // Block Comment
+        if (c == '/' && next == '*')
+        {
+            auto end = source.indexOf("*/", i + 2);
+            i = end < 0 ? length : end + 2;
+            continue;
+        }
+
+        // Line Continuation (Preprocessor)
+        if (c == '\\' && next == '\n')
+        {
+            i += 2;
+            continue;
+        }
+
+        // Newlines only matter to terminate preprocessor directives.
+        if (c == '\n')
+        {
+            if (directive)
+            {
+                normalized += '\n';
+                directive = false;
+                directiveName = false;
+                macroName = false;
+            }
+
+            lineStart = true;
+            i++;
+            continue;
+        }
+
+        if (c.isSpace())
+        {
+            i++;
+            continue;
+        }
+
+        // Preprocessor Directive
+        if (c == '#' && lineStart)
+        {
+            addToken("#");
+            directive = true;
+            directiveName = true;
+            i++;
+            continue;
+        }
+
+        // Identifiers, Keywords & Numbers
+        if (IsWordChar(c))
+        {
+            auto start = i;
+
+            while (i < length && IsWordChar(source.at(i))) {
+                i++;
+            }
+
+            const auto word = source.mid(start, i - start);
+
+            // A function-like macro has its parameter list glued to the name,
+            // "#define F (x)" would make "(x)" part of an object-like body.
+            if (macroName && i < length && source.at(i) == '(') {
+                addToken(word + '(');
+                i++;
+
+            } else {
+                addToken(word);
+            }
+
+            macroName = directiveName && word == "define";
+            directiveName = false;
+            continue;
+        }
+
+        // Operators & Punctuation
+        qsizetype operatorLength = 1;
+
+        for (const auto& op : OPERATORS)
+        {
+            const auto opString = QString(op);
+
+            if (source.mid(i, opString.size()) == opString)
+            {
+                operatorLength = opString.size();
+                break;
+            }
+        }
+
+        addToken(source.mid(i, operatorLength));
+        i += operatorLength;
+        directiveName = false;
+        macroName = false;
+    }
+
+    return normalized;
+}
+
+uint64_t GLSLFingerprint::Compute(const QString& source)
+{
+    return Hash().Add(Normalize(source)).Value();
+}
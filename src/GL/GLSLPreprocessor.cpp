@@ -0,0 +1,247 @@
+/**
+ * GLSLPreprocessor Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include "GLSLPreprocessor.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    // #include "file" or #include <file>
+    const QRegularExpression INCLUDE_PATTERN(R"(^\s*#\s*include\s*["<]([^">]+)[">])");
+}
+
+void GLSLPreprocessor::SetIncludeDirectory(const QString& directory)
+{
+    includeDirectory = directory;
+}
+
+QString GLSLPreprocessor::IncludeDirectory() const
+{
+    return includeDirectory;
+}
+
+QString GLSLPreprocessor::Expand(const QString& source)
+{
+    dependencies.clear();
+    expandedFiles = 0;
+    cachedFiles = 0;
+
+    // Sources without includes are passed through as they are.
+    if (!source.contains("include")) {
+        return source;
+    }
+
+    QStringList includeStack;
+    QMap<QString, uint64_t> includes;
+
+    const auto expanded = ExpandSource(source, MAIN_SOURCE_INDEX, includeDirectory, includeStack, includes);
+    cachedFiles = static_cast<int>(dependencies.size()) - expandedFiles;
+
+    return expanded;
+}
+
+QString GLSLPreprocessor::FileName(int sourceIndex) const
+{
+    return fileNames.value(sourceIndex, "");
+}
+
+QStringList GLSLPreprocessor::Dependencies() const
+{
+    return dependencies.values();
+}
+
+QStringList GLSLPreprocessor::Dependents(const QString& path) const
+{
+    QStringList dependents;
+    QStringList pending{ QFileInfo(path).absoluteFilePath() };
+
+    while (!pending.isEmpty())
+    {
+        const auto dependency = pending.takeFirst();
+
+        for (const auto& [file, entry] : files)
+        {
+            if (entry.includes.contains(dependency) && !dependents.contains(file))
+            {
+                dependents << file;
+                pending << file;
+            }
+        }
+    }
+
+    return dependents;
+}
+
+int GLSLPreprocessor::ExpandedFiles() const
+{
+    return expandedFiles;
+}
+
+int GLSLPreprocessor::CachedFiles() const
+{
+    return cachedFiles;
+}
+
+const GLSLPreprocessor::FileEntry& GLSLPreprocessor::ExpandFile(const QString& path, QStringList& includeStack)
+{
+    auto& entry = files[path];
+    dependencies.insert(path);
+
+    if (entry.sourceIndex == 0)
+    {
+        entry.sourceIndex = nextSourceIndex++;
+        fileNames.insert(entry.sourceIndex, path);
+    }
+
+    // Changed on disk?
+    const QFileInfo fileInfo(path);
+    auto changed = entry.revision == 0
+            || fileInfo.lastModified() != entry.lastModified
+            || fileInfo.size() != entry.size;
+
+    if (changed)
+    {
+        QFile file(path);
+
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            throw Error(entry.sourceIndex, 1, "Could not read the file");
+        }
+
+        entry.content = QString::fromUtf8(file.readAll());
+        entry.lastModified = fileInfo.lastModified();
+        entry.size = fileInfo.size();
+        entry.revision = 0; // Until expanded successfully.
+    }
+
+    includeStack << path;
+
+    // Changed dependencies have a new revision.
+    for (auto it = entry.includes.cbegin(); !changed && it != entry.includes.cend(); ++it) {
+        changed = ExpandFile(it.key(), includeStack).revision != it.value();
+    }
+
+    if (changed)
+    {
+        QMap<QString, uint64_t> includes;
+        entry.expanded = ExpandSource(entry.content, entry.sourceIndex, fileInfo.absolutePath(), includeStack, includes);
+        entry.includes = includes;
+        entry.revision = nextRevision++;
+        expandedFiles++;
+    }
+
+    includeStack.removeLast();
+    return entry;
+}
+
+QString GLSLPreprocessor::ExpandSource(const QString& source,
+                                       int sourceIndex,
+                                       const QString& directory,
+                                       QStringList& includeStack,
+                                       QMap<QString, uint64_t>& includes)
+{
+    const auto lines = source.split('\n');
+    QStringList expandedLines;
+
+    for (int i = 0; i < lines.size(); i++)
+    {
+        const auto match = INCLUDE_PATTERN.match(lines.at(i));
+
+        if (!match.hasMatch())
+        {
+            expandedLines << lines.at(i);
+            continue;
+        }
+
+        const auto path = ResolvePath(match.captured(1), directory);
+
+        if (path.isEmpty()) {
+            throw Error(sourceIndex, i + 1, QString("Include file \"%1\" not found").arg(match.captured(1)));
+        }
+
+        if (includeStack.contains(path)) {
+            throw Error(sourceIndex, i + 1, "Include cycle " + IncludeChain(includeStack, path));
+        }
+
+        if (includeStack.size() >= MAX_INCLUDE_DEPTH) {
+            throw Error(sourceIndex, i + 1, "Include depth exceeded " + IncludeChain(includeStack, path));
+        }
+
+        const auto& includedFile = ExpandFile(path, includeStack);
+        includes.insert(path, includedFile.revision);
+
+        // Line numbers refer to the included file, then
+        // continue with the line after the directive.
+        expandedLines << QString("#line 1 %1").arg(includedFile.sourceIndex);
+        expandedLines << includedFile.expanded;
+        expandedLines << QString("#line %1 %2").arg(i + 2).arg(sourceIndex);
+    }
+
+    return expandedLines.join('\n');
+}
+
+QString GLSLPreprocessor::ResolvePath(const QString& name, const QString& directory) const
+{
+    // Relative to the including file first, then to the include directory.
+    for (const auto& baseDirectory : { directory, includeDirectory })
+    {
+        if (baseDirectory.isEmpty()) {
+            continue;
+        }
+
+        const QFileInfo fileInfo(QDir(baseDirectory).filePath(name));
+
+        if (fileInfo.isFile() && fileInfo.isReadable()) {
+            return fileInfo.absoluteFilePath();
+        }
+    }
+
+    return "";
+}
+
+SyntaxErrorException GLSLPreprocessor::Error(int sourceIndex, int line, const QString& message) const
+{
+    // Same format as driver errors, see GLSLCompileError.
+    const auto file = sourceIndex == MAIN_SOURCE_INDEX ? QString("Shader") : FileName(sourceIndex);
+    return SyntaxErrorException(file, QString("%1(%2) : error P0001: %3").arg(sourceIndex).arg(line).arg(message));
+}
+
+QString GLSLPreprocessor::IncludeChain(const QStringList& includeStack, const QString& path)
+{
+    QStringList names;
+
+    for (const auto& file : includeStack + QStringList{ path }) {
+        names << QFileInfo(file).fileName();
+    }
+
+    return names.join(" -> ");
+}
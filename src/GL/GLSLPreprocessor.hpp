@@ -0,0 +1,113 @@
+/**
+ * GLSLPreprocessor Class
+ *
+ * Resolves #include directives relative to the including file and the
+ * include directory (project). Included files are marked with #line
+ * directives, so driver errors refer to the original file and line.
+ * Expanded files are cached and only expanded again, if they or one of
+ * their dependencies changed.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_GLSLPREPROCESSOR_HPP
+#define SHADERIDE_GL_GLSLPREPROCESSOR_HPP
+
+#include <cstdint>
+#include <map>
+#include <QString>
+#include <QStringList>
+#include <QDateTime>
+#include <QHash>
+#include <QSet>
+#include <QMap>
+#include "src/Core/SyntaxErrorException.hpp"
+
+namespace ShaderIDE::GL {
+
+    class GLSLPreprocessor
+    {
+        static constexpr int MAX_INCLUDE_DEPTH = 32;
+
+        struct FileEntry
+        {
+            int sourceIndex{ 0 };
+            QDateTime lastModified;
+            qint64 size{ -1 };
+            QString content{ "" };
+
+            // Expansion
+            uint64_t revision{ 0 };
+            QString expanded{ "" };
+            QMap<QString, uint64_t> includes; // Path -> revision used for the expansion.
+        };
+
+    public:
+        // Source string number of the editor buffer in #line directives.
+        static constexpr int MAIN_SOURCE_INDEX = 0;
+
+        void SetIncludeDirectory(const QString& directory);
+        QString IncludeDirectory() const;
+
+        // Throws SyntaxErrorException for missing files and include cycles.
+        QString Expand(const QString& source);
+
+        // File of a source string number, empty for the editor buffer.
+        QString FileName(int sourceIndex) const;
+
+        // Dependency Graph
+        QStringList Dependencies() const; // Files of the last expansion.
+        QStringList Dependents(const QString& path) const; // Files including path (transitive).
+
+        // Statistics of the last expansion
+        int ExpandedFiles() const;
+        int CachedFiles() const;
+
+    private:
+        QString includeDirectory{ "" };
+        std::map<QString, FileEntry> files; // References stay valid on insert.
+        QHash<int, QString> fileNames;
+        int nextSourceIndex{ MAIN_SOURCE_INDEX + 1 };
+        uint64_t nextRevision{ 1 };
+
+        QSet<QString> dependencies;
+        int expandedFiles{ 0 };
+        int cachedFiles{ 0 };
+
+        const FileEntry& ExpandFile(const QString& path, QStringList& includeStack);
+
+        QString ExpandSource(const QString& source,
+                             int sourceIndex,
+                             const QString& directory,
+                             QStringList& includeStack,
+                             QMap<QString, uint64_t>& includes);
+
+        QString ResolvePath(const QString& name, const QString& directory) const;
+        SyntaxErrorException Error(int sourceIndex, int line, const QString& message) const;
+        static QString IncludeChain(const QStringList& includeStack, const QString& path);
+    };
+}
+
+#endif // SHADERIDE_GL_GLSLPREPROCESSOR_HPP
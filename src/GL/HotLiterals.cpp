@@ -0,0 +1,342 @@
+/**
+ * HotLiterals Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <QRegularExpression>
+#include <QStringList>
+#include "HotLiterals.hpp"
+#include "GLSLPreprocessor.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    const QRegularExpression DECLARATION_ANCHOR_PATTERN(R"(^\s*#\s*(version|extension)\b)");
+
+    bool IsIdentifierStart(const QChar& c)
+    {
+        return c.isLetter() || c == '_';
+    }
+
+    bool IsIdentifierPart(const QChar& c)
+    {
+        return c.isLetterOrNumber() || c == '_';
+    }
+
+    // Skips a directive including line continuations, returns the position of its newline.
+    int SkipDirective(const QString& source, int i)
+    {
+        while (i < source.size() && source.at(i) != '\n')
+        {
+            if (source.at(i) == '\\' && i + 1 < source.size() && source.at(i + 1) == '\n') {
+                i++;
+            }
+
+            i++;
+        }
+
+        return i;
+    }
+
+    int NumberEnd(const QString& source, int i)
+    {
+        const bool hex = source.mid(i, 2).compare("0x", Qt::CaseInsensitive) == 0;
+
+        while (i < source.size())
+        {
+            const auto c = source.at(i);
+            const bool sign = (c == '+' || c == '-') && !hex && i > 0
+                              && (source.at(i - 1) == 'e' || source.at(i - 1) == 'E');
+
+            if (!IsIdentifierPart(c) && c != '.' && !sign) {
+                break;
+            }
+
+            i++;
+        }
+
+        return i;
+    }
+
+    bool ParseFloat(const QString& token, HotLiteral& literal)
+    {
+        if (token.startsWith("0x", Qt::CaseInsensitive)) {
+            return false;
+        }
+
+        // Doubles keep their literal, the array is float.
+        if (token.endsWith("lf", Qt::CaseInsensitive)) {
+            return false;
+        }
+
+        auto number = token;
+        literal.suffix = number.endsWith('f') || number.endsWith('F');
+
+        if (literal.suffix) {
+            number.chop(1);
+        }
+
+        const auto exponent = number.indexOf(QRegularExpression("[eE]"));
+        const auto dot = number.indexOf('.');
+
+        if (dot == -1 && exponent == -1) {
+            return false;
+        }
+
+        bool ok = false;
+        literal.value = number.toFloat(&ok);
+
+        if (dot != -1) {
+            literal.decimals = static_cast<int>((exponent == -1 ? number.size() : exponent) - dot - 1);
+        }
+
+        return ok;
+    }
+}
+
+HotLiteralList HotLiterals::Find(const QString& source)
+{
+    HotLiteralList literals;
+
+    int depth = 0;
+    bool constStatement = false;
+    bool lineStart = true;
+    int i = 0;
+
+    while (i < source.size() && literals.size() < MAX_LITERALS)
+    {
+        const auto c = source.at(i);
+        const auto next = i + 1 < source.size() ? source.at(i + 1) : QChar();
+
+        if (c == '\n')
+        {
+            lineStart = true;
+            i++;
+            continue;
+        }
+
+        if (c.isSpace())
+        {
+            i++;
+            continue;
+        }
+
+        // Comments
+        if (c == '/' && next == '/')
+        {
+            i = source.indexOf('\n', i);
+            i = i == -1 ? static_cast<int>(source.size()) : i;
+            continue;
+        }
+
+        if (c == '/' && next == '*')
+        {
+            i = source.indexOf("*/", i + 2);
+            i = i == -1 ? static_cast<int>(source.size()) : i + 2;
+            continue;
+        }
+
+        // Directives
+        if (c == '#' && lineStart)
+        {
+            i = SkipDirective(source, i);
+            continue;
+        }
+
+        lineStart = false;
+
+        if (IsIdentifierStart(c))
+        {
+            const auto start = i;
+
+            while (i < source.size() && IsIdentifierPart(source.at(i))) {
+                i++;
+            }
+
+            if (source.mid(start, i - start) == "const") {
+                constStatement = true;
+            }
+
+            continue;
+        }
+
+        if (c.isDigit() || (c == '.' && next.isDigit()))
+        {
+            const auto start = i;
+            i = NumberEnd(source, i);
+
+            HotLiteral literal;
+            literal.position = start;
+            literal.length = i - start;
+
+            if (depth > 0 && !constStatement && ParseFloat(source.mid(start, i - start), literal)) {
+                literals << literal;
+            }
+
+            continue;
+        }
+
+        if (c == '{')
+        {
+            depth++;
+            constStatement = false;
+
+        } else if (c == '}') {
+            depth = std::max(0, depth - 1);
+            constStatement = false;
+
+        } else if (c == ';') {
+            constStatement = false;
+        }
+
+        i++;
+    }
+
+    return literals;
+}
+
+QString HotLiterals::Inject(const QString& source, const HotLiteralList& literals, const QString& uniformName)
+{
+    if (literals.isEmpty()) {
+        return source;
+    }
+
+    auto injected = source;
+
+    // Back to front, so the positions stay valid.
+    for (auto i = literals.size() - 1; i >= 0; i--)
+    {
+        const auto& literal = literals.at(i);
+        injected.replace(literal.position, literal.length, QString("%1[%2]").arg(uniformName).arg(i));
+    }
+
+    auto lines = injected.split('\n');
+    int insertAt = 0;
+
+    for (int i = 0; i < lines.size(); i++)
+    {
+        if (DECLARATION_ANCHOR_PATTERN.match(lines.at(i)).hasMatch()) {
+            insertAt = i + 1;
+        }
+    }
+
+    lines.insert(insertAt, QString("uniform float %1[%2];").arg(uniformName).arg(literals.size()));
+    lines.insert(insertAt + 1, QString("#line %1 %2").arg(insertAt + 1).arg(GLSLPreprocessor::MAIN_SOURCE_INDEX));
+
+    return lines.join('\n');
+}
+
+std::vector<float> HotLiterals::Values(const HotLiteralList& literals)
+{
+    std::vector<float> values;
+    values.reserve(literals.size());
+
+    for (const auto& literal : literals) {
+        values.push_back(literal.value);
+    }
+
+    return values;
+}
+
+QString HotLiterals::UniformName(const ShaderType& shaderType)
+{
+    // Stages have their own array, linked programs share the namespace.
+    if (shaderType == ShaderType::VertexShader) {
+        return QString(UNIFORM_PREFIX) + "VS";
+
+    } else if (shaderType == ShaderType::ComputeShader) {
+        return QString(UNIFORM_PREFIX) + "CS";
+    }
+
+    return QString(UNIFORM_PREFIX) + "FS";
+}
+
+int HotLiterals::IndexAt(const HotLiteralList& literals, int position)
+{
+    for (int i = 0; i < literals.size(); i++)
+    {
+        const auto& literal = literals.at(i);
+
+        if (position >= literal.position && position <= literal.position + literal.length) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+HotLiteralEdit HotLiterals::Bake(const QString& source, const HotLiteral& literal, float value)
+{
+    HotLiteralEdit edit;
+    edit.position = literal.position;
+    edit.length = literal.length;
+
+    if (value >= 0.0f)
+    {
+        edit.text = Format(literal, value);
+        return edit;
+    }
+
+    const auto magnitude = Format(literal, -value);
+    const auto previous = literal.position > 0 ? source.at(literal.position - 1) : QChar();
+
+    if (previous == '-')
+    {
+        // -(-x) is written as +x.
+        edit.position--;
+        edit.length++;
+        edit.text = "+" + magnitude;
+        return edit;
+    }
+
+    // "a - -x" would be read as decrement.
+    auto before = literal.position - 1;
+
+    while (before >= 0 && source.at(before).isSpace()) {
+        before--;
+    }
+
+    const bool afterSign = before >= 0 && (source.at(before) == '-' || source.at(before) == '+');
+    edit.text = afterSign ? "(-" + magnitude + ")" : "-" + magnitude;
+
+    return edit;
+}
+
+QString HotLiterals::Format(const HotLiteral& literal, float value)
+{
+    // At least the precision of the source, scrubbing adds decimals.
+    const auto decimals = std::max(literal.decimals, 3);
+    auto text = QString::number(static_cast<double>(value), 'f', decimals);
+
+    while (text.endsWith('0') && text.indexOf('.') < text.size() - 2) {
+        text.chop(1);
+    }
+
+    return literal.suffix ? text + "f" : text;
+}
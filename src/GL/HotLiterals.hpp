@@ -0,0 +1,87 @@
+/**
+ * HotLiterals Class
+ *
+ * Rewrites the float literals of function bodies into a uniform
+ * array, so they can be changed without recompiling the shader.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_HOTLITERALS_HPP
+#define SHADERIDE_GL_HOTLITERALS_HPP
+
+#include <vector>
+#include <QList>
+#include <QString>
+#include "src/GL/Shader.hpp"
+
+namespace ShaderIDE::GL {
+
+    struct HotLiteral
+    {
+        int position{ 0 }; // Offset in the source
+        int length{ 0 };
+        float value{ 0.0f }; // Unsigned, a leading minus is an operator
+        int decimals{ 0 };
+        bool suffix{ false }; // "f" / "F"
+    };
+
+    using HotLiteralList = QList<HotLiteral>;
+
+    struct HotLiteralEdit
+    {
+        int position{ 0 };
+        int length{ 0 };
+        QString text{ "" };
+    };
+
+    class HotLiterals
+    {
+    public:
+        // Stays below the minimum uniform components of a stage.
+        static constexpr int MAX_LITERALS = 256;
+        static constexpr const char* UNIFORM_PREFIX = "_hotLiterals";
+
+        // Float literals inside of functions, except for const declarations,
+        // directives and comments (globals need constant initializers).
+        static HotLiteralList Find(const QString& source);
+
+        // Replaces the literals by uniform array elements, the declaration is
+        // inserted after #version / #extension and line numbers are kept.
+        static QString Inject(const QString& source, const HotLiteralList& literals, const QString& uniformName);
+
+        static std::vector<float> Values(const HotLiteralList& literals);
+        static QString UniformName(const ShaderType& shaderType);
+
+        // Literal at a source offset, -1 if there is none.
+        static int IndexAt(const HotLiteralList& literals, int position);
+
+        // Text replacing a literal with a new (possibly negative) value.
+        static HotLiteralEdit Bake(const QString& source, const HotLiteral& literal, float value);
+        static QString Format(const HotLiteral& literal, float value);
+    };
+}
+
+#endif // SHADERIDE_GL_HOTLITERALS_HPP
@@ -0,0 +1,225 @@
+/**
+ * PermutationCompiler Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <QMetaObject>
+#include "PermutationCompiler.hpp"
+#include "src/Core/Memory.hpp"
+
+using namespace ShaderIDE::GL;
+
+PermutationCompiler::PermutationCompiler(const QSurfaceFormat& format)
+{
+    // Offscreen surfaces must be created on the GUI thread.
+    const auto workerCount = std::clamp(QThread::idealThreadCount() / 2, 1, MAX_WORKERS);
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        auto* surface = new QOffscreenSurface();
+        surface->setFormat(format);
+        surface->create();
+        workerSurfaces.push_back(surface);
+    }
+}
+
+PermutationCompiler::~PermutationCompiler()
+{
+    for (auto& thread : workerThreads)
+    {
+        thread->quit();
+        thread->wait();
+    }
+
+    for (auto* worker : workers) {
+        Memory::Release(worker);
+    }
+
+    for (auto* surface : workerSurfaces) {
+        Memory::Release(surface);
+    }
+}
+
+void PermutationCompiler::Init(QOpenGLContext* renderContext)
+{
+    initializeOpenGLFunctions();
+
+    for (auto* surface : workerSurfaces)
+    {
+        auto* workerContext = new QOpenGLContext();
+        workerContext->setShareContext(renderContext);
+        workerContext->setFormat(renderContext->format());
+
+        // Compiled on the render thread, if no shared context is available.
+        if (!surface->isValid() || !workerContext->create())
+        {
+            Memory::Release(workerContext);
+            break;
+        }
+
+        auto thread = std::make_unique<QThread>();
+        auto* worker = new ProgramCompilerWorker(workerContext, surface);
+        workerContext->moveToThread(thread.get());
+        worker->moveToThread(thread.get());
+        thread->start();
+
+        workers.push_back(worker);
+        workerThreads.push_back(std::move(thread));
+    }
+}
+
+void PermutationCompiler::Release()
+{
+    Cancel();
+
+    for (auto* worker : workers)
+    {
+        QMetaObject::invokeMethod(worker, "OnShutdown", Qt::BlockingQueuedConnection);
+
+        // Finished programs, which were never picked up.
+        for (const auto& entry : worker->TakeResults()) {
+            DeletePrograms(entry.second);
+        }
+    }
+
+    for (auto& thread : workerThreads)
+    {
+        thread->quit();
+        thread->wait();
+    }
+}
+
+void PermutationCompiler::Compile(const ProgramRequests& requests)
+{
+    Cancel();
+
+    if (requests.isEmpty()) {
+        return;
+    }
+
+    pending = true;
+
+    if (workers.empty())
+    {
+        for (const auto& request : requests) {
+            collectedResults << ProgramBuild(request).Finish();
+        }
+
+        return;
+    }
+
+    // Round robin, so expensive neighbouring variants are spread over the workers.
+    std::vector<ProgramRequests> batches(workers.size());
+
+    for (int i = 0; i < requests.size(); i++) {
+        batches.at(static_cast<size_t>(i) % workers.size()) << requests.at(i);
+    }
+
+    const auto id = buildID;
+
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        if (batches.at(i).isEmpty()) {
+            continue;
+        }
+
+        auto* compilerWorker = workers.at(i);
+        const auto batch = batches.at(i);
+
+        QMetaObject::invokeMethod(compilerWorker, [compilerWorker, id, batch]() {
+            compilerWorker->Build(id, batch);
+        }, Qt::QueuedConnection);
+
+        pendingBatches++;
+    }
+}
+
+void PermutationCompiler::Cancel()
+{
+    // Worker results of the previous build are dropped, see CollectWorkerResults().
+    buildID++;
+    pending = false;
+    pendingBatches = 0;
+
+    DeletePrograms(collectedResults);
+    collectedResults.clear();
+}
+
+bool PermutationCompiler::Poll(ProgramCompileResults& results)
+{
+    // Worker results are collected in any case, to release dropped programs.
+    CollectWorkerResults();
+
+    if (!pending || pendingBatches > 0) {
+        return false;
+    }
+
+    std::sort(collectedResults.begin(), collectedResults.end(), [](const auto& a, const auto& b) {
+        return a.key < b.key;
+    });
+
+    results = collectedResults;
+    collectedResults.clear();
+    pending = false;
+
+    return true;
+}
+
+bool PermutationCompiler::Pending() const
+{
+    return pending;
+}
+
+int PermutationCompiler::Workers() const
+{
+    return static_cast<int>(workers.size());
+}
+
+void PermutationCompiler::CollectWorkerResults()
+{
+    for (auto* worker : workers)
+    {
+        for (const auto& [id, workerResults] : worker->TakeResults())
+        {
+            if (!pending || id != buildID)
+            {
+                DeletePrograms(workerResults);
+                continue;
+            }
+
+            collectedResults << workerResults;
+            pendingBatches--;
+        }
+    }
+}
+
+void PermutationCompiler::DeletePrograms(const ProgramCompileResults& results)
+{
+    for (const auto& result : results) {
+        glDeleteProgram(result.program);
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * PermutationCompiler Class
+ *
+ * Compiles large batches of programs (i.e. shader permutations)
+ * in parallel on a pool of worker threads with shared contexts.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_PERMUTATIONCOMPILER_HPP
+#define SHADERIDE_GL_PERMUTATIONCOMPILER_HPP
+
+#include <memory>
+#include <vector>
+#include <QThread>
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "ProgramCompiler.hpp"
+
+namespace ShaderIDE::GL {
+
+    class PermutationCompiler : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr int MAX_WORKERS = 4;
+
+    public:
+        explicit PermutationCompiler(const QSurfaceFormat& format);
+        ~PermutationCompiler();
+
+        // Render Thread
+        void Init(QOpenGLContext* renderContext);
+        void Release();
+
+        // Results are ordered like the requests.
+        void Compile(const ProgramRequests& requests);
+        void Cancel();
+
+        bool Poll(ProgramCompileResults& results);
+        bool Pending() const;
+        int Workers() const;
+
+    private:
+        uint64_t buildID{ 0 };
+        bool pending{ false };
+        int pendingBatches{ 0 };
+        ProgramCompileResults collectedResults;
+
+        // Workers (Shared Contexts)
+        std::vector<std::unique_ptr<QThread>> workerThreads;
+        std::vector<QOffscreenSurface*> workerSurfaces;
+        std::vector<ProgramCompilerWorker*> workers;
+
+        void CollectWorkerResults();
+        void DeletePrograms(const ProgramCompileResults& results);
+    };
+}
+
+#endif // SHADERIDE_GL_PERMUTATIONCOMPILER_HPP
@@ -0,0 +1,291 @@
+/**
+ * ProgramBinaryCache Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QDateTime>
+#include <QDataStream>
+#include <QStandardPaths>
+#include "ProgramBinaryCache.hpp"
+#include "GLSLFingerprint.hpp"
+#include "src/Core/Hash.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+void ProgramBinaryCache::Init()
+{
+    initializeOpenGLFunctions();
+
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    enabled = numFormats > 0;
+
+    // Binaries are only valid for the driver they were created with.
+    driverHash = Hash()
+            .Add(QString(reinterpret_cast<const char*>(glGetString(GL_VENDOR))))
+            .Add(QString(reinterpret_cast<const char*>(glGetString(GL_RENDERER))))
+            .Add(QString(reinterpret_cast<const char*>(glGetString(GL_VERSION))))
+            .Value();
+
+    directory = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + DIRECTORY_NAME;
+    QDir().mkpath(directory);
+
+    PruneDirectory();
+}
+
+bool ProgramBinaryCache::Enabled() const
+{
+    return enabled;
+}
+
+uint64_t ProgramBinaryCache::Key(const QString& vertexShaderSource,
+                                 const QString& fragmentShaderSource) const
+{
+    // Comments and whitespace do not change the binary.
+    return Hash()
+            .Add(driverHash)
+            .Add(GLSLFingerprint::Compute(vertexShaderSource))
+            .Add(GLSLFingerprint::Compute(fragmentShaderSource))
+            .Value();
+}
+
+uint64_t ProgramBinaryCache::StageKey(const ShaderType& shaderType,
+                                      const QString& source) const
+{
+    // The stage keeps vertex and fragment programs of equal sources apart.
+    return Hash()
+            .Add(driverHash)
+            .Add(static_cast<uint64_t>(shaderType))
+            .Add(GLSLFingerprint::Compute(source))
+            .Value();
+}
+
+GLuint ProgramBinaryCache::Load(uint64_t key, qint64& compileTime, bool separable)
+{
+    if (!enabled) {
+        return 0;
+    }
+
+    requests++;
+
+    Entry entry;
+
+    if (memoryCache.contains(key)) {
+        entry = *memoryCache.object(key);
+
+    } else if (!ReadFile(key, entry)) {
+        return 0;
+    }
+
+    auto program = CreateProgram(entry, separable);
+
+    // Rejected by the driver (i.e. after an update), the entry is outdated.
+    if (program == 0)
+    {
+        memoryCache.remove(key);
+        QFile::remove(FilePath(key));
+        return 0;
+    }
+
+    Insert(key, entry);
+
+    hits++;
+    savedTime += entry.compileTime;
+    compileTime = entry.compileTime;
+
+    return program;
+}
+
+void ProgramBinaryCache::Store(uint64_t key, GLuint program, qint64 compileTime)
+{
+    if (!enabled) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (length <= 0) {
+        return;
+    }
+
+    Entry entry;
+    entry.binary.resize(length);
+    entry.compileTime = compileTime;
+
+    glGetProgramBinary(program, length, nullptr, &entry.format, entry.binary.data());
+
+    Insert(key, entry);
+    WriteFile(key, entry);
+}
+
+int ProgramBinaryCache::Hits() const
+{
+    return hits;
+}
+
+int ProgramBinaryCache::Requests() const
+{
+    return requests;
+}
+
+qint64 ProgramBinaryCache::SavedTime() const
+{
+    return savedTime;
+}
+
+int ProgramBinaryCache::PrunedFiles() const
+{
+    return prunedFiles;
+}
+
+qint64 ProgramBinaryCache::PrunedSize() const
+{
+    return prunedSize;
+}
+
+void ProgramBinaryCache::PruneDirectory()
+{
+    // Most recently used first, loaded files are touched in ReadFile.
+    auto files = QDir(directory).entryInfoList(QStringList() << "*.bin", QDir::Files);
+
+    std::sort(files.begin(), files.end(), [](const QFileInfo& a, const QFileInfo& b) {
+        return a.lastModified() > b.lastModified();
+    });
+
+    qint64 size = 0;
+
+    for (const auto& file : files)
+    {
+        size += file.size();
+
+        if (size > DISK_CAPACITY && QFile::remove(file.absoluteFilePath()))
+        {
+            prunedFiles++;
+            prunedSize += file.size();
+        }
+    }
+}
+
+QString ProgramBinaryCache::FilePath(uint64_t key) const
+{
+    return directory + "/" + QString::number(key, 16) + ".bin";
+}
+
+bool ProgramBinaryCache::ReadFile(uint64_t key, Entry& entry) const
+{
+    QFile file(FilePath(key));
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint64 fileKey = 0;
+    quint32 format = 0;
+    qint64 compileTime = 0;
+    quint64 checksum = 0;
+    QByteArray binary;
+
+    stream >> magic >> version >> fileKey >> format >> compileTime >> checksum >> binary;
+
+    // Validate, damaged or foreign files are ignored.
+    if (stream.status() != QDataStream::Ok
+        || magic != FILE_MAGIC
+        || version != FILE_VERSION
+        || fileKey != key
+        || binary.isEmpty()
+        || checksum != Hash().Add(binary.constData(), binary.size()).Value())
+    {
+        return false;
+    }
+
+    entry.format = format;
+    entry.binary = binary;
+    entry.compileTime = compileTime;
+
+    // Keeps used binaries from being pruned.
+    file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+
+    return true;
+}
+
+void ProgramBinaryCache::WriteFile(uint64_t key, const Entry& entry) const
+{
+    QSaveFile file(FilePath(key));
+
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+
+    stream << FILE_MAGIC
+           << FILE_VERSION
+           << static_cast<quint64>(key)
+           << static_cast<quint32>(entry.format)
+           << static_cast<qint64>(entry.compileTime)
+           << static_cast<quint64>(Hash().Add(entry.binary.constData(), entry.binary.size()).Value())
+           << entry.binary;
+
+    file.commit();
+}
+
+GLuint ProgramBinaryCache::CreateProgram(const Entry& entry, bool separable)
+{
+    auto program = glCreateProgram();
+
+    if (separable) {
+        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    }
+
+    glProgramBinary(program, entry.format, entry.binary.constData(), static_cast<GLsizei>(entry.binary.size()));
+
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (!success)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+void ProgramBinaryCache::Insert(uint64_t key, const Entry& entry)
+{
+    const auto cost = qMax(1, static_cast<int>(entry.binary.size() / 1024));
+    memoryCache.insert(key, new Entry(entry), cost);
+}
@@ -0,0 +1,102 @@
+/**
+ * ProgramBinaryCache Class
+ *
+ * Caches linked shader programs as program binaries in memory and on disk.
+ * Entries are keyed by the normalized shader sources and the driver.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_PROGRAMBINARYCACHE_HPP
+#define SHADERIDE_GL_PROGRAMBINARYCACHE_HPP
+
+#include <cstdint>
+#include <QCache>
+#include <QString>
+#include <QByteArray>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "Shader.hpp"
+
+namespace ShaderIDE::GL {
+
+    class ProgramBinaryCache : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr int MEMORY_CAPACITY = 64 * 1024; // Kilobytes
+        static constexpr qint64 DISK_CAPACITY = 256 * 1024 * 1024; // Bytes
+        static constexpr quint32 FILE_MAGIC = 0x53494442; // "SIDB"
+        static constexpr quint32 FILE_VERSION = 1;
+        static constexpr const char* DIRECTORY_NAME = "/ShaderIDE/programs";
+
+        struct Entry
+        {
+            GLenum format{ 0 };
+            QByteArray binary;
+            qint64 compileTime{ 0 }; // Milliseconds
+        };
+
+    public:
+        // Render Thread
+        void Init();
+        bool Enabled() const;
+
+        uint64_t Key(const QString& vertexShaderSource,
+                     const QString& fragmentShaderSource) const;
+
+        // Separable single stage programs
+        uint64_t StageKey(const ShaderType& shaderType,
+                          const QString& source) const;
+
+        GLuint Load(uint64_t key, qint64& compileTime, bool separable = false);
+        void Store(uint64_t key, GLuint program, qint64 compileTime);
+
+        // Statistics
+        int Hits() const;
+        int Requests() const;
+        qint64 SavedTime() const;
+        int PrunedFiles() const;
+        qint64 PrunedSize() const;
+
+    private:
+        bool enabled{ false };
+        uint64_t driverHash{ 0 };
+        QString directory{ "" };
+        QCache<uint64_t, Entry> memoryCache{ MEMORY_CAPACITY };
+
+        int hits{ 0 };
+        int requests{ 0 };
+        qint64 savedTime{ 0 };
+        int prunedFiles{ 0 };
+        qint64 prunedSize{ 0 };
+
+        void PruneDirectory();
+        QString FilePath(uint64_t key) const;
+        bool ReadFile(uint64_t key, Entry& entry) const;
+        void WriteFile(uint64_t key, const Entry& entry) const;
+        GLuint CreateProgram(const Entry& entry, bool separable);
+        void Insert(uint64_t key, const Entry& entry);
+    };
+}
+
+#endif // SHADERIDE_GL_PROGRAMBINARYCACHE_HPP
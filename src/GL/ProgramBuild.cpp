@@ -0,0 +1,152 @@
+/**
+ * ProgramBuild Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include "ProgramBuild.hpp"
+#include "src/Core/SyntaxErrorException.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    QString StageName(const ShaderType& shaderType)
+    {
+        return Shader::ShaderTypeToString(shaderType).replace(" Shader", " shader");
+    }
+}
+
+ProgramBuild::ProgramBuild(const ProgramRequest& request)
+        : request(request)
+{
+    initializeOpenGLFunctions();
+    compileTimer.start();
+
+    for (const auto& [shaderType, source] : request.sources)
+    {
+        auto shader = Shader::MakeShared(source, shaderType);
+        shader->BeginCompile();
+        shaders << shader;
+    }
+
+    // Linking is issued right away, so the driver can
+    // continue without waiting for the compile results.
+    program = glCreateProgram();
+
+    for (const auto& shader : shaders) {
+        glAttachShader(program, shader->Handle());
+    }
+
+    if (request.separable) {
+        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    }
+
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+}
+
+ProgramBuild::~ProgramBuild()
+{
+    // Programs handed out by Finish() are not deleted.
+    glDeleteProgram(program);
+}
+
+bool ProgramBuild::Completed()
+{
+    GLint completed = GL_FALSE;
+    glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+    return completed == GL_TRUE;
+}
+
+ProgramCompileResult ProgramBuild::Finish()
+{
+    ProgramCompileResult result;
+    result.separable = request.separable;
+    result.key = request.key;
+
+    // Shaders
+    for (int i = 0; i < shaders.size(); i++)
+    {
+        const auto shaderType = request.sources.at(i).first;
+        result.stages << shaderType;
+
+        try
+        {
+            shaders.at(i)->EndCompile();
+            result.messages << StageName(shaderType) + " compilation finished without errors.";
+
+        }
+        catch (SyntaxErrorException& e)
+        {
+            result.errorType = shaderType;
+            result.error = e.what();
+            return result;
+        }
+    }
+
+    // Program
+    QElapsedTimer linkTimer;
+    linkTimer.start();
+
+    try
+    {
+        CheckLinkStatus();
+
+    }
+    catch (SyntaxErrorException& e)
+    {
+        result.errorType = result.stages.isEmpty() ? ShaderType::FragmentShader : result.stages.last();
+        result.error = e.what();
+        return result;
+    }
+
+    // Linked programs do not depend on their shader objects anymore.
+    for (const auto& shader : shaders) {
+        glDetachShader(program, shader->Handle());
+    }
+
+    result.success = true;
+    result.program = program;
+    result.compileTime = compileTimer.elapsed();
+    result.linkTime = linkTimer.elapsed();
+    program = 0;
+
+    return result;
+}
+
+void ProgramBuild::CheckLinkStatus()
+{
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (!success)
+    {
+        std::array<char, INFOLOG_BUFFER_SIZE> infoLog{};
+        glGetProgramInfoLog(program, INFOLOG_BUFFER_SIZE, nullptr, infoLog.data());
+        throw SyntaxErrorException("Program", QString(infoLog.data()));
+    }
+}
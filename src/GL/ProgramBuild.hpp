@@ -0,0 +1,100 @@
+/**
+ * ProgramBuild Class
+ *
+ * Compiles and links a shader program, either from all stages or as a
+ * separable single stage program. The build is issued on construction and
+ * evaluated by Finish(), so drivers with parallel shader compilation work
+ * in the background.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_PROGRAMBUILD_HPP
+#define SHADERIDE_GL_PROGRAMBUILD_HPP
+
+#include <cstdint>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QElapsedTimer>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "Shader.hpp"
+
+// GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace ShaderIDE::GL {
+
+    using ShaderSources = QList<QPair<ShaderType, QString>>;
+
+    struct ProgramRequest
+    {
+        ShaderSources sources;
+        bool separable{ false }; // Single stage programs for pipelines.
+        uint64_t key{ 0 }; // Program cache key, passed through to the result.
+    };
+
+    struct ProgramCompileResult
+    {
+        bool success{ false };
+        GLuint program{ 0 }; // Owned by the receiver, if successful.
+        bool separable{ false };
+        QList<ShaderType> stages;
+        uint64_t key{ 0 };
+        qint64 compileTime{ 0 }; // Milliseconds
+        qint64 linkTime{ 0 }; // Milliseconds, waited for the link status after compiling.
+        QStringList messages;
+        ShaderType errorType{ ShaderType::FragmentShader };
+        QString error{ "" };
+    };
+
+    using ProgramRequests = QList<ProgramRequest>;
+    using ProgramCompileResults = QList<ProgramCompileResult>;
+
+    class ProgramBuild : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr size_t INFOLOG_BUFFER_SIZE = 1024;
+
+    public:
+        explicit ProgramBuild(const ProgramRequest& request);
+        ~ProgramBuild();
+
+        bool Completed();
+        ProgramCompileResult Finish();
+
+    private:
+        ProgramRequest request;
+        QList<ShaderSPtr> shaders;
+        GLuint program{ 0 };
+        QElapsedTimer compileTimer;
+
+        void CheckLinkStatus();
+    };
+}
+
+#endif // SHADERIDE_GL_PROGRAMBUILD_HPP
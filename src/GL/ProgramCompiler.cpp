@@ -0,0 +1,308 @@
+/**
+ * ProgramCompiler Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QMetaObject>
+#include <QMutexLocker>
+#include "ProgramCompiler.hpp"
+#include "src/Core/Memory.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    using MaxShaderCompilerThreadsProc = void (QOPENGLF_APIENTRYP)(GLuint count);
+
+    // Let the driver decide about the number of compiler threads.
+    constexpr GLuint MAX_SHADER_COMPILER_THREADS_DEFAULT = 0xFFFFFFFF;
+}
+
+ProgramCompilerWorker::ProgramCompilerWorker(QOpenGLContext* context, QOffscreenSurface* surface)
+        : QObject(),
+          context(context),
+          surface(surface)
+{}
+
+void ProgramCompilerWorker::Build(uint64_t id, const ProgramRequests& requests)
+{
+    if (!initialized)
+    {
+        context->makeCurrent(surface);
+        initializeOpenGLFunctions();
+        initialized = true;
+    }
+
+    ProgramCompileResults buildResults;
+
+    for (const auto& request : requests) {
+        buildResults << ProgramBuild(request).Finish();
+    }
+
+    // The programs are used by the render context afterwards.
+    glFinish();
+
+    QMutexLocker locker(&resultMutex);
+    results.emplace_back(id, buildResults);
+}
+
+std::deque<std::pair<uint64_t, ProgramCompileResults>> ProgramCompilerWorker::TakeResults()
+{
+    QMutexLocker locker(&resultMutex);
+
+    std::deque<std::pair<uint64_t, ProgramCompileResults>> takenResults;
+    takenResults.swap(results);
+
+    return takenResults;
+}
+
+void ProgramCompilerWorker::OnShutdown()
+{
+    if (initialized) {
+        context->doneCurrent();
+    }
+
+    // The context belongs to the worker thread.
+    Memory::Release(context);
+    context = nullptr;
+    initialized = false;
+}
+
+ProgramCompiler::ProgramCompiler(const QSurfaceFormat& format)
+{
+    // Offscreen surfaces must be created on the GUI thread,
+    // it's only used, if parallel shader compilation is unavailable.
+    workerSurface = new QOffscreenSurface();
+    workerSurface->setFormat(format);
+    workerSurface->create();
+}
+
+ProgramCompiler::~ProgramCompiler()
+{
+    workerThread.quit();
+    workerThread.wait();
+
+    Memory::Release(worker);
+    Memory::Release(workerSurface);
+}
+
+void ProgramCompiler::Init(QOpenGLContext* renderContext)
+{
+    initializeOpenGLFunctions();
+
+    if (renderContext->hasExtension("GL_KHR_parallel_shader_compile")
+        || renderContext->hasExtension("GL_ARB_parallel_shader_compile"))
+    {
+        InitParallel(renderContext);
+        return;
+    }
+
+    InitWorker(renderContext);
+}
+
+void ProgramCompiler::Release()
+{
+    Cancel();
+
+    if (worker != nullptr)
+    {
+        QMetaObject::invokeMethod(worker, "OnShutdown", Qt::BlockingQueuedConnection);
+
+        // Finished programs, which were never picked up.
+        for (const auto& entry : worker->TakeResults()) {
+            DeletePrograms(entry.second);
+        }
+    }
+
+    workerThread.quit();
+    workerThread.wait();
+}
+
+void ProgramCompiler::Compile(const ProgramRequests& requests)
+{
+    // A new build replaces the pending one, its results are dropped.
+    Cancel();
+    pending = true;
+
+    switch (mode)
+    {
+        case MODE::PARALLEL:
+            for (const auto& request : requests) {
+                parallelBuilds.push_back(std::make_unique<ProgramBuild>(request));
+            }
+
+            break;
+
+        case MODE::WORKER:
+        {
+            const auto id = buildID;
+            auto* compilerWorker = worker;
+
+            QMetaObject::invokeMethod(worker, [compilerWorker, id, requests]() {
+                compilerWorker->Build(id, requests);
+            }, Qt::QueuedConnection);
+
+            break;
+        }
+
+        case MODE::SYNCHRONOUS:
+            for (const auto& request : requests) {
+                synchronousResults << ProgramBuild(request).Finish();
+            }
+
+            break;
+    }
+}
+
+void ProgramCompiler::Cancel()
+{
+    // Worker results of the previous build are dropped, see PollWorker().
+    buildID++;
+    pending = false;
+
+    parallelBuilds.clear();
+
+    DeletePrograms(synchronousResults);
+    synchronousResults.clear();
+}
+
+bool ProgramCompiler::Poll(ProgramCompileResults& results)
+{
+    // Worker results are collected in any case, to release replaced programs.
+    if (mode == MODE::WORKER) {
+        return PollWorker(results);
+    }
+
+    if (!pending) {
+        return false;
+    }
+
+    if (mode == MODE::PARALLEL)
+    {
+        for (auto& build : parallelBuilds)
+        {
+            if (!build->Completed()) {
+                return false;
+            }
+        }
+
+        results.clear();
+
+        for (auto& build : parallelBuilds) {
+            results << build->Finish();
+        }
+
+        parallelBuilds.clear();
+
+    } else {
+        results = synchronousResults;
+        synchronousResults.clear();
+    }
+
+    pending = false;
+    return true;
+}
+
+bool ProgramCompiler::Pending() const
+{
+    return pending;
+}
+
+ProgramCompiler::MODE ProgramCompiler::Mode() const
+{
+    return mode;
+}
+
+void ProgramCompiler::InitParallel(QOpenGLContext* renderContext)
+{
+    auto maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(
+            renderContext->getProcAddress("glMaxShaderCompilerThreadsKHR"));
+
+    if (maxShaderCompilerThreads == nullptr)
+    {
+        maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(
+                renderContext->getProcAddress("glMaxShaderCompilerThreadsARB"));
+    }
+
+    if (maxShaderCompilerThreads != nullptr) {
+        maxShaderCompilerThreads(MAX_SHADER_COMPILER_THREADS_DEFAULT);
+    }
+
+    mode = MODE::PARALLEL;
+}
+
+void ProgramCompiler::InitWorker(QOpenGLContext* renderContext)
+{
+    auto* workerContext = new QOpenGLContext();
+    workerContext->setShareContext(renderContext);
+    workerContext->setFormat(renderContext->format());
+
+    // Compile on the render thread, if no shared context is available.
+    if (!workerSurface->isValid() || !workerContext->create())
+    {
+        Memory::Release(workerContext);
+        mode = MODE::SYNCHRONOUS;
+        return;
+    }
+
+    worker = new ProgramCompilerWorker(workerContext, workerSurface);
+    workerContext->moveToThread(&workerThread);
+    worker->moveToThread(&workerThread);
+    workerThread.start();
+
+    mode = MODE::WORKER;
+}
+
+bool ProgramCompiler::PollWorker(ProgramCompileResults& results)
+{
+    bool found = false;
+
+    for (const auto& [id, workerResults] : worker->TakeResults())
+    {
+        // Results of replaced builds are not used anymore.
+        if (!pending || id != buildID)
+        {
+            DeletePrograms(workerResults);
+            continue;
+        }
+
+        results = workerResults;
+        found = true;
+    }
+
+    if (found) {
+        pending = false;
+    }
+
+    return found;
+}
+
+void ProgramCompiler::DeletePrograms(const ProgramCompileResults& results)
+{
+    for (const auto& result : results) {
+        glDeleteProgram(result.program);
+    }
+}
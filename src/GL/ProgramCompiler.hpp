@@ -0,0 +1,122 @@
+/**
+ * ProgramCompiler Class
+ *
+ * Builds shader programs without blocking the render thread. Drivers with
+ * GL_KHR_parallel_shader_compile compile in the background and are polled,
+ * otherwise programs are built by a worker thread with a shared context.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_PROGRAMCOMPILER_HPP
+#define SHADERIDE_GL_PROGRAMCOMPILER_HPP
+
+#include <memory>
+#include <deque>
+#include <vector>
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "ProgramBuild.hpp"
+
+namespace ShaderIDE::GL {
+
+    class ProgramCompilerWorker : public QObject, protected QOpenGLFunctions_4_5_Core
+    {
+        Q_OBJECT
+
+    public:
+        explicit ProgramCompilerWorker(QOpenGLContext* context, QOffscreenSurface* surface);
+
+        void Build(uint64_t id, const ProgramRequests& requests);
+
+        std::deque<std::pair<uint64_t, ProgramCompileResults>> TakeResults();
+
+    public slots:
+        void OnShutdown();
+
+    private:
+        QOpenGLContext* context{ nullptr };
+        QOffscreenSurface* surface{ nullptr }; // DO NOT DESTROY
+        bool initialized{ false };
+
+        QMutex resultMutex;
+        std::deque<std::pair<uint64_t, ProgramCompileResults>> results;
+    };
+
+    class ProgramCompiler : protected QOpenGLFunctions_4_5_Core
+    {
+    public:
+        enum class MODE
+        {
+            PARALLEL,
+            WORKER,
+            SYNCHRONOUS
+        };
+
+        explicit ProgramCompiler(const QSurfaceFormat& format);
+        ~ProgramCompiler();
+
+        // Render Thread
+        void Init(QOpenGLContext* renderContext);
+        void Release();
+
+        // All programs of a request batch are delivered together.
+        void Compile(const ProgramRequests& requests);
+        void Cancel();
+
+        bool Poll(ProgramCompileResults& results);
+        bool Pending() const;
+        MODE Mode() const;
+
+    private:
+        MODE mode{ MODE::SYNCHRONOUS };
+
+        uint64_t buildID{ 0 };
+        bool pending{ false };
+
+        // Parallel Shader Compile
+        std::vector<std::unique_ptr<ProgramBuild>> parallelBuilds;
+
+        // Synchronous Fallback
+        ProgramCompileResults synchronousResults;
+
+        // Worker (Shared Context)
+        QThread workerThread;
+        QOffscreenSurface* workerSurface{ nullptr };
+        ProgramCompilerWorker* worker{ nullptr };
+
+        void InitParallel(QOpenGLContext* renderContext);
+        void InitWorker(QOpenGLContext* renderContext);
+        bool PollWorker(ProgramCompileResults& results);
+
+        void DeletePrograms(const ProgramCompileResults& results);
+    };
+}
+
+#endif // SHADERIDE_GL_PROGRAMCOMPILER_HPP
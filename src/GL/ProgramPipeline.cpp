@@ -0,0 +1,239 @@
+/**
+ * ProgramPipeline Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ProgramPipeline.hpp"
+
+using namespace ShaderIDE::GL;
+
+void ProgramPipeline::Init()
+{
+    initializeOpenGLFunctions();
+}
+
+void ProgramPipeline::Release()
+{
+    for (auto& stage : stages)
+    {
+        glDeleteProgram(stage.program);
+        stage = Stage();
+    }
+
+    glDeleteProgramPipelines(1, &pipeline);
+    pipeline = 0;
+}
+
+bool ProgramPipeline::Complete() const
+{
+    return pipeline != 0;
+}
+
+void ProgramPipeline::Bind()
+{
+    // Ensure, that no monolithic program overrides the pipeline.
+    glUseProgram(0);
+    glBindProgramPipeline(pipeline);
+}
+
+GLuint ProgramPipeline::StageProgram(const ShaderType& shaderType) const
+{
+    return stages.at(StageIndex(shaderType)).program;
+}
+
+uint64_t ProgramPipeline::StageKey(const ShaderType& shaderType) const
+{
+    return stages.at(StageIndex(shaderType)).key;
+}
+
+qint64 ProgramPipeline::StageCompileTime(const ShaderType& shaderType) const
+{
+    return stages.at(StageIndex(shaderType)).compileTime;
+}
+
+QList<GLuint> ProgramPipeline::Programs() const
+{
+    QList<GLuint> programs;
+
+    for (const auto& stage : stages)
+    {
+        if (stage.program) {
+            programs << stage.program;
+        }
+    }
+
+    return programs;
+}
+
+QString ProgramPipeline::Replace(const ProgramCompileResults& results)
+{
+    // Start with the current stages and replace the rebuilt ones.
+    auto newStages = stages;
+
+    for (const auto& result : results)
+    {
+        for (const auto& shaderType : result.stages)
+        {
+            auto& stage = newStages.at(StageIndex(shaderType));
+            stage.program = result.program;
+            stage.key = result.key;
+            stage.compileTime = result.compileTime;
+        }
+    }
+
+    const auto vertexProgram = newStages.at(StageIndex(ShaderType::VertexShader)).program;
+    const auto fragmentProgram = newStages.at(StageIndex(ShaderType::FragmentShader)).program;
+
+    QString error = "";
+
+    if (!vertexProgram || !fragmentProgram) {
+        error = "Program pipeline is missing a shader stage.";
+    }
+
+    if (error.isEmpty()) {
+        error = CheckInterface(vertexProgram, fragmentProgram);
+    }
+
+    // Validate a new pipeline object, so the
+    // current one stays untouched on errors.
+    GLuint newPipeline = 0;
+
+    if (error.isEmpty())
+    {
+        glCreateProgramPipelines(1, &newPipeline);
+        glUseProgramStages(newPipeline, GL_VERTEX_SHADER_BIT, vertexProgram);
+        glUseProgramStages(newPipeline, GL_FRAGMENT_SHADER_BIT, fragmentProgram);
+        error = Validate(newPipeline);
+    }
+
+    if (!error.isEmpty())
+    {
+        glDeleteProgramPipelines(1, &newPipeline);
+
+        for (const auto& result : results) {
+            glDeleteProgram(result.program);
+        }
+
+        return error;
+    }
+
+    // Swap
+    for (int i = 0; i < static_cast<int>(stages.size()); i++)
+    {
+        if (stages.at(i).program != newStages.at(i).program) {
+            glDeleteProgram(stages.at(i).program);
+        }
+    }
+
+    glDeleteProgramPipelines(1, &pipeline);
+    pipeline = newPipeline;
+    stages = newStages;
+
+    return "";
+}
+
+int ProgramPipeline::StageIndex(const ShaderType& shaderType)
+{
+    return shaderType == ShaderType::VertexShader ? 0 : 1;
+}
+
+QString ProgramPipeline::TypeName(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT: return "float";
+        case GL_FLOAT_VEC2: return "vec2";
+        case GL_FLOAT_VEC3: return "vec3";
+        case GL_FLOAT_VEC4: return "vec4";
+        case GL_INT: return "int";
+        case GL_INT_VEC2: return "ivec2";
+        case GL_INT_VEC3: return "ivec3";
+        case GL_INT_VEC4: return "ivec4";
+        case GL_UNSIGNED_INT: return "uint";
+        case GL_FLOAT_MAT3: return "mat3";
+        case GL_FLOAT_MAT4: return "mat4";
+        default: return QString("0x%1").arg(type, 4, 16, QChar('0'));
+    }
+}
+
+QString ProgramPipeline::CheckInterface(GLuint vertexProgram, GLuint fragmentProgram)
+{
+    GLint numInputs = 0;
+    glGetProgramInterfaceiv(fragmentProgram, GL_PROGRAM_INPUT, GL_ACTIVE_RESOURCES, &numInputs);
+
+    QStringList errors;
+    const GLenum typeProperty = GL_TYPE;
+
+    for (GLint i = 0; i < numInputs; i++)
+    {
+        std::array<char, NAME_BUFFER_SIZE> name{};
+        glGetProgramResourceName(fragmentProgram, GL_PROGRAM_INPUT, i, NAME_BUFFER_SIZE, nullptr, name.data());
+
+        // Built-in inputs are provided by the fixed function stages.
+        if (QString(name.data()).startsWith("gl_")) {
+            continue;
+        }
+
+        GLint inputType = 0;
+        glGetProgramResourceiv(fragmentProgram, GL_PROGRAM_INPUT, i, 1, &typeProperty, 1, nullptr, &inputType);
+
+        const auto outputIndex = glGetProgramResourceIndex(vertexProgram, GL_PROGRAM_OUTPUT, name.data());
+
+        if (outputIndex == GL_INVALID_INDEX)
+        {
+            errors << QString("Fragment shader input '%1 %2' is not written by the vertex shader.")
+                    .arg(TypeName(inputType), name.data());
+            continue;
+        }
+
+        GLint outputType = 0;
+        glGetProgramResourceiv(vertexProgram, GL_PROGRAM_OUTPUT, outputIndex, 1, &typeProperty, 1, nullptr, &outputType);
+
+        if (outputType != inputType)
+        {
+            errors << QString("Fragment shader input '%1 %2' does not match the vertex shader output '%3 %2'.")
+                    .arg(TypeName(inputType), name.data(), TypeName(outputType));
+        }
+    }
+
+    return errors.join("\n");
+}
+
+QString ProgramPipeline::Validate(GLuint newPipeline)
+{
+    glValidateProgramPipeline(newPipeline);
+
+    GLint success = GL_FALSE;
+    glGetProgramPipelineiv(newPipeline, GL_VALIDATE_STATUS, &success);
+
+    if (success) {
+        return "";
+    }
+
+    std::array<char, INFOLOG_BUFFER_SIZE> infoLog{};
+    glGetProgramPipelineInfoLog(newPipeline, INFOLOG_BUFFER_SIZE, nullptr, infoLog.data());
+    return QString("Program pipeline validation failed: %1").arg(infoLog.data());
+}
@@ -0,0 +1,84 @@
+/**
+ * ProgramPipeline Class
+ *
+ * Program pipeline of separable single stage programs (ARB_separate_shader_objects).
+ * Stages are replaced individually, after their interfaces were checked.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_PROGRAMPIPELINE_HPP
+#define SHADERIDE_GL_PROGRAMPIPELINE_HPP
+
+#include <cstdint>
+#include <array>
+#include <QString>
+#include <QList>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "ProgramBuild.hpp"
+
+namespace ShaderIDE::GL {
+
+    class ProgramPipeline : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr size_t INFOLOG_BUFFER_SIZE = 1024;
+        static constexpr int NAME_BUFFER_SIZE = 256;
+
+        struct Stage
+        {
+            GLuint program{ 0 };
+            uint64_t key{ 0 };
+            qint64 compileTime{ 0 }; // Milliseconds
+        };
+
+    public:
+        // Render Thread
+        void Init();
+        void Release();
+
+        bool Complete() const;
+        void Bind();
+
+        GLuint StageProgram(const ShaderType& shaderType) const;
+        uint64_t StageKey(const ShaderType& shaderType) const;
+        qint64 StageCompileTime(const ShaderType& shaderType) const;
+        QList<GLuint> Programs() const;
+
+        // Returns an error message, if the stages were not replaced.
+        QString Replace(const ProgramCompileResults& results);
+
+    private:
+        GLuint pipeline{ 0 };
+        std::array<Stage, 2> stages;
+
+        static int StageIndex(const ShaderType& shaderType);
+        static QString TypeName(GLenum type);
+
+        QString CheckInterface(GLuint vertexProgram, GLuint fragmentProgram);
+        QString Validate(GLuint newPipeline);
+    };
+}
+
+#endif // SHADERIDE_GL_PROGRAMPIPELINE_HPP
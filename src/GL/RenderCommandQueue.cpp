@@ -1,5 +1,5 @@
 /**
- * Shell Class
+ * RenderCommandQueue Class
  *
  * -------------------------------------------------------------------------------
  * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
@@ -26,32 +26,26 @@
  * SOFTWARE.
  */
 
-#include <cstdio>
-#include <array>
-#include <memory>
-#include "Shell.hpp"
+#include <utility>
+#include <QMutexLocker>
+#include "RenderCommandQueue.hpp"
 
-using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
 
-QString Shell::Exec(const QString& cmd)
+void RenderCommandQueue::Push(RenderCommand command)
 {
-    const auto bufSize = 1024;
-
-    QString output;
-    std::array<char, bufSize> buffer{};
-
-    std::unique_ptr<FILE, decltype(&pclose)>
-            pipe(popen(cmd.toStdString().c_str(), "r"), pclose);
-
-    if (pipe == nullptr) {
-        return output;
-    }
-
-    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-        output += buffer.data();
-    }
+    QMutexLocker locker(&mutex);
+    commands.push_back(std::move(command));
+}
 
-    // TODO Handle stderr.
+std::deque<RenderCommand> RenderCommandQueue::TakeAll()
+{
+    QMutexLocker locker(&mutex);
+    return std::exchange(commands, {});
+}
 
-    return output;
+bool RenderCommandQueue::Empty()
+{
+    QMutexLocker locker(&mutex);
+    return commands.empty();
 }
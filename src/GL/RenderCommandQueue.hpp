@@ -0,0 +1,58 @@
+/**
+ * RenderCommandQueue Class
+ *
+ * Thread safe FIFO of commands, which are pushed by the
+ * UI thread and executed by the render thread.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_RENDERCOMMANDQUEUE_HPP
+#define SHADERIDE_GL_RENDERCOMMANDQUEUE_HPP
+
+#include <deque>
+#include <functional>
+#include <QMutex>
+
+namespace ShaderIDE::GL {
+
+    using RenderCommand = std::function<void()>;
+
+    class RenderCommandQueue
+    {
+    public:
+        RenderCommandQueue() = default;
+
+        void Push(RenderCommand command);
+        std::deque<RenderCommand> TakeAll();
+        bool Empty();
+
+    private:
+        QMutex mutex;
+        std::deque<RenderCommand> commands;
+    };
+}
+
+#endif // SHADERIDE_GL_RENDERCOMMANDQUEUE_HPP
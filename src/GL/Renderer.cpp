@@ -0,0 +1,2486 @@
+/**
+ * Renderer Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <QCoreApplication>
+#include <QMetaObject>
+#include <QMutexLocker>
+#include <QSurfaceFormat>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "Renderer.hpp"
+#include "GLDefaults.hpp"
+#include "GLUtility.hpp"
+#include "TextureSlots.hpp"
+#include "src/Core/GeneralException.hpp"
+#include "src/Core/Memory.hpp"
+#include "src/Core/MathUtility.hpp"
+#include "src/Core/Hash.hpp"
+#include "src/Core/SyntaxErrorException.hpp"
+
+using namespace ShaderIDE::GL;
+
+Renderer::Renderer(QOpenGLContext* shareContext)
+        : QObject()
+{
+    qRegisterMetaType<GLSLCompileError>("GLSLCompileError");
+    qRegisterMetaType<PermutationResults>("PermutationResults");
+    qRegisterMetaType<ShaderUniforms>("ShaderUniforms");
+    qRegisterMetaType<TileTimings>("TileTimings");
+
+    // The context is created here, but used on the render thread only.
+    context = new QOpenGLContext();
+    context->setShareContext(shareContext);
+    context->setFormat(shareContext != nullptr ? shareContext->format()
+                                               : QSurfaceFormat::defaultFormat());
+
+    if (!context->create())
+    {
+        Memory::Release(context);
+        throw GeneralException("Could not create the render context.");
+    }
+
+    // Offscreen surfaces must be created on the GUI thread.
+    surface = new QOffscreenSurface();
+    surface->setFormat(context->format());
+    surface->create();
+
+    programCompiler = new ProgramCompiler(context->format());
+    computeCompiler = new ProgramCompiler(context->format());
+    permutationCompiler = new PermutationCompiler(context->format());
+
+    // Tile reads are bound by the disk.
+    tilePool.setMaxThreadCount(2);
+}
+
+Renderer::~Renderer()
+{
+    Memory::Release(permutationCompiler);
+    Memory::Release(computeCompiler);
+    Memory::Release(programCompiler);
+    Memory::Release(context);
+    Memory::Release(surface);
+}
+
+void Renderer::Start(QThread* renderThread)
+{
+    context->moveToThread(renderThread);
+    moveToThread(renderThread);
+
+    QMetaObject::invokeMethod(this, "OnInitialize", Qt::QueuedConnection);
+}
+
+void Renderer::Stop()
+{
+    if (thread() == QThread::currentThread())
+    {
+        OnShutdown();
+        return;
+    }
+
+    QMetaObject::invokeMethod(this, "OnShutdown", Qt::BlockingQueuedConnection);
+}
+
+FrameExchange& Renderer::Frames()
+{
+    return frameExchange;
+}
+
+void Renderer::SetState(const RenderState& newState)
+{
+    {
+        QMutexLocker locker(&stateMutex);
+        pendingState = newState;
+        pendingStateChanged = true;
+    }
+
+    ScheduleFrame();
+}
+
+void Renderer::SetVertexShaderSource(const QString& source)
+{
+    Enqueue([this, source]() {
+        vertexShaderSource = source;
+    });
+}
+
+void Renderer::SetFragmentShaderSource(const QString& source)
+{
+    Enqueue([this, source]() {
+        fragmentShaderSource = source;
+    });
+}
+
+void Renderer::CompileShaders()
+{
+    // Not queued as a command, multiple requests until the
+    // next frame result in a single compilation of the latest sources.
+    compileRequested = true;
+    ScheduleFrame();
+}
+
+void Renderer::SetSeparableStages(bool enabled)
+{
+    Enqueue([this, enabled]() {
+        if (separableStages != enabled)
+        {
+            separableStages = enabled;
+            compileRequested = true;
+        }
+    });
+}
+
+void Renderer::SetIncludeDirectory(const QString& directory)
+{
+    Enqueue([this, directory]() {
+        preprocessor.SetIncludeDirectory(directory);
+    });
+}
+
+void Renderer::SetUniformValue(const QString& name, const glm::vec4& value)
+{
+    Enqueue([this, name, value]() {
+        uniformValues.insert(name, value);
+        uniformRevision++;
+    });
+}
+
+void Renderer::ClearUniformValues()
+{
+    Enqueue([this]() {
+        uniformValues.clear();
+        uniformRevision++;
+    });
+}
+
+void Renderer::SetHotLiterals(bool enabled)
+{
+    Enqueue([this, enabled]() {
+        if (hotLiterals != enabled)
+        {
+            hotLiterals = enabled;
+            pendingHotLiteralShape.clear();
+            pendingHotLiteralValues.clear();
+            compileRequested = true;
+        }
+    });
+}
+
+void Renderer::SetHotLiteral(const ShaderType& shaderType, int index, float value)
+{
+    Enqueue([this, shaderType, index, value]() {
+        auto it = hotLiteralValues.find(shaderType);
+
+        if (it != hotLiteralValues.end() && index >= 0 && index < static_cast<int>(it->second.size()))
+        {
+            it->second[index] = value;
+            uniformRevision++;
+        }
+    });
+}
+
+void Renderer::SetComputeShaderSource(const QString& source)
+{
+    Enqueue([this, source]() {
+        computeShaderSource = source;
+    });
+}
+
+void Renderer::SetComputeSettings(const ComputeSettings& settings)
+{
+    Enqueue([this, settings]() {
+        const auto enabling = settings.enabled && !computeStage.Settings().enabled;
+
+        computeStage.SetSettings(settings);
+        computeDispatchRequested = true;
+        computeRevision++;
+        textureRevision++; // The output may be a new texture
+
+        // Disabled compute shaders are not compiled, see CompileComputeProgram().
+        if (enabling) {
+            CompileComputeProgram();
+        }
+    });
+}
+
+void Renderer::DispatchCompute()
+{
+    Enqueue([this]() {
+        computeDispatchRequested = true;
+    });
+}
+
+void Renderer::ProfileTiles()
+{
+    Enqueue([this]() {
+        // Resizing in between cancels the profile, see ProfileNextTileFrame().
+        const auto timer = SoftwareRenderer() ? TileTimings::TIMER::CPU : TileTimings::TIMER::GPU;
+        tileTimings = TileTimings(state.framebufferSize, TILE_PROFILE_SIZE, timer);
+        tileProfileFrames = TILE_PROFILE_FRAMES;
+    });
+}
+
+void Renderer::BuildPermutations(const QList<PermutationDefines>& permutations, bool benchmark)
+{
+    Enqueue([this, permutations, benchmark]() {
+        DeletePermutationBenchmarks();
+        permutationResults.clear();
+        permutationBenchmark = benchmark;
+
+        for (int i = 0; i < permutations.size(); i++)
+        {
+            PermutationResult result;
+            result.index = i;
+            result.defines = permutations.at(i);
+            permutationResults << result;
+        }
+
+        // The editor sources are shared by all variants.
+        ShaderSources sources;
+
+        if (!PreprocessSources(sources))
+        {
+            permutationCompiler->Cancel();
+
+            for (auto& result : permutationResults) {
+                result.error = "The includes could not be resolved, see the log.";
+            }
+
+            FinishPermutations();
+            return;
+        }
+
+        ProgramRequests requests;
+
+        for (int i = 0; i < permutations.size(); i++)
+        {
+            ProgramRequest request;
+            request.key = static_cast<uint64_t>(i);
+
+            for (const auto& [shaderType, source] : sources) {
+                request.sources << qMakePair(shaderType, ShaderPermutations::ApplyDefines(source, permutations.at(i)));
+            }
+
+            requests << request;
+        }
+
+        emit NotifyLogMessage(
+                QString("Permutations: compiling %1 variants on %2 worker contexts.")
+                        .arg(requests.size())
+                        .arg(permutationCompiler->Workers())
+        );
+
+        permutationCompiler->Compile(requests);
+    });
+}
+
+void Renderer::SetMeshVertices(const VertexVec& meshVertices)
+{
+    Enqueue([this, meshVertices]() {
+        vertices = meshVertices;
+        InitVAO();
+    });
+}
+
+void Renderer::SetPlaneVertices(const VertexVec& meshVertices)
+{
+    Enqueue([this, meshVertices]() {
+        planeVertices = meshVertices;
+        InitPlaneVAO();
+    });
+}
+
+void Renderer::SetTexture(int slot, const QImage& upload)
+{
+    // Image valid?
+    if (upload.isNull()) {
+        return;
+    }
+
+    Enqueue([this, slot, upload]() {
+        if (slot >= 0 && slot < textureManager.SlotCount()) {
+            StreamTexture(slot, upload);
+        }
+    });
+}
+
+void Renderer::SetCompressedTexture(int slot, const CompressedImage& image)
+{
+    if (image.IsNull()) {
+        return;
+    }
+
+    Enqueue([this, slot, image]() {
+        if (slot < 0 || slot >= textureManager.SlotCount()) {
+            return;
+        }
+
+        const auto serial = ++textureSerials.at(slot);
+
+        if (textureManager.CompressedSupported(image.InternalFormat()))
+        {
+            const auto reused = textureManager.SetCompressedImage(slot, image);
+            TextureUploaded(slot, image.Size(), reused, CompressedImage::FormatName(image.Format()) + " uploaded");
+            return;
+        }
+
+        const auto formatName = CompressedImage::FormatName(image.Format());
+
+        if (!image.Decodable())
+        {
+            textureManager.Clear(slot);
+            textureRevision++;
+            emit NotifyLogMessage(QString("%1 textures are not supported by the driver, slot %2 is empty.")
+                                          .arg(formatName).arg(slot));
+            return;
+        }
+
+        // The blocks are decoded on the CPU, the result is streamed like other images.
+        emit NotifyLogMessage(QString("%1 textures are not supported by the driver, slot %2 is decoded on the CPU.")
+                                      .arg(formatName).arg(slot));
+
+        transcodePool.start([this, slot, serial, image]() {
+            const auto upload = image.Decode(0);
+
+            Enqueue([this, slot, serial, upload]() {
+                if (slot < textureManager.SlotCount() && serial == textureSerials.at(slot)) {
+                    StreamTexture(slot, upload);
+                }
+            });
+        });
+    });
+}
+
+void Renderer::SetStreamedTexture(int slot, const QImage& proxyUpload, const TilePyramid& pyramid)
+{
+    if (proxyUpload.isNull() || pyramid.IsNull()) {
+        return;
+    }
+
+    Enqueue([this, slot, proxyUpload, pyramid]() {
+        if (slot < 0 || slot >= textureManager.SlotCount()) {
+            return;
+        }
+
+        StreamedSlot streamed;
+        streamed.pyramid = pyramid;
+        streamed.serial = ++textureSerials.at(slot);
+        streamed.proxyLevel = pyramid.LevelForExtent(TilePyramid::PROXY_SIZE);
+        streamed.level = streamed.proxyLevel;
+        streamedSlots[slot] = streamed;
+
+        // Not streamed, the buffered upload could land after the first tiles.
+        const auto reused = textureManager.SetUploadImage(slot, proxyUpload);
+        TextureUploaded(slot, proxyUpload.size(), reused, "proxy uploaded");
+    });
+}
+
+void Renderer::ClearTexture(int slot)
+{
+    Enqueue([this, slot]() {
+        if (slot < 0 || slot >= textureManager.SlotCount()) {
+            return;
+        }
+
+        // Empty slots sample the shared black fallback.
+        textureSerials.at(slot)++;
+        textureManager.Clear(slot);
+        textureRevision++;
+    });
+}
+
+void Renderer::SetTextureSlotCount(int count)
+{
+    Enqueue([this, count = TextureSlots::ClampCount(count)]() {
+        // Images of removed slots, which are still streamed, are dropped.
+        for (int slot = count; slot < textureManager.SlotCount(); slot++) {
+            textureSerials.at(slot)++;
+        }
+
+        textureManager.SetSlotCount(count);
+        textureRevision++;
+        InvalidateFrameHistory();
+    });
+}
+
+void Renderer::SetTextureMemoryLimit(qint64 bytes)
+{
+    // Streamed slots switch their level with the next frame.
+    Enqueue([this, bytes]() {
+        textureMemoryLimit = bytes;
+    });
+}
+
+void Renderer::FramePresented()
+{
+    // Animations, progressive passes and accumulation continue
+    // after the viewport presented the previous frame.
+    if (continuationRequired) {
+        ScheduleFrame();
+    }
+}
+
+void Renderer::OnInitialize()
+{
+    if (!context->makeCurrent(surface))
+    {
+        emit NotifyLogMessage("Could not activate the render context.");
+        return;
+    }
+
+    initializeOpenGLFunctions();
+    InitVAO();
+    InitPlaneVAO();
+
+    programCompiler->Init(context);
+    computeCompiler->Init(context);
+    permutationCompiler->Init(context);
+    programBinaryCache.Init();
+    programPipeline.Init();
+    uniformReflection.Init();
+    computeStage.Init();
+    textureManager.Init();
+    textureStreamer.Init();
+    programTextures.Init(context);
+    computeTextures.Init(context);
+    benchmarkTextures.Init(context);
+
+    if (!programBinaryCache.Enabled()) {
+        emit NotifyLogMessage("Program binaries are not supported by the driver, the program cache is disabled.");
+    }
+
+    if (programBinaryCache.PrunedFiles() > 0)
+    {
+        emit NotifyLogMessage(QString("Program cache pruned, %1 least recently used binaries (%2 KB) removed.")
+                .arg(programBinaryCache.PrunedFiles())
+                .arg(programBinaryCache.PrunedSize() / 1024));
+    }
+
+    if (programCompiler->Mode() == ProgramCompiler::MODE::PARALLEL) {
+        emit NotifyLogMessage("Shaders are compiled in parallel by the graphics driver.");
+
+    } else if (programCompiler->Mode() == ProgramCompiler::MODE::SYNCHRONOUS) {
+        emit NotifyLogMessage("No shared context available, shaders are compiled on the render thread.");
+    }
+
+    screenQuad = new ScreenQuad();
+
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+
+    glEnable(GL_MULTISAMPLE);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_STENCIL_TEST);
+
+    // Frame Statistics
+    frameStatisticsTimer = new QTimer(this);
+
+    connect(frameStatisticsTimer, SIGNAL(timeout()),
+            this, SLOT(OnLogFrameStatistics()));
+
+    frameStatisticsTimer->start(FRAME_STATISTICS_INTERVAL);
+
+    initialized = true;
+    emit NotifyInitialized();
+
+    ScheduleFrame();
+}
+
+void Renderer::OnShutdown()
+{
+    if (initialized)
+    {
+        Memory::Release(frameStatisticsTimer);
+        frameStatisticsTimer = nullptr;
+
+        // Frames
+        for (int i = 0; i < FrameExchange::NUM_FRAMES; i++)
+        {
+            glDeleteSync(frameExchange.TakePresentFence(i));
+            glDeleteSync(frameExchange.TakeRenderFence(i));
+            Memory::Release(frameFBOs.at(i));
+            frameFBOs.at(i) = nullptr;
+        }
+
+        Memory::Release(accumulationSampleFBO);
+        Memory::Release(accumulationFBO);
+        Memory::Release(progressiveFBO);
+        Memory::Release(multisampleFBO);
+        Memory::Release(screenQuad);
+
+        // Texture Slots
+        transcodePool.clear();
+        transcodePool.waitForDone();
+        tilePool.clear();
+        tilePool.waitForDone();
+        streamedSlots.clear();
+        refinedSlots.clear();
+        textureStreamer.Release();
+        textureManager.Release();
+
+        // VAO
+        glDeleteBuffers(1, &planeVertexBuffer);
+        glDeleteBuffers(1, &vertexBuffer);
+        glDeleteVertexArrays(1, &planeVAO);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteProgram(program);
+        program = 0;
+
+        programCompiler->Release();
+        computeCompiler->Release();
+        computeStage.Release();
+        DeletePendingStageResults();
+        DeletePermutationBenchmarks();
+        DeleteTileProfile();
+        permutationCompiler->Release();
+        Memory::Release(benchmarkFBO);
+        benchmarkFBO = nullptr;
+        programPipeline.Release();
+        pipelineActive = false;
+
+        context->doneCurrent();
+        initialized = false;
+    }
+
+    // Hand the objects back, so they can be destroyed on the GUI thread.
+    context->moveToThread(QCoreApplication::instance()->thread());
+    moveToThread(QCoreApplication::instance()->thread());
+}
+
+void Renderer::OnFrame()
+{
+    frameScheduled = false;
+
+    if (!initialized) {
+        return;
+    }
+
+    // Commands first, then the latest state, which
+    // replaces all states pushed since the last frame.
+    for (auto& command : commandQueue.TakeAll()) {
+        command();
+    }
+
+    if (compileRequested.exchange(false)) {
+        CompileProgram();
+    }
+
+    PollProgramCompiler();
+    PollComputeCompiler();
+    PollPermutationCompiler();
+
+    ApplyPendingState();
+    RefineStreamedTextures();
+
+    if (state.realtime) {
+        renderTime = static_cast<float>(realtimeTimer.elapsed()) / 1000.0f;
+    }
+
+    RunCompute();
+    RenderFrame();
+    BenchmarkNextPermutation();
+    ProfileNextTileFrame();
+}
+
+void Renderer::OnLogFrameStatistics()
+{
+    // Nothing to report, if every frame had to be rendered anyway.
+    if (elidedFrames == 0) {
+        return;
+    }
+
+    const auto totalFrames = renderedFrames + elidedFrames;
+
+    emit NotifyLogMessage(
+            QString("Frames rendered: %1, elided: %2 (%3%).")
+                    .arg(renderedFrames)
+                    .arg(elidedFrames)
+                    .arg(qRound(100.0f * static_cast<float>(elidedFrames)
+                                / static_cast<float>(totalFrames)))
+    );
+
+    renderedFrames = 0;
+    elidedFrames = 0;
+}
+
+void Renderer::Enqueue(RenderCommand command)
+{
+    commandQueue.Push(std::move(command));
+    ScheduleFrame();
+}
+
+void Renderer::ScheduleFrame()
+{
+    // At most one frame is queued, it picks up all changes made until then.
+    if (!frameScheduled.exchange(true)) {
+        QMetaObject::invokeMethod(this, "OnFrame", Qt::QueuedConnection);
+    }
+}
+
+void Renderer::ApplyPendingState()
+{
+    RenderState newState;
+
+    {
+        QMutexLocker locker(&stateMutex);
+
+        if (!pendingStateChanged) {
+            return;
+        }
+
+        newState = pendingState;
+        pendingStateChanged = false;
+    }
+
+    if (newState.realtime && !state.realtime) {
+        realtimeTimer.start();
+    }
+
+    // Release buffers of features, which are no longer used.
+    if (newState.samples != state.samples)
+    {
+        Memory::Release(multisampleFBO);
+        multisampleFBO = nullptr;
+    }
+
+    if (!newState.progressive && state.progressive)
+    {
+        Memory::Release(progressiveFBO);
+        progressiveFBO = nullptr;
+    }
+
+    if (!newState.accumulation && state.accumulation)
+    {
+        Memory::Release(accumulationSampleFBO);
+        Memory::Release(accumulationFBO);
+        accumulationSampleFBO = nullptr;
+        accumulationFBO = nullptr;
+    }
+
+    const auto modeChanged = newState.realtime != state.realtime
+                             || newState.plane2D != state.plane2D
+                             || newState.progressive != state.progressive
+                             || newState.accumulation != state.accumulation;
+
+    state = newState;
+
+    if (modeChanged)
+    {
+        InvalidateFrameHistory();
+        publishedFrameHash = 0;
+    }
+}
+
+bool Renderer::Animated() const
+{
+    return state.realtime && (timeUniformActive || ComputeAnimated());
+}
+
+void Renderer::RenderFrame()
+{
+    continuationRequired = false;
+
+    if (state.framebufferSize.isEmpty()) {
+        return;
+    }
+
+    // Progressive and accumulated images restart, if anything
+    // except the time changed. Time is handled by the modes.
+    const auto inputsHash = FrameInputsHash(false);
+
+    if (inputsHash != historyHash)
+    {
+        historyHash = inputsHash;
+        InvalidateFrameHistory();
+    }
+
+    // Plane 2D shaders may be rendered tile by tile
+    // over multiple frames, see PaintProgressive().
+    if (state.plane2D && state.progressive)
+    {
+        PaintProgressive();
+        return;
+    }
+
+    // Static scenes converge over multiple jittered
+    // frames, see PaintAccumulated().
+    if (state.accumulation && !Animated())
+    {
+        PaintAccumulated();
+        return;
+    }
+
+    // Keep the last frame, if none of the
+    // inputs affecting the output changed.
+    const auto frameHash = FrameInputsHash(true);
+
+    if (frameHash == publishedFrameHash)
+    {
+        elidedFrames++;
+        return;
+    }
+
+    // Multisampled frames are rendered offscreen and
+    // resolved into the back buffer afterwards.
+    BindBackBuffer();
+    PrepareMultisampleFBO();
+
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    // Shader Uniforms
+    UseProgram();
+    ApplyUniforms(renderTime);
+
+    // Samplers (Textures)
+    BindTextures();
+
+    // Draw
+    DrawVAO();
+    DrawPlaneVAO();
+
+    // Reset Shader Program
+    ReleaseProgram();
+
+    ReleaseTextures();
+
+    ResolveMultisampleFBO();
+    PublishBackBuffer();
+
+    publishedFrameHash = frameHash;
+    renderedFrames++;
+    continuationRequired = Animated();
+}
+
+void Renderer::BindBackBuffer()
+{
+    const auto index = frameExchange.BackIndex();
+
+    // The viewport may still sample this frame from its last presentation.
+    // A render fence left over belongs to a frame, which was never presented.
+    auto presentFence = frameExchange.TakePresentFence(index);
+
+    if (presentFence != nullptr)
+    {
+        glWaitSync(presentFence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(presentFence);
+    }
+
+    auto renderFence = frameExchange.TakeRenderFence(index);
+
+    if (renderFence != nullptr) {
+        glDeleteSync(renderFence);
+    }
+
+    auto& fbo = frameFBOs.at(index);
+
+    if (fbo == nullptr || fbo->size() != state.framebufferSize)
+    {
+        Memory::Release(fbo);
+
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setInternalTextureFormat(GL_RGBA8);
+
+        fbo = new QOpenGLFramebufferObject(state.framebufferSize, format);
+    }
+
+    backFBO = fbo;
+    backFBO->bind();
+    glViewport(0, 0, backFBO->width(), backFBO->height());
+}
+
+void Renderer::PublishBackBuffer()
+{
+    // The fence has to be flushed, before the viewport context waits for it.
+    auto renderFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+
+    frameExchange.PublishBack(backFBO->texture(), renderFence);
+    emit NotifyFrameReady();
+}
+
+void Renderer::PresentTexture(GLuint texture)
+{
+    BindBackBuffer();
+
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    screenQuad->Draw(texture);
+
+    PublishBackBuffer();
+    publishedFrameHash = 0;
+}
+
+int Renderer::EffectiveSamples() const
+{
+    if (maxSamples > 0 && state.samples > maxSamples) {
+        return maxSamples;
+    }
+
+    return state.samples;
+}
+
+void Renderer::PrepareMultisampleFBO()
+{
+    const auto numSamples = EffectiveSamples();
+
+    if (numSamples == 0)
+    {
+        Memory::Release(multisampleFBO);
+        multisampleFBO = nullptr;
+        return;
+    }
+
+    const auto size = state.framebufferSize;
+
+    if (multisampleFBO == nullptr || multisampleFBO->size() != size)
+    {
+        // Report the limit once per sample count change, not on every resize.
+        if (multisampleFBO == nullptr && numSamples != state.samples)
+        {
+            emit NotifyLogMessage(
+                    QString("Multisampling limited to %1 samples by the graphics driver.")
+                            .arg(numSamples)
+            );
+        }
+
+        Memory::Release(multisampleFBO);
+
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setInternalTextureFormat(GL_RGBA8);
+        format.setSamples(numSamples);
+
+        multisampleFBO = new QOpenGLFramebufferObject(size, format);
+    }
+
+    multisampleFBO->bind();
+    glViewport(0, 0, size.width(), size.height());
+}
+
+void Renderer::ResolveMultisampleFBO()
+{
+    if (multisampleFBO == nullptr) {
+        return;
+    }
+
+    const auto size = multisampleFBO->size();
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, multisampleFBO->handle());
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, backFBO->handle());
+    glBlitFramebuffer(0, 0, size.width(), size.height(),
+                      0, 0, size.width(), size.height(),
+                      GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, backFBO->handle());
+}
+
+void Renderer::PrepareProgressiveFBO()
+{
+    const auto size = state.framebufferSize;
+
+    if (progressiveFBO == nullptr || progressiveFBO->size() != size)
+    {
+        Memory::Release(progressiveFBO);
+
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setInternalTextureFormat(GL_RGBA8);
+
+        progressiveFBO = new QOpenGLFramebufferObject(size, format);
+        progressiveDirty = true;
+    }
+
+    if (!progressiveDirty) {
+        return;
+    }
+
+    // Inputs changed, start over with a cleared image.
+    progressiveFBO->bind();
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    progressiveDirty = false;
+    StartProgressivePass();
+}
+
+void Renderer::StartProgressivePass()
+{
+    // The time uniform is frozen for a whole pass,
+    // otherwise the tiles would not match each other.
+    progressiveTime = renderTime;
+    tileScheduler.Reset(progressiveFBO->width(), progressiveFBO->height());
+    progressivePassTimer.start();
+}
+
+void Renderer::PaintProgressive()
+{
+    PrepareProgressiveFBO();
+
+    // Realtime mode starts a new pass with an updated time as soon as
+    // the previous one is complete. The old image is kept meanwhile.
+    if (tileScheduler.Finished() && Animated()) {
+        StartProgressivePass();
+    }
+
+    // The finished image is already presented.
+    if (tileScheduler.Finished() && publishedFrameHash == historyHash)
+    {
+        elidedFrames++;
+        return;
+    }
+
+    if (!tileScheduler.Finished())
+    {
+        DrawPlaneVAOTiles();
+
+        if (tileScheduler.Finished() && !Animated())
+        {
+            emit NotifyStateUpdated(
+                    QString("Progressive rendering finished in %1 ms.")
+                            .arg(progressivePassTimer.elapsed())
+            );
+        }
+    }
+
+    // Present the (partially) rendered image.
+    PresentTexture(progressiveFBO->texture());
+    renderedFrames++;
+
+    if (tileScheduler.Finished() && !Animated()) {
+        publishedFrameHash = historyHash;
+    }
+
+    // Continue with the next slice after the frame was presented.
+    continuationRequired = !tileScheduler.Finished() || Animated();
+}
+
+void Renderer::PrepareAccumulationFBOs()
+{
+    const auto size = state.framebufferSize;
+
+    if (accumulationFBO == nullptr || accumulationFBO->size() != size)
+    {
+        Memory::Release(accumulationSampleFBO);
+        Memory::Release(accumulationFBO);
+
+        // Running average, float precision to avoid banding.
+        QOpenGLFramebufferObjectFormat accumulationFormat;
+        accumulationFormat.setInternalTextureFormat(GL_RGBA32F);
+        accumulationFBO = new QOpenGLFramebufferObject(size, accumulationFormat);
+
+        // Single sampled frame, which is added to the average.
+        QOpenGLFramebufferObjectFormat sampleFormat;
+        sampleFormat.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        sampleFormat.setInternalTextureFormat(GL_RGBA16F);
+        accumulationSampleFBO = new QOpenGLFramebufferObject(size, sampleFormat);
+
+        accumulationDirty = true;
+    }
+
+    if (accumulationDirty)
+    {
+        accumulationFrame = 0;
+        accumulationDirty = false;
+    }
+}
+
+void Renderer::PaintAccumulated()
+{
+    PrepareAccumulationFBOs();
+
+    // The converged image is already presented.
+    if (accumulationFrame >= ACCUMULATION_MAX_FRAMES && publishedFrameHash == historyHash)
+    {
+        elidedFrames++;
+        return;
+    }
+
+    if (accumulationFrame < ACCUMULATION_MAX_FRAMES)
+    {
+        // Render a single sampled, jittered frame.
+        accumulationSampleFBO->bind();
+        glViewport(0, 0, accumulationSampleFBO->width(), accumulationSampleFBO->height());
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+        UseProgram();
+        ApplyUniforms(renderTime, AccumulationJitter());
+        BindTextures();
+        DrawVAO();
+        DrawPlaneVAO();
+        ReleaseProgram();
+        ReleaseTextures();
+
+        // Add the frame to the running average with a weight of 1 / n.
+        // The first frame simply overwrites the previous history.
+        accumulationFBO->bind();
+        glEnable(GL_BLEND);
+        glBlendColor(0.0f, 0.0f, 0.0f, 1.0f / static_cast<float>(accumulationFrame + 1));
+        glBlendFunc(GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA);
+        screenQuad->Draw(accumulationSampleFBO->texture());
+        glDisable(GL_BLEND);
+
+        accumulationFrame++;
+    }
+
+    PresentTexture(accumulationFBO->texture());
+    renderedFrames++;
+
+    if (accumulationFrame >= ACCUMULATION_MAX_FRAMES) {
+        publishedFrameHash = historyHash;
+    }
+
+    // Keep refining until the image converged.
+    continuationRequired = accumulationFrame < ACCUMULATION_MAX_FRAMES;
+}
+
+glm::vec2 Renderer::AccumulationJitter() const
+{
+    // Sub-pixel offset within [-0.5, 0.5], the first frame is not jittered.
+    if (accumulationFrame == 0) {
+        return glm::vec2(0.0f);
+    }
+
+    return glm::vec2(
+            MathUtility::halton(accumulationFrame, 2) - 0.5f,
+            MathUtility::halton(accumulationFrame, 3) - 0.5f
+    );
+}
+
+void Renderer::InvalidateFrameHistory()
+{
+    progressiveDirty = true;
+    accumulationDirty = true;
+}
+
+uint64_t Renderer::FrameInputsHash(bool includeTime)
+{
+    const auto matrixSize = 16 * sizeof(GLfloat);
+
+    Hash hash;
+    hash.Add(program).Add(programRevision)
+        .Add(meshRevision).Add(state.plane2D)
+        .Add(textureRevision).Add(uniformRevision)
+        .Add(computeRevision)
+        .Add(GetModelMatrix(), matrixSize)
+        .Add(GetViewMatrix(), matrixSize)
+        .Add(GetProjectionMatrix(), matrixSize)
+        .Add(state.framebufferSize.width())
+        .Add(state.framebufferSize.height())
+        .Add(EffectiveSamples());
+
+    // Time and mouse position are only relevant,
+    // if the linked program actually uses them.
+    if (includeTime && timeUniformActive) {
+        hash.Add(renderTime);
+    }
+
+    if (mousePosUniformActive) {
+        hash.Add(state.mousePos.x).Add(state.mousePos.y);
+    }
+
+    return hash.Value();
+}
+
+GLfloat* Renderer::GetModelMatrix()
+{
+    if (state.plane2D) {
+        return glm::value_ptr(identityMatrix);
+    }
+
+    return glm::value_ptr(state.modelMatrix);
+}
+
+GLfloat* Renderer::GetViewMatrix()
+{
+    if (state.plane2D) {
+        return glm::value_ptr(identityMatrix);
+    }
+
+    return glm::value_ptr(state.viewMatrix);
+}
+
+GLfloat* Renderer::GetProjectionMatrix()
+{
+    if (state.plane2D) {
+        return glm::value_ptr(identityMatrix);
+    }
+
+    return glm::value_ptr(state.projectionMatrix);
+}
+
+void Renderer::StreamTexture(int slot, const QImage& upload)
+{
+    // Converted and flipped by the caller. A worker copies the pixels into the
+    // streaming buffer, the upload follows with the commands of a later frame.
+    const auto serial = ++textureSerials.at(slot);
+
+    const auto region = textureStreamer.Stream(upload, [this, slot, serial, size = upload.size()](int region) {
+        Enqueue([this, slot, serial, size, region]() {
+            UploadStreamedTexture(slot, serial, size, region);
+        });
+    });
+
+    // Ring busy or image too large.
+    if (region == -1)
+    {
+        const auto reused = textureManager.SetUploadImage(slot, upload);
+        TextureUploaded(slot, upload.size(), reused, "uploaded");
+    }
+}
+
+void Renderer::UploadStreamedTexture(int slot, uint64_t serial, const QSize& size, int region)
+{
+    // Replaced, cleared or removed while the pixels were copied.
+    if (slot >= textureManager.SlotCount() || serial != textureSerials.at(slot))
+    {
+        textureStreamer.Discard(region);
+        return;
+    }
+
+    // Images of the same size are uploaded into the existing storage.
+    const auto reused = textureManager.Allocate(slot, size);
+    textureStreamer.Upload(region, textureManager.Texture(slot), size);
+    textureManager.GenerateMipmaps(slot);
+
+    TextureUploaded(slot, size, reused, "streamed");
+}
+
+void Renderer::TextureUploaded(int slot, const QSize& size, bool reused, const QString& upload)
+{
+    textureRevision++;
+
+    emit NotifyStateUpdated(
+            QString("Texture slot %1: %2 x %3 %4, %5 MB GPU memory (%6), %7 MB for all slots.")
+                    .arg(slot)
+                    .arg(size.width())
+                    .arg(size.height())
+                    .arg(upload)
+                    .arg(static_cast<double>(textureManager.SlotBytes(slot)) / (1024.0 * 1024.0), 0, 'f', 2)
+                    .arg(reused ? "storage reused" : "new storage")
+                    .arg(static_cast<double>(textureManager.TotalBytes()) / (1024.0 * 1024.0), 0, 'f', 2)
+    );
+}
+
+void Renderer::RefineStreamedTextures()
+{
+    for (const auto slot : refinedSlots)
+    {
+        if (slot < textureManager.SlotCount()) {
+            textureManager.GenerateMipmaps(slot);
+        }
+    }
+
+    refinedSlots.clear();
+
+    // Without feedback from the shader, the sampled level is the one
+    // covering the viewport (Plane 2D maps the texture once).
+    const auto extent = std::max(state.framebufferSize.width(), state.framebufferSize.height());
+
+    for (auto it = streamedSlots.begin(); it != streamedSlots.end();)
+    {
+        const auto slot = it->first;
+        auto& streamed = it->second;
+
+        // Replaced, cleared or removed.
+        if (slot >= textureManager.SlotCount() || streamed.serial != textureSerials.at(slot))
+        {
+            it = streamedSlots.erase(it);
+            continue;
+        }
+
+        // Never coarser than the proxy, a level is finished before the next one starts.
+        const auto level = std::min(streamed.pyramid.LevelForExtent(extent, textureMemoryLimit), streamed.proxyLevel);
+
+        if (streamed.pendingTiles == 0 && level != streamed.level) {
+            LoadStreamedLevel(slot, streamed, level);
+        }
+
+        ++it;
+    }
+}
+
+void Renderer::LoadStreamedLevel(int slot, StreamedSlot& streamed, int level)
+{
+    // The resident level is scaled into the new storage,
+    // it is shown until the tiles replace it.
+    const auto& pyramid = streamed.pyramid;
+    textureManager.Reallocate(slot, pyramid.LevelSize(level));
+    textureRevision++;
+
+    streamed.load = ++nextTileLoad;
+    streamed.level = level;
+    streamed.pendingTiles = pyramid.Columns(level) * pyramid.Rows(level);
+    streamed.missingTiles = 0;
+
+    for (int row = 0; row < pyramid.Rows(level); row++)
+    {
+        for (int column = 0; column < pyramid.Columns(level); column++)
+        {
+            tilePool.start([this, slot, serial = streamed.serial, load = streamed.load, pyramid, level, column, row]() {
+                const auto tile = TextureManager::MakeUploadImage(pyramid.ReadTile(level, column, row));
+                const auto rect = pyramid.TileRect(level, column, row);
+
+                Enqueue([this, slot, serial, load, rect, tile]() {
+                    UploadStreamedTile(slot, serial, load, rect, tile);
+                });
+            });
+        }
+    }
+}
+
+void Renderer::UploadStreamedTile(int slot, uint64_t serial, uint64_t load, const QRect& rect, const QImage& tile)
+{
+    if (slot >= textureManager.SlotCount() || serial != textureSerials.at(slot)) {
+        return;
+    }
+
+    // Tiles of an earlier level.
+    const auto it = streamedSlots.find(slot);
+
+    if (it == streamedSlots.end() || it->second.load != load) {
+        return;
+    }
+
+    auto& streamed = it->second;
+
+    if (tile.isNull()) {
+        streamed.missingTiles++;
+
+    } else {
+        // Rows of upload images are flipped, the first tile row is at the top.
+        const auto levelHeight = textureManager.Size(slot).height();
+        textureManager.SetUploadRegion(slot, QPoint(rect.x(), levelHeight - rect.y() - rect.height()), tile);
+        textureRevision++;
+
+        if (!refinedSlots.contains(slot)) {
+            refinedSlots << slot;
+        }
+    }
+
+    if (--streamed.pendingTiles > 0) {
+        return;
+    }
+
+    if (streamed.missingTiles > 0)
+    {
+        emit NotifyLogMessage(QString("%1 tiles of texture slot %2 could not be read from the tile cache.")
+                                      .arg(streamed.missingTiles).arg(slot));
+    }
+
+    TextureUploaded(slot, textureManager.Size(slot), false,
+                    QString("streamed (tile level %1 of %2)").arg(streamed.level).arg(streamed.pyramid.Levels()));
+}
+
+void Renderer::AssignTextures(TextureBindings& bindings, const QList<GLuint>& programs, const QStringList& sources)
+{
+    // Handles are only passed to shaders, which declare their samplers bindless.
+    auto bindlessRequested = false;
+
+    for (const auto& source : sources) {
+        bindlessRequested |= source.contains("GL_ARB_bindless_texture");
+    }
+
+    bindings.Assign(programs, bindlessRequested);
+
+    if (bindlessRequested && !bindings.Bindless()) {
+        emit NotifyLogMessage("Bindless textures are not supported by the driver, texture units are bound instead.");
+    }
+}
+
+void Renderer::BindTextures()
+{
+    BindTextures(programTextures);
+}
+
+void Renderer::BindTextures(TextureBindings& bindings)
+{
+    std::vector<GLuint> textures;
+
+    for (const auto& sampler : bindings.Samplers())
+    {
+        switch (sampler.source)
+        {
+            case SamplerBinding::SOURCE::SLOT:
+                textures.push_back(textureManager.Texture(sampler.slot));
+                break;
+
+            case SamplerBinding::SOURCE::ARRAY:
+                UpdateTextureArray();
+                textures.push_back(textureManager.ArrayTexture());
+                break;
+
+            case SamplerBinding::SOURCE::COMPUTE_OUTPUT:
+                textures.push_back(computeStage.OutputTexture() != 0
+                                   ? computeStage.OutputTexture()
+                                   : textureManager.Texture(-1));
+                break;
+        }
+    }
+
+    bindings.Bind(textures, textureRevision);
+}
+
+void Renderer::ReleaseTextures()
+{
+    ReleaseTextures(programTextures);
+}
+
+void Renderer::ReleaseTextures(TextureBindings& bindings)
+{
+    bindings.Release();
+}
+
+void Renderer::UpdateTextureArray()
+{
+    // Packed again after slot changes only.
+    if (textureManager.ArrayTexture() != 0 && textureArrayRevision == textureRevision) {
+        return;
+    }
+
+    textureArrayRevision = textureRevision;
+
+    for (const auto slot : textureManager.UpdateArray())
+    {
+        emit NotifyLogMessage(
+                QString("Texture slot %1 is compressed or differs in size from the first filled slot, its %2 layer is empty.")
+                        .arg(slot)
+                        .arg(GLSL_TEXTURE_ARRAY_NAME)
+        );
+    }
+}
+
+void Renderer::InitVAO()
+{
+    if (!vao) {
+        glGenVertexArrays(1, &vao);
+    }
+
+    glBindVertexArray(vao);
+
+    if (!vertexBuffer) {
+        glGenBuffers(1, &vertexBuffer);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * STRIDE_SIZE * sizeof(GLfloat),
+                 vertices.data(), GL_STATIC_DRAW);
+
+    meshRevision++;
+
+    InitAttribsForVAO(VertexProgram());
+    glBindVertexArray(0);
+}
+
+void Renderer::InitPlaneVAO()
+{
+    if (!planeVAO) {
+        glGenVertexArrays(1, &planeVAO);
+    }
+
+    glBindVertexArray(planeVAO);
+
+    if (!planeVertexBuffer) {
+        glGenBuffers(1, &planeVertexBuffer);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, planeVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, planeVertices.size() * STRIDE_SIZE * sizeof(GLfloat),
+                 planeVertices.data(), GL_STATIC_DRAW);
+
+    InitAttribsForVAO(VertexProgram());
+    glBindVertexArray(0);
+}
+
+void Renderer::InitAttribsForVAO(GLuint vertexProgram)
+{
+    // Vertex Position Attrib
+    auto vPosLocation = glGetAttribLocation(vertexProgram, "position");
+    glEnableVertexAttribArray(vPosLocation);
+    glVertexAttribPointer(vPosLocation, 3, GL_FLOAT, GL_FALSE,
+                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(0));
+
+    // Normal Attrib
+    auto vNormalLocation = glGetAttribLocation(vertexProgram, "normal");
+    glEnableVertexAttribArray(vNormalLocation);
+    glVertexAttribPointer(vNormalLocation, 3, GL_FLOAT, GL_FALSE,
+                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(3));
+
+    // UV Attrib
+    auto vTexUVLocation = glGetAttribLocation(vertexProgram, "uv");
+    glEnableVertexAttribArray(vTexUVLocation);
+    glVertexAttribPointer(vTexUVLocation, 2, GL_FLOAT, GL_FALSE,
+                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(6));
+}
+
+void Renderer::CompileProgram()
+{
+    // Compiled independently, errors of one
+    // don't keep the other program from changing.
+    CompileComputeProgram();
+    DeletePendingStageResults();
+
+    auto editorSources = EditorSources();
+
+    if (hotLiterals)
+    {
+        for (auto& [shaderType, source] : editorSources) {
+            source = HotLiterals::Inject(source, HotLiterals::Find(source), HotLiterals::UniformName(shaderType));
+        }
+    }
+
+    ShaderSources sources;
+
+    if (!PreprocessSources(editorSources, sources)) {
+        return;
+    }
+
+    if (hotLiterals && !ApplyHotLiteralSources(sources)) {
+        return;
+    }
+
+    if (separableStages)
+    {
+        CompilePipelineStages(sources);
+        return;
+    }
+
+    const auto key = programBinaryCache.Key(sources.at(0).second, sources.at(1).second);
+    qint64 compileTime = 0;
+
+    // Previously linked programs are restored without the compiler.
+    auto cachedProgram = programBinaryCache.Load(key, compileTime);
+
+    if (cachedProgram != 0)
+    {
+        programCompiler->Cancel();
+
+        ProgramCompileResult result;
+        result.success = true;
+        result.program = cachedProgram;
+        result.key = key;
+        result.compileTime = compileTime;
+        result.messages << "Shader program restored from the program cache.";
+        ApplyCompileResults({ result });
+
+        emit NotifyLogMessage(
+                QString("Program cache hit, %1 ms compile time saved (%2 of %3 requests, %4 ms saved in total).")
+                        .arg(compileTime)
+                        .arg(programBinaryCache.Hits())
+                        .arg(programBinaryCache.Requests())
+                        .arg(programBinaryCache.SavedTime())
+        );
+
+        return;
+    }
+
+    // Compilation continues in the background, the
+    // current program is used until it's finished.
+    ProgramRequest request;
+    request.sources = sources;
+    request.key = key;
+
+    programCompiler->Compile({ request });
+}
+
+bool Renderer::PreprocessSources(ShaderSources& sources)
+{
+    return PreprocessSources(EditorSources(), sources);
+}
+
+bool Renderer::PreprocessSources(const ShaderSources& editorSources, ShaderSources& sources)
+{
+    int expandedFiles = 0;
+    int cachedFiles = 0;
+
+    for (const auto& [shaderType, source] : editorSources)
+    {
+        try
+        {
+            sources << qMakePair(shaderType, preprocessor.Expand(source));
+            expandedFiles += preprocessor.ExpandedFiles();
+            cachedFiles += preprocessor.CachedFiles();
+
+        }
+        catch (SyntaxErrorException& e)
+        {
+            programCompiler->Cancel();
+            emit NotifyCompileError(MakeCompileError(shaderType, e.what()));
+            return false;
+        }
+    }
+
+    if (expandedFiles > 0 || cachedFiles > 0)
+    {
+        emit NotifyLogMessage(
+                QString("Includes: %1 files expanded, %2 unchanged files from cache.")
+                        .arg(expandedFiles)
+                        .arg(cachedFiles)
+        );
+    }
+
+    return true;
+}
+
+ShaderSources Renderer::EditorSources() const
+{
+    return {
+            qMakePair(ShaderType::VertexShader, vertexShaderSource),
+            qMakePair(ShaderType::FragmentShader, fragmentShaderSource)
+    };
+}
+
+bool Renderer::ApplyHotLiteralSources(const ShaderSources& sources)
+{
+    QString shape;
+
+    for (const auto& [shaderType, source] : sources) {
+        shape += source;
+    }
+
+    // The literals of the editor sources are read again, the
+    // expanded sources already refer to the uniform arrays.
+    std::map<ShaderType, std::vector<float>> values;
+
+    for (const auto& [shaderType, source] : EditorSources()) {
+        values[shaderType] = HotLiterals::Values(HotLiterals::Find(source));
+    }
+
+    // Edits of literal values only reach the uniforms.
+    if (!hotLiteralShape.isEmpty() && shape == hotLiteralShape)
+    {
+        programCompiler->Cancel();
+        pendingHotLiteralShape = shape;
+        pendingHotLiteralValues = values;
+        hotLiteralValues = values;
+        uniformRevision++;
+
+        emit NotifyCompileSuccess("Only literal values changed, applied without compiling.");
+        return false;
+    }
+
+    pendingHotLiteralShape = shape;
+    pendingHotLiteralValues = values;
+    return true;
+}
+
+void Renderer::CompilePipelineStages(const ShaderSources& sources)
+{
+    ProgramRequests requests;
+    QStringList reusedStages;
+    qint64 savedTime = 0;
+
+    for (const auto& [shaderType, source] : sources)
+    {
+        const auto key = programBinaryCache.StageKey(shaderType, source);
+        const auto stageName = shaderType == ShaderType::VertexShader ? "Vertex shader" : "Fragment shader";
+
+        // Unchanged stages stay in the pipeline as they are.
+        if (pipelineActive && programPipeline.StageKey(shaderType) == key)
+        {
+            reusedStages << stageName;
+            savedTime += programPipeline.StageCompileTime(shaderType);
+            continue;
+        }
+
+        qint64 compileTime = 0;
+        auto cachedProgram = programBinaryCache.Load(key, compileTime, true);
+
+        if (cachedProgram != 0)
+        {
+            ProgramCompileResult result;
+            result.success = true;
+            result.program = cachedProgram;
+            result.separable = true;
+            result.stages << shaderType;
+            result.key = key;
+            result.compileTime = compileTime;
+            result.messages << QString("%1 restored from the program cache.").arg(stageName);
+            pendingStageResults << result;
+
+            reusedStages << stageName;
+            savedTime += compileTime;
+            continue;
+        }
+
+        ProgramRequest request;
+        request.sources << qMakePair(shaderType, source);
+        request.separable = true;
+        request.key = key;
+        requests << request;
+    }
+
+    if (!reusedStages.isEmpty())
+    {
+        emit NotifyLogMessage(
+                QString("Separable stages: %1 of %2 stages rebuilt, %3 reused, %4 ms compile time saved.")
+                        .arg(requests.size())
+                        .arg(sources.size())
+                        .arg(reusedStages.join(", "))
+                        .arg(savedTime)
+        );
+    }
+
+    if (requests.isEmpty())
+    {
+        programCompiler->Cancel();
+
+        // Nothing changed at all (i.e. a whitespace only edit).
+        if (pendingStageResults.isEmpty())
+        {
+            emit NotifyCompileSuccess("Shader stages are up to date.");
+            return;
+        }
+
+        const auto results = pendingStageResults;
+        pendingStageResults.clear();
+        ApplyCompileResults(results);
+        return;
+    }
+
+    // Cached stages are held back, the pipeline is only
+    // changed once all rebuilt stages are finished.
+    programCompiler->Compile(requests);
+}
+
+void Renderer::PollProgramCompiler()
+{
+    ProgramCompileResults results;
+
+    if (programCompiler->Poll(results))
+    {
+        for (const auto& result : results)
+        {
+            if (result.success) {
+                programBinaryCache.Store(result.key, result.program, result.compileTime);
+            }
+        }
+
+        results = pendingStageResults + results;
+        pendingStageResults.clear();
+        ApplyCompileResults(results);
+    }
+
+    // Look again shortly, frames are not scheduled otherwise for static scenes.
+    if (programCompiler->Pending()) {
+        QTimer::singleShot(COMPILE_POLL_INTERVAL, this, [this]() { ScheduleFrame(); });
+    }
+}
+
+void Renderer::ApplyCompileResults(const ProgramCompileResults& results)
+{
+    bool failed = false;
+
+    for (const auto& result : results)
+    {
+        for (const auto& message : result.messages) {
+            emit NotifyCompileSuccess(message);
+        }
+
+        if (!result.success)
+        {
+            emit NotifyCompileError(MakeCompileError(result.errorType, result.error));
+            failed = true;
+        }
+    }
+
+    // All or nothing, the current program stays untouched.
+    if (failed || results.isEmpty())
+    {
+        for (const auto& result : results) {
+            glDeleteProgram(result.program);
+        }
+
+        return;
+    }
+
+    if (results.first().separable) {
+        SwapPipelineStages(results);
+
+    } else {
+        SwapProgram(results.first().program);
+    }
+}
+
+void Renderer::SwapProgram(GLuint newProgram)
+{
+    // Programs are unbound after each draw, so the
+    // previous one is released immediately by the driver.
+    glDeleteProgram(program);
+    program = newProgram;
+
+    if (pipelineActive)
+    {
+        programPipeline.Release();
+        pipelineActive = false;
+    }
+
+    ProgramChanged();
+}
+
+void Renderer::SwapPipelineStages(const ProgramCompileResults& results)
+{
+    const auto error = programPipeline.Replace(results);
+
+    // Interface mismatches are reported for the fragment shader,
+    // as its inputs are compared to the vertex shader outputs.
+    if (!error.isEmpty())
+    {
+        emit NotifyCompileError(GLSLCompileError(ShaderType::FragmentShader, error));
+        return;
+    }
+
+    if (!pipelineActive)
+    {
+        glDeleteProgram(program);
+        program = 0;
+        pipelineActive = true;
+    }
+
+    ProgramChanged();
+}
+
+GLSLCompileError Renderer::MakeCompileError(const ShaderType& shaderType, const QString& rawError) const
+{
+    // Errors in included files are reported with their file name.
+    GLSLCompileError error(shaderType, rawError);
+    error.ResolveFiles([this](uint32_t sourceIndex) {
+        return preprocessor.FileName(static_cast<int>(sourceIndex));
+    });
+    return error;
+}
+
+void Renderer::DeletePendingStageResults()
+{
+    for (const auto& result : pendingStageResults) {
+        glDeleteProgram(result.program);
+    }
+
+    pendingStageResults.clear();
+}
+
+void Renderer::ProgramChanged()
+{
+    programRevision++;
+    timeUniformActive = false;
+
+    // Literal values belong to the sources of the new program.
+    hotLiteralShape = pendingHotLiteralShape;
+    hotLiteralValues = pendingHotLiteralValues;
+    mousePosUniformActive = false;
+
+    for (const auto activeProgram : ActivePrograms())
+    {
+        timeUniformActive |= glGetUniformLocation(activeProgram, "time") != -1;
+        mousePosUniformActive |= glGetUniformLocation(activeProgram, "mousePos") != -1;
+    }
+
+    // Reflected before any user value is applied, so the
+    // panel receives the initial values of the source.
+    uniforms = uniformReflection.Reflect(ActivePrograms());
+    emit NotifyUniformsReflected(uniforms);
+
+    AssignTextures(programTextures, ActivePrograms(), { vertexShaderSource, fragmentShaderSource });
+
+    InitVAO();
+    InitPlaneVAO();
+    InvalidateFrameHistory();
+}
+
+void Renderer::UseProgram()
+{
+    if (pipelineActive) {
+        programPipeline.Bind();
+
+    } else {
+        glUseProgram(program);
+    }
+}
+
+void Renderer::ReleaseProgram()
+{
+    glUseProgram(0);
+    glBindProgramPipeline(0);
+}
+
+QList<GLuint> Renderer::ActivePrograms() const
+{
+    if (pipelineActive) {
+        return programPipeline.Programs();
+    }
+
+    return { program };
+}
+
+GLuint Renderer::VertexProgram() const
+{
+    // Attributes are vertex stage inputs.
+    return pipelineActive ? programPipeline.StageProgram(ShaderType::VertexShader) : program;
+}
+
+void Renderer::ApplyUniforms(float time, const glm::vec2& jitter)
+{
+    ApplyUniforms(ActivePrograms(), time, jitter);
+}
+
+void Renderer::ApplyUniforms(const QList<GLuint>& programs, float time, const glm::vec2& jitter)
+{
+    // TODO Lights, math constants, camera position etc.
+
+    // Sub-pixel jitter is applied in clip space, so it
+    // works for perspective and plane 2D matrices alike.
+    // Compute dispatches may run before the first resize.
+    const auto size = state.framebufferSize;
+    auto projection = glm::make_mat4(GetProjectionMatrix());
+
+    if (!size.isEmpty() && jitter != glm::vec2(0.0f))
+    {
+        const auto jitterMatrix = glm::translate(glm::mat4(1.0f), glm::vec3(
+                2.0f * jitter.x / static_cast<float>(size.width()),
+                2.0f * jitter.y / static_cast<float>(size.height()),
+                0.0f
+        ));
+
+        projection = jitterMatrix * projection;
+    }
+
+    // Apply Uniform Data (to each stage program of a pipeline)
+    for (const auto activeProgram : programs)
+    {
+        auto timeLocation = glGetUniformLocation(activeProgram, "time");
+        auto resolutionLocation = glGetUniformLocation(activeProgram, "resolution");
+        auto mousePosLocation = glGetUniformLocation(activeProgram, "mousePos");
+        auto jitterLocation = glGetUniformLocation(activeProgram, "jitter");
+        auto modelMatLocation = glGetUniformLocation(activeProgram, "modelMat");
+        auto viewMatLocation = glGetUniformLocation(activeProgram, "viewMat");
+        auto projectionMatLocation = glGetUniformLocation(activeProgram, "projectionMat");
+
+        glProgramUniform1f(activeProgram, timeLocation, time);
+        glProgramUniform2fv(activeProgram, resolutionLocation, 1, glm::value_ptr(state.resolution));
+        glProgramUniform2fv(activeProgram, mousePosLocation, 1, glm::value_ptr(state.mousePos));
+        glProgramUniform2fv(activeProgram, jitterLocation, 1, glm::value_ptr(jitter));
+        glProgramUniformMatrix4fv(activeProgram, modelMatLocation, 1, GL_FALSE, GetModelMatrix());
+        glProgramUniformMatrix4fv(activeProgram, viewMatLocation, 1, GL_FALSE, GetViewMatrix());
+        glProgramUniformMatrix4fv(activeProgram, projectionMatLocation, 1, GL_FALSE, glm::value_ptr(projection));
+
+        ApplyUserUniforms(activeProgram);
+        ApplyHotLiterals(activeProgram);
+    }
+}
+
+void Renderer::ApplyUserUniforms(GLuint targetProgram)
+{
+    if (uniformValues.isEmpty()) {
+        return;
+    }
+
+    for (const auto& uniform : uniforms)
+    {
+        const auto it = uniformValues.constFind(uniform.name);
+
+        if (it != uniformValues.constEnd()) {
+            uniformReflection.Apply(targetProgram, uniform, it.value());
+        }
+    }
+}
+
+void Renderer::ApplyHotLiterals(GLuint targetProgram)
+{
+    for (const auto& [shaderType, values] : hotLiteralValues)
+    {
+        if (values.empty()) {
+            continue;
+        }
+
+        const auto location = glGetUniformLocation(targetProgram, HotLiterals::UniformName(shaderType).toStdString().c_str());
+
+        if (location != -1) {
+            glProgramUniform1fv(targetProgram, location, static_cast<GLsizei>(values.size()), values.data());
+        }
+    }
+}
+
+void Renderer::DrawVAO()
+{
+    if (state.plane2D) {
+        return;
+    }
+
+    glBindVertexArray(vao);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
+    glBindVertexArray(0);
+}
+
+void Renderer::DrawPlaneVAO()
+{
+    if (!state.plane2D) {
+        return;
+    }
+
+    glBindVertexArray(planeVAO);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(planeVertices.size()));
+    glBindVertexArray(0);
+}
+
+void Renderer::DrawPlaneVAOTiles()
+{
+    progressiveFBO->bind();
+    glViewport(0, 0, progressiveFBO->width(), progressiveFBO->height());
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_SCISSOR_TEST);
+
+    UseProgram();
+    ApplyUniforms(progressiveTime);
+    BindTextures();
+
+    glBindVertexArray(planeVAO);
+
+    QElapsedTimer sliceTimer;
+    sliceTimer.start();
+
+    while (!tileScheduler.Finished() && sliceTimer.elapsed() < PROGRESSIVE_SLICE_BUDGET)
+    {
+        const auto tile = tileScheduler.NextTile();
+        glScissor(tile.x(), tile.y(), tile.width(), tile.height());
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(planeVertices.size()));
+
+        // Wait for each tile, so the slice budget reflects the real GPU
+        // workload and the driver never sees one long running batch.
+        glFinish();
+    }
+
+    glBindVertexArray(0);
+    ReleaseProgram();
+    ReleaseTextures();
+
+    glDisable(GL_SCISSOR_TEST);
+    glEnable(GL_DEPTH_TEST);
+}
+
+void Renderer::CompileComputeProgram()
+{
+    if (!computeStage.Settings().enabled || computeShaderSource.trimmed().isEmpty()) {
+        return;
+    }
+
+    QString source;
+
+    try
+    {
+        source = preprocessor.Expand(computeShaderSource);
+
+    }
+    catch (SyntaxErrorException& e)
+    {
+        computeCompiler->Cancel();
+        computeRequestKey = 0;
+        emit NotifyCompileError(MakeCompileError(ShaderType::ComputeShader, e.what()));
+        return;
+    }
+
+    const auto key = programBinaryCache.StageKey(ShaderType::ComputeShader, source);
+
+    // Unchanged compute shaders are neither compiled nor restored.
+    if (key == computeStage.ProgramKey())
+    {
+        computeCompiler->Cancel();
+        computeRequestKey = 0;
+        return;
+    }
+
+    if (key == computeRequestKey && computeCompiler->Pending()) {
+        return;
+    }
+
+    qint64 compileTime = 0;
+    auto cachedProgram = programBinaryCache.Load(key, compileTime);
+
+    if (cachedProgram != 0)
+    {
+        computeCompiler->Cancel();
+        computeRequestKey = 0;
+
+        ProgramCompileResult result;
+        result.success = true;
+        result.program = cachedProgram;
+        result.key = key;
+        result.messages << "Compute shader restored from the program cache.";
+        ApplyComputeResult(result);
+        return;
+    }
+
+    ProgramRequest request;
+    request.sources = { qMakePair(ShaderType::ComputeShader, source) };
+    request.key = key;
+
+    computeRequestKey = key;
+    computeCompiler->Compile({ request });
+}
+
+void Renderer::PollComputeCompiler()
+{
+    ProgramCompileResults results;
+
+    if (computeCompiler->Poll(results))
+    {
+        computeRequestKey = 0;
+
+        for (const auto& result : results)
+        {
+            if (result.success) {
+                programBinaryCache.Store(result.key, result.program, result.compileTime);
+            }
+
+            ApplyComputeResult(result);
+        }
+    }
+
+    if (computeCompiler->Pending()) {
+        QTimer::singleShot(COMPILE_POLL_INTERVAL, this, [this]() { ScheduleFrame(); });
+    }
+}
+
+void Renderer::ApplyComputeResult(const ProgramCompileResult& result)
+{
+    // The previous compute program stays active on errors.
+    if (!result.success)
+    {
+        glDeleteProgram(result.program);
+        emit NotifyCompileError(MakeCompileError(result.errorType, result.error));
+        return;
+    }
+
+    computeStage.SwapProgram(result.program, result.key);
+    AssignTextures(computeTextures, { result.program }, { computeShaderSource });
+    computeTimeUniformActive = glGetUniformLocation(result.program, "time") != -1;
+    computeDispatchRequested = true;
+    computeRevision++;
+
+    for (const auto& message : result.messages) {
+        emit NotifyComputeCompiled(message);
+    }
+}
+
+void Renderer::RunCompute()
+{
+    if (computeStage.PollTimings()) {
+        EmitComputeTimings();
+    }
+
+    if (computeStage.Active())
+    {
+        // Compute shaders share time, mouse position,
+        // textures and uniforms with the draw programs.
+        Hash hash;
+        hash.Add(computeStage.Program())
+            .Add(textureRevision).Add(uniformRevision)
+            .Add(state.mousePos.x).Add(state.mousePos.y)
+            .Add(state.framebufferSize.width())
+            .Add(state.framebufferSize.height());
+
+        if (computeTimeUniformActive) {
+            hash.Add(renderTime);
+        }
+
+        const auto inputsChanged = computeStage.Settings().everyFrame && hash.Value() != computeInputsHash;
+
+        if (computeDispatchRequested || inputsChanged)
+        {
+            const auto computeProgram = computeStage.Program();
+
+            ApplyUniforms({ computeProgram }, renderTime, glm::vec2(0.0f));
+            BindTextures(computeTextures);
+            computeStage.Dispatch();
+            ReleaseTextures(computeTextures);
+
+            computeInputsHash = hash.Value();
+            computeRevision++;
+        }
+    }
+
+    computeDispatchRequested = false;
+
+    // Query results arrive a few frames later, look again for static scenes.
+    if (computeStage.TimingsPending()) {
+        QTimer::singleShot(COMPILE_POLL_INTERVAL, this, [this]() { ScheduleFrame(); });
+    }
+}
+
+void Renderer::EmitComputeTimings()
+{
+    // Throttled for animations, one update per dispatch would flood the GUI thread.
+    if (Animated() && computeTimingsTimer.isValid()
+        && computeTimingsTimer.elapsed() < COMPUTE_TIMINGS_INTERVAL)
+    {
+        return;
+    }
+
+    computeTimingsTimer.start();
+
+    emit NotifyComputeTimings(computeStage.LastTime(),
+                              computeStage.MedianTime(),
+                              computeStage.Dispatches());
+}
+
+bool Renderer::ComputeAnimated() const
+{
+    return computeStage.Active()
+           && computeStage.Settings().everyFrame
+           && computeTimeUniformActive;
+}
+
+void Renderer::PollPermutationCompiler()
+{
+    ProgramCompileResults results;
+
+    if (permutationCompiler->Poll(results))
+    {
+        for (const auto& result : results)
+        {
+            auto& permutation = permutationResults[static_cast<int>(result.key)];
+            permutation.success = result.success;
+            permutation.compileTime = result.compileTime;
+            permutation.linkTime = result.linkTime;
+
+            if (!result.success)
+            {
+                auto error = MakeCompileError(result.errorType, result.error);
+                permutation.error = QString("%1 line %2: %3")
+                        .arg(Shader::ShaderTypeToString(result.errorType))
+                        .arg(error.Line())
+                        .arg(error.Message());
+                continue;
+            }
+
+            if (permutationBenchmark) {
+                permutationBenchmarks.emplace_back(permutation.index, result.program);
+
+            } else {
+                glDeleteProgram(result.program);
+            }
+        }
+
+        if (permutationBenchmarks.empty()) {
+            FinishPermutations();
+        }
+    }
+
+    if (permutationCompiler->Pending() || !permutationBenchmarks.empty()) {
+        QTimer::singleShot(COMPILE_POLL_INTERVAL, this, [this]() { ScheduleFrame(); });
+    }
+}
+
+void Renderer::BenchmarkNextPermutation()
+{
+    // One variant at a time, so the viewport stays responsive.
+    if (permutationBenchmarks.empty()) {
+        return;
+    }
+
+    const auto [index, benchmarkProgram] = permutationBenchmarks.front();
+    double frameTime = -1.0;
+
+    // Results are read on later frames, the GPU is never waited for.
+    if (!benchmarkQueriesIssued)
+    {
+        if (BenchmarkProgram(benchmarkProgram)) {
+            return;
+        }
+
+    } else if (!ReadBenchmarkQueries(frameTime)) {
+        return;
+    }
+
+    permutationResults[index].frameTime = frameTime;
+    permutationBenchmarks.pop_front();
+    glDeleteProgram(benchmarkProgram);
+
+    if (permutationBenchmarks.empty()) {
+        FinishPermutations();
+    }
+}
+
+bool Renderer::BenchmarkProgram(GLuint benchmarkProgram)
+{
+    if (state.framebufferSize.isEmpty()) {
+        return false;
+    }
+
+    if (benchmarkFBO == nullptr || benchmarkFBO->size() != state.framebufferSize)
+    {
+        Memory::Release(benchmarkFBO);
+
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setInternalTextureFormat(GL_RGBA8);
+
+        benchmarkFBO = new QOpenGLFramebufferObject(state.framebufferSize, format);
+    }
+
+    benchmarkFBO->bind();
+    glViewport(0, 0, benchmarkFBO->width(), benchmarkFBO->height());
+
+    // Attribute locations may differ between the variants.
+    const auto benchmarkBuffer = state.plane2D ? planeVertexBuffer : vertexBuffer;
+    const auto vertexCount = static_cast<GLsizei>(state.plane2D ? planeVertices.size() : vertices.size());
+
+    GLuint benchmarkVAO = 0;
+    glGenVertexArrays(1, &benchmarkVAO);
+    glBindVertexArray(benchmarkVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, benchmarkBuffer);
+    InitAttribsForVAO(benchmarkProgram);
+
+    glUseProgram(benchmarkProgram);
+    ApplyUniforms({ benchmarkProgram }, renderTime, glm::vec2(0.0f));
+    AssignTextures(benchmarkTextures, { benchmarkProgram }, { vertexShaderSource, fragmentShaderSource });
+    BindTextures(benchmarkTextures);
+
+    // The first draw may include deferred driver work.
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
+    glGenQueries(BENCHMARK_FRAMES, benchmarkQueries.data());
+    benchmarkQueriesIssued = true;
+
+    for (const auto query : benchmarkQueries)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+        glEndQuery(GL_TIME_ELAPSED);
+    }
+
+    glBindVertexArray(0);
+    glDeleteVertexArrays(1, &benchmarkVAO);
+    ReleaseProgram();
+    ReleaseTextures(benchmarkTextures);
+    benchmarkFBO->release();
+
+    // Submitted now, the results are polled with the next frames.
+    glFlush();
+
+    return true;
+}
+
+bool Renderer::ReadBenchmarkQueries(double& frameTime)
+{
+    for (const auto query : benchmarkQueries)
+    {
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (!available) {
+            return false;
+        }
+    }
+
+    std::array<double, BENCHMARK_FRAMES> frameTimes{};
+
+    for (int i = 0; i < BENCHMARK_FRAMES; i++)
+    {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(benchmarkQueries.at(i), GL_QUERY_RESULT, &elapsed);
+        frameTimes.at(i) = static_cast<double>(elapsed) / 1000000.0;
+    }
+
+    DeleteBenchmarkQueries();
+
+    // Median, single stalls of the driver are ignored.
+    const auto median = frameTimes.begin() + BENCHMARK_FRAMES / 2;
+    std::nth_element(frameTimes.begin(), median, frameTimes.end());
+    frameTime = *median;
+
+    return true;
+}
+
+void Renderer::DeleteBenchmarkQueries()
+{
+    if (!benchmarkQueriesIssued) {
+        return;
+    }
+
+    glDeleteQueries(BENCHMARK_FRAMES, benchmarkQueries.data());
+    benchmarkQueries.fill(0);
+    benchmarkQueriesIssued = false;
+}
+
+void Renderer::ProfileNextTileFrame()
+{
+    if (tileProfileFrames <= 0) {
+        return;
+    }
+
+    if (!state.plane2D || (!pipelineActive && program == 0) || tileTimings.Empty() || state.framebufferSize != tileTimings.Size())
+    {
+        emit NotifyLogMessage("Tile profile cancelled, it requires Plane 2D, a linked program and a constant viewport size.");
+        DeleteTileProfile();
+        return;
+    }
+
+    if (tileProfileFBO == nullptr)
+    {
+        QOpenGLFramebufferObjectFormat format;
+        format.setAttachment(QOpenGLFramebufferObject::CombinedDepthStencil);
+        format.setInternalTextureFormat(GL_RGBA8);
+
+        tileProfileFBO = new QOpenGLFramebufferObject(state.framebufferSize, format);
+    }
+
+    const auto tileCount = tileTimings.TileCount();
+
+    if (static_cast<int>(tileQueries.size()) != tileCount)
+    {
+        glDeleteQueries(static_cast<GLsizei>(tileQueries.size()), tileQueries.data());
+        tileQueries.assign(tileCount, 0);
+        glGenQueries(tileCount, tileQueries.data());
+    }
+
+    tileProfileFBO->bind();
+    glViewport(0, 0, tileProfileFBO->width(), tileProfileFBO->height());
+    glDisable(GL_DEPTH_TEST);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+
+    UseProgram();
+    ApplyUniforms(renderTime);
+    BindTextures();
+    glBindVertexArray(planeVAO);
+    glFinish();
+
+    // Tiles are finished one by one, so neither the queries nor the
+    // wall clock include work of other tiles. Software renderers
+    // execute the draws on flush, their queries are unreliable.
+    const auto gpuTimer = tileTimings.Timer() == TileTimings::TIMER::GPU;
+    QElapsedTimer tileTimer;
+
+    for (int i = 0; i < tileCount; i++)
+    {
+        const auto tile = tileTimings.TileRect(i);
+        glScissor(tile.x(), tile.y(), tile.width(), tile.height());
+
+        tileTimer.start();
+        glBeginQuery(GL_TIME_ELAPSED, tileQueries.at(i));
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(planeVertices.size()));
+        glEndQuery(GL_TIME_ELAPSED);
+        glFinish();
+
+        if (!gpuTimer) {
+            tileTimings.AddSample(i, static_cast<double>(tileTimer.nsecsElapsed()) / 1000000.0);
+        }
+    }
+
+    if (gpuTimer)
+    {
+        for (int i = 0; i < tileCount; i++)
+        {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(tileQueries.at(i), GL_QUERY_RESULT, &elapsed);
+            tileTimings.AddSample(i, static_cast<double>(elapsed) / 1000000.0);
+        }
+    }
+
+    glBindVertexArray(0);
+    ReleaseProgram();
+    ReleaseTextures();
+
+    glDisable(GL_SCISSOR_TEST);
+    glEnable(GL_DEPTH_TEST);
+    tileProfileFBO->release();
+
+    // One grid per frame, the viewport stays responsive in between.
+    if (--tileProfileFrames > 0)
+    {
+        ScheduleFrame();
+        return;
+    }
+
+    FinishTileProfile();
+}
+
+void Renderer::FinishTileProfile()
+{
+    emit NotifyTileProfile(tileTimings);
+
+    emit NotifyLogMessage(
+            QString("Tile profile: %1 x %2 tiles, %3 ms per frame (median), slowest tile %4 ms, %5 timer.")
+                    .arg(tileTimings.Columns())
+                    .arg(tileTimings.Rows())
+                    .arg(tileTimings.TotalMedian(), 0, 'f', 3)
+                    .arg(tileTimings.MaxMedian(), 0, 'f', 3)
+                    .arg(tileTimings.Timer() == TileTimings::TIMER::GPU ? "GPU" : "CPU")
+    );
+
+    DeleteTileProfile();
+}
+
+void Renderer::DeleteTileProfile()
+{
+    glDeleteQueries(static_cast<GLsizei>(tileQueries.size()), tileQueries.data());
+    tileQueries.clear();
+    tileProfileFrames = 0;
+
+    Memory::Release(tileProfileFBO);
+    tileProfileFBO = nullptr;
+}
+
+bool Renderer::SoftwareRenderer()
+{
+    const auto renderer = QString(reinterpret_cast<const char*>(glGetString(GL_RENDERER))).toLower();
+
+    return renderer.contains("llvmpipe")
+           || renderer.contains("softpipe")
+           || renderer.contains("software");
+}
+
+void Renderer::FinishPermutations()
+{
+    const auto succeeded = std::count_if(permutationResults.begin(), permutationResults.end(), [](const auto& result) {
+        return result.success;
+    });
+
+    emit NotifyLogMessage(
+            QString("Permutations: %1 of %2 variants compiled, %3 failed.")
+                    .arg(succeeded)
+                    .arg(permutationResults.size())
+                    .arg(permutationResults.size() - succeeded)
+    );
+
+    emit NotifyPermutationResults(permutationResults);
+}
+
+void Renderer::DeletePermutationBenchmarks()
+{
+    DeleteBenchmarkQueries();
+
+    for (const auto& [index, benchmarkProgram] : permutationBenchmarks) {
+        glDeleteProgram(benchmarkProgram);
+    }
+
+    permutationBenchmarks.clear();
+}
@@ -0,0 +1,432 @@
+/**
+ * Renderer Class
+ *
+ * Owns all viewport GL resources and renders on its own
+ * thread with a context shared with the viewport. The UI
+ * thread talks to it through commands and a render state,
+ * finished frames are handed over by the FrameExchange.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_RENDERER_HPP
+#define SHADERIDE_GL_RENDERER_HPP
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <vector>
+#include <QObject>
+#include <QThread>
+#include <QThreadPool>
+#include <QMutex>
+#include <QHash>
+#include <QImage>
+#include <QStringList>
+#include <QSize>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include <QtOpenGL/QOpenGLFramebufferObject>
+#include <glm/glm.hpp>
+#include "src/Core/ApplicationDefaults.hpp"
+#include "src/GL/World/Vertex.hpp"
+#include "src/GL/GLDefaults.hpp"
+#include "src/GL/Shader.hpp"
+#include "src/GL/GLSLCompileError.hpp"
+#include "src/GL/ScreenQuad.hpp"
+#include "src/GL/TileScheduler.hpp"
+#include "src/GL/TileTimings.hpp"
+#include "src/GL/TextureManager.hpp"
+#include "src/GL/TextureStreamer.hpp"
+#include "src/GL/TextureBindings.hpp"
+#include "src/GL/TilePyramid.hpp"
+#include "src/GL/FrameExchange.hpp"
+#include "src/GL/RenderCommandQueue.hpp"
+#include "src/GL/ProgramCompiler.hpp"
+#include "src/GL/ProgramBinaryCache.hpp"
+#include "src/GL/ProgramPipeline.hpp"
+#include "src/GL/GLSLPreprocessor.hpp"
+#include "src/GL/PermutationCompiler.hpp"
+#include "src/GL/ShaderPermutations.hpp"
+#include "src/GL/UniformReflection.hpp"
+#include "src/GL/HotLiterals.hpp"
+#include "src/GL/ComputeStage.hpp"
+
+namespace ShaderIDE::GL {
+
+    struct RenderState
+    {
+        glm::mat4 modelMatrix{ glm::mat4(1.0f) };
+        glm::mat4 viewMatrix{ glm::mat4(1.0f) };
+        glm::mat4 projectionMatrix{ glm::mat4(1.0f) };
+        glm::vec2 mousePos{ glm::vec2(0.0f) };
+        glm::vec2 resolution{ glm::vec2(0.0f) };
+        QSize framebufferSize;
+        int samples{ 0 };
+        bool realtime{ false };
+        bool plane2D{ false };
+        bool progressive{ false };
+        bool accumulation{ false };
+    };
+
+    class Renderer : public QObject, protected QOpenGLFunctions_4_5_Core
+    {
+        Q_OBJECT
+
+        static constexpr uint8_t STRIDE_SIZE = 8;
+        static constexpr int PROGRESSIVE_TILE_SIZE = 64;
+        static constexpr qint64 PROGRESSIVE_SLICE_BUDGET = 12; // Milliseconds
+        static constexpr int ACCUMULATION_MAX_FRAMES = 64;
+        static constexpr int FRAME_STATISTICS_INTERVAL = 10000; // Milliseconds
+        static constexpr int COMPILE_POLL_INTERVAL = 4; // Milliseconds
+        static constexpr int BENCHMARK_FRAMES = 16;
+        static constexpr int COMPUTE_TIMINGS_INTERVAL = 250; // Milliseconds
+        static constexpr int TILE_PROFILE_SIZE = 64;
+        static constexpr int TILE_PROFILE_FRAMES = 9;
+
+    public:
+        explicit Renderer(QOpenGLContext* shareContext);
+        ~Renderer() override;
+
+        void Start(QThread* renderThread);
+        void Stop();
+
+        FrameExchange& Frames();
+
+        // Commands (thread safe)
+        void SetState(const RenderState& newState);
+        void SetVertexShaderSource(const QString& source);
+        void SetFragmentShaderSource(const QString& source);
+        void CompileShaders();
+        void SetSeparableStages(bool enabled);
+        void SetIncludeDirectory(const QString& directory);
+        void BuildPermutations(const QList<PermutationDefines>& permutations, bool benchmark);
+        void SetUniformValue(const QString& name, const glm::vec4& value);
+        void ClearUniformValues();
+        void SetHotLiterals(bool enabled);
+        void SetHotLiteral(const ShaderType& shaderType, int index, float value);
+        void SetComputeShaderSource(const QString& source);
+        void SetComputeSettings(const ComputeSettings& settings);
+        void DispatchCompute();
+        void ProfileTiles();
+        void SetMeshVertices(const VertexVec& meshVertices);
+        void SetPlaneVertices(const VertexVec& meshVertices);
+        void SetTexture(int slot, const QImage& upload); // See TextureManager::MakeUploadImage()
+        void SetCompressedTexture(int slot, const CompressedImage& image);
+        void SetStreamedTexture(int slot, const QImage& proxyUpload, const TilePyramid& pyramid);
+        void ClearTexture(int slot);
+        void SetTextureSlotCount(int count);
+        void SetTextureMemoryLimit(qint64 bytes); // Per slot, for streamed textures
+        void FramePresented();
+
+    signals:
+        void NotifyInitialized();
+        void NotifyFrameReady();
+        void NotifyCompileSuccess(const QString& message);
+        void NotifyCompileError(const GLSLCompileError& error);
+        void NotifyStateUpdated(const QString& message);
+        void NotifyLogMessage(const QString& message);
+        void NotifyPermutationResults(const PermutationResults& results);
+        void NotifyUniformsReflected(const ShaderUniforms& uniforms);
+        void NotifyComputeCompiled(const QString& message);
+        void NotifyComputeTimings(double lastTime, double medianTime, int dispatches);
+        void NotifyTileProfile(const TileTimings& timings);
+
+    private slots:
+        void OnInitialize();
+        void OnShutdown();
+        void OnFrame();
+        void OnLogFrameStatistics();
+
+    private:
+        QOpenGLContext* context{ nullptr };
+        QOffscreenSurface* surface{ nullptr };
+        bool initialized{ false };
+
+        // Commands & State
+        RenderCommandQueue commandQueue;
+        QMutex stateMutex;
+        RenderState pendingState;
+        bool pendingStateChanged{ false };
+        RenderState state;
+        glm::mat4 identityMatrix{ glm::mat4(1.0f) };
+        std::atomic<bool> frameScheduled{ false };
+        std::atomic<bool> compileRequested{ false };
+        std::atomic<bool> continuationRequired{ false };
+
+        // Program & Meshes
+        // The program is only replaced by successfully linked programs.
+        ProgramCompiler* programCompiler{ nullptr };
+        ProgramBinaryCache programBinaryCache;
+        GLuint program{ 0 };
+
+        // Separable Stages
+        // Only stages with changed sources are rebuilt.
+        ProgramPipeline programPipeline;
+        bool separableStages{ false };
+        bool pipelineActive{ false };
+        ProgramCompileResults pendingStageResults; // Cached stages, held until the rebuilt ones are finished.
+        QString vertexShaderSource{ "" };
+        QString fragmentShaderSource{ "" };
+        GLSLPreprocessor preprocessor;
+
+        // Shader Permutations
+        // Successfully linked variants are benchmarked one after another,
+        // the timer queries of the front variant are polled on later frames.
+        PermutationCompiler* permutationCompiler{ nullptr };
+        PermutationResults permutationResults;
+        std::deque<std::pair<int, GLuint>> permutationBenchmarks;
+        std::array<GLuint, BENCHMARK_FRAMES> benchmarkQueries{};
+        bool benchmarkQueriesIssued{ false };
+        bool permutationBenchmark{ false };
+        QOpenGLFramebufferObject* benchmarkFBO{ nullptr };
+
+        GLuint vao{ 0 };
+        GLuint vertexBuffer{ 0 };
+        VertexVec vertices;
+
+        GLuint planeVAO{ 0 };
+        GLuint planeVertexBuffer{ 0 };
+        VertexVec planeVertices;
+
+        bool timeUniformActive{ false };
+        bool mousePosUniformActive{ false };
+
+        // User Uniforms
+        // Values set by the uniform panel, applied without recompiling.
+        UniformReflection uniformReflection;
+        ShaderUniforms uniforms;
+        QHash<QString, glm::vec4> uniformValues;
+
+        // Hot Literals
+        // Float literals are uniform array elements, programs which only
+        // differ in literal values are not compiled again.
+        bool hotLiterals{ false };
+        QString hotLiteralShape{ "" }; // Sources of the active program
+        QString pendingHotLiteralShape{ "" }; // Sources of the requested program
+        std::map<ShaderType, std::vector<float>> hotLiteralValues;
+        std::map<ShaderType, std::vector<float>> pendingHotLiteralValues;
+
+        // Compute Shader
+        // Dispatched before the frame, the first image is sampled as computeOutput.
+        ProgramCompiler* computeCompiler{ nullptr };
+        ComputeStage computeStage;
+        QString computeShaderSource{ "" };
+        uint64_t computeRequestKey{ 0 }; // Key of the program being compiled
+        uint64_t computeInputsHash{ 0 };
+        bool computeTimeUniformActive{ false };
+        bool computeDispatchRequested{ false };
+        QElapsedTimer computeTimingsTimer;
+
+        // Tile Profiling
+        // Plane 2D is drawn tile by tile into an offscreen
+        // buffer, each tile is timed with its own query.
+        TileTimings tileTimings;
+        std::vector<GLuint> tileQueries;
+        int tileProfileFrames{ 0 }; // Remaining frames
+        QOpenGLFramebufferObject* tileProfileFBO{ nullptr };
+
+        // Texture Slots
+        // Samplers get their units (or bindless handles) once after linking.
+        TextureManager textureManager{ GLSL_TEXTURE_SLOTS_DEFAULT };
+        TextureStreamer textureStreamer;
+        std::array<uint64_t, GLSL_TEXTURE_SLOTS_MAX> textureSerials{}; // Latest image of each slot
+        TextureBindings programTextures;
+        TextureBindings computeTextures;
+        TextureBindings benchmarkTextures;
+        QThreadPool transcodePool; // Compressed formats without driver support
+        uint32_t textureArrayRevision{ 0 };
+
+        // Tiled Streaming
+        // Streamed slots start with a proxy, the pyramid level the viewport
+        // needs is then read from disk tile by tile, within the memory limit.
+        struct StreamedSlot
+        {
+            TilePyramid pyramid;
+            uint64_t serial{ 0 };
+            uint64_t load{ 0 }; // Tiles of earlier loads are dropped
+            int level{ 0 }; // Resident level
+            int proxyLevel{ 0 };
+            int pendingTiles{ 0 };
+            int missingTiles{ 0 };
+        };
+
+        std::map<int, StreamedSlot> streamedSlots;
+        QList<int> refinedSlots; // Mipmaps are generated once per frame
+        QThreadPool tilePool;
+        qint64 textureMemoryLimit{ static_cast<qint64>(SHADERIDE_TEXTURE_MEMORY_PER_SLOT) * 1024 * 1024 };
+        uint64_t nextTileLoad{ 0 };
+
+        // Frames
+        FrameExchange frameExchange;
+        std::array<QOpenGLFramebufferObject*, FrameExchange::NUM_FRAMES> frameFBOs{};
+        QOpenGLFramebufferObject* backFBO{ nullptr };
+        ScreenQuad* screenQuad{ nullptr };
+
+        // Multisampling
+        int maxSamples{ 0 };
+        QOpenGLFramebufferObject* multisampleFBO{ nullptr };
+
+        // Progressive Rendering
+        QOpenGLFramebufferObject* progressiveFBO{ nullptr };
+        TileScheduler tileScheduler{ PROGRESSIVE_TILE_SIZE };
+        QElapsedTimer progressivePassTimer;
+        bool progressiveDirty{ true };
+        float progressiveTime{ 0.0f };
+
+        // Temporal Accumulation
+        QOpenGLFramebufferObject* accumulationFBO{ nullptr };
+        QOpenGLFramebufferObject* accumulationSampleFBO{ nullptr };
+        bool accumulationDirty{ true };
+        int accumulationFrame{ 0 };
+
+        // Static Frame Elision
+        uint64_t historyHash{ 0 };
+        uint64_t publishedFrameHash{ 0 };
+        uint32_t programRevision{ 0 };
+        uint32_t meshRevision{ 0 };
+        uint32_t textureRevision{ 0 };
+        uint32_t uniformRevision{ 0 };
+        uint32_t computeRevision{ 0 };
+
+        // Frame Statistics
+        QTimer* frameStatisticsTimer{ nullptr };
+        int renderedFrames{ 0 };
+        int elidedFrames{ 0 };
+
+        // Render Time
+        QElapsedTimer realtimeTimer;
+        float renderTime{ 0.0f };
+
+        // Commands & State
+        void Enqueue(RenderCommand command);
+        void ScheduleFrame();
+        void ApplyPendingState();
+        bool Animated() const;
+
+        // Frames
+        void RenderFrame();
+        void BindBackBuffer();
+        void PublishBackBuffer();
+        void PresentTexture(GLuint texture);
+
+        // Multisampling
+        int EffectiveSamples() const;
+        void PrepareMultisampleFBO();
+        void ResolveMultisampleFBO();
+
+        // Progressive Rendering
+        void PrepareProgressiveFBO();
+        void StartProgressivePass();
+        void PaintProgressive();
+
+        // Temporal Accumulation
+        void PrepareAccumulationFBOs();
+        void PaintAccumulated();
+        glm::vec2 AccumulationJitter() const;
+
+        // Frame History (Progressive & Accumulation)
+        void InvalidateFrameHistory();
+        uint64_t FrameInputsHash(bool includeTime);
+
+        // Value Pointers
+        GLfloat* GetModelMatrix();
+        GLfloat* GetViewMatrix();
+        GLfloat* GetProjectionMatrix();
+
+        // Textures
+        void StreamTexture(int slot, const QImage& upload);
+        void UploadStreamedTexture(int slot, uint64_t serial, const QSize& size, int region);
+        void TextureUploaded(int slot, const QSize& size, bool reused, const QString& upload);
+        void RefineStreamedTextures();
+        void LoadStreamedLevel(int slot, StreamedSlot& streamed, int level);
+        void UploadStreamedTile(int slot, uint64_t serial, uint64_t load, const QRect& rect, const QImage& tile);
+
+        void AssignTextures(TextureBindings& bindings, const QList<GLuint>& programs, const QStringList& sources);
+        void BindTextures();
+        void BindTextures(TextureBindings& bindings);
+        void ReleaseTextures();
+        void ReleaseTextures(TextureBindings& bindings);
+        void UpdateTextureArray();
+
+        // GL
+        void InitVAO();
+        void InitPlaneVAO();
+        void InitAttribsForVAO(GLuint vertexProgram);
+        void CompileProgram();
+        bool PreprocessSources(ShaderSources& sources);
+        bool PreprocessSources(const ShaderSources& editorSources, ShaderSources& sources);
+        ShaderSources EditorSources() const;
+        bool ApplyHotLiteralSources(const ShaderSources& sources);
+        void CompilePipelineStages(const ShaderSources& sources);
+        void PollProgramCompiler();
+        void ApplyCompileResults(const ProgramCompileResults& results);
+        void SwapProgram(GLuint newProgram);
+        void SwapPipelineStages(const ProgramCompileResults& results);
+        GLSLCompileError MakeCompileError(const ShaderType& shaderType, const QString& rawError) const;
+        void DeletePendingStageResults();
+        void ProgramChanged();
+        void UseProgram();
+        void ReleaseProgram();
+        QList<GLuint> ActivePrograms() const;
+        GLuint VertexProgram() const;
+        void ApplyUniforms(float time, const glm::vec2& jitter = glm::vec2(0.0f));
+        void ApplyUniforms(const QList<GLuint>& programs, float time, const glm::vec2& jitter);
+        void ApplyUserUniforms(GLuint targetProgram);
+        void ApplyHotLiterals(GLuint targetProgram);
+        void DrawVAO();
+        void DrawPlaneVAO();
+        void DrawPlaneVAOTiles();
+
+        // Compute Shader
+        void CompileComputeProgram();
+        void PollComputeCompiler();
+        void ApplyComputeResult(const ProgramCompileResult& result);
+        void RunCompute();
+        void EmitComputeTimings();
+        bool ComputeAnimated() const;
+
+        // Tile Profiling
+        void ProfileNextTileFrame();
+        void FinishTileProfile();
+        void DeleteTileProfile();
+        bool SoftwareRenderer();
+
+        // Shader Permutations
+        void PollPermutationCompiler();
+        void BenchmarkNextPermutation();
+        bool BenchmarkProgram(GLuint benchmarkProgram);
+        bool ReadBenchmarkQueries(double& frameTime);
+        void DeleteBenchmarkQueries();
+        void FinishPermutations();
+        void DeletePermutationBenchmarks();
+    };
+}
+
+#endif // SHADERIDE_GL_RENDERER_HPP
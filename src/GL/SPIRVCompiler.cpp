@@ -0,0 +1,204 @@
+/**
+ * SPIRVCompiler Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifdef SHADERIDE_SPIRV_EXPORT
+
+#include <future>
+#include <QElapsedTimer>
+#include <glslang/Public/ShaderLang.h>
+#include <glslang/Public/ResourceLimits.h>
+#include <glslang/SPIRV/GlslangToSpv.h>
+#include "SPIRVCompiler.hpp"
+#include "GLSLFingerprint.hpp"
+#include "src/Core/Hash.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    constexpr int DEFAULT_VERSION = 100;
+
+    QStringList SplitLog(const char* log)
+    {
+        QStringList lines;
+
+        for (const auto& line : QString(log).split('\n'))
+        {
+            if (!line.trimmed().isEmpty()) {
+                lines << line.trimmed();
+            }
+        }
+
+        return lines;
+    }
+}
+
+SPIRVCompiler::SPIRVCompiler()
+{
+    // Reference counted by glslang, may be called per instance.
+    glslang::InitializeProcess();
+}
+
+SPIRVCompiler::~SPIRVCompiler()
+{
+    glslang::FinalizeProcess();
+}
+
+void SPIRVCompiler::SetOptimization(bool enabled)
+{
+    optimization = enabled;
+}
+
+bool SPIRVCompiler::Optimization() const
+{
+    return optimization;
+}
+
+QList<SPIRVResult> SPIRVCompiler::Compile(const ShaderSources& sources)
+{
+    QList<SPIRVResult> results;
+    std::vector<std::future<SPIRVResult>> builds;
+
+    {
+        QMutexLocker locker(&cacheMutex);
+
+        for (const auto& [shaderType, source] : sources)
+        {
+            const auto key = Key(shaderType, source);
+
+            if (cache.contains(key))
+            {
+                auto result = cache.value(key);
+                result.cached = true;
+                results << result;
+                continue;
+            }
+
+            results << SPIRVResult();
+            builds.push_back(std::async(std::launch::async, [this, shaderType = shaderType, source = source]() {
+                return CompileStage(shaderType, source);
+            }));
+        }
+    }
+
+    // Fill in the compiled stages, the cached ones are already in place.
+    auto build = builds.begin();
+
+    for (int i = 0; i < results.size(); i++)
+    {
+        if (results.at(i).cached) {
+            continue;
+        }
+
+        results[i] = (build++)->get();
+
+        // Only valid binaries are cached, diagnostics of failed
+        // stages must be reported again for each export.
+        if (results.at(i).success)
+        {
+            QMutexLocker locker(&cacheMutex);
+
+            if (cache.size() >= MAX_CACHE_ENTRIES) {
+                cache.clear();
+            }
+
+            cache.insert(Key(sources.at(i).first, sources.at(i).second), results.at(i));
+        }
+    }
+
+    return results;
+}
+
+uint64_t SPIRVCompiler::Key(const ShaderType& shaderType, const QString& source) const
+{
+    return Hash()
+            .Add(static_cast<uint64_t>(shaderType))
+            .Add(optimization)
+            .Add(GLSLFingerprint::Compute(source))
+            .Value();
+}
+
+SPIRVResult SPIRVCompiler::CompileStage(const ShaderType& shaderType, const QString& source) const
+{
+    QElapsedTimer compileTimer;
+    compileTimer.start();
+
+    SPIRVResult result;
+    result.shaderType = shaderType;
+
+    const auto language = shaderType == ShaderType::VertexShader ? EShLangVertex : EShLangFragment;
+    const auto messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+    const auto sourceData = source.toUtf8();
+    const char* sourceStrings[] = { sourceData.constData() };
+
+    // Same options as "glslangValidator --auto-map-bindings --auto-map-locations -V".
+    glslang::TShader shader(language);
+    shader.setStrings(sourceStrings, 1);
+    shader.setEnvInput(glslang::EShSourceGlsl, language, glslang::EShClientVulkan, DEFAULT_VERSION);
+    shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
+    shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+    shader.setAutoMapBindings(true);
+    shader.setAutoMapLocations(true);
+
+    const auto parsed = shader.parse(GetDefaultResources(), DEFAULT_VERSION, false, messages);
+    result.diagnostics << SplitLog(shader.getInfoLog()) << SplitLog(shader.getInfoDebugLog());
+
+    if (!parsed)
+    {
+        result.compileTime = compileTimer.elapsed();
+        return result;
+    }
+
+    glslang::TProgram program;
+    program.addShader(&shader);
+
+    const auto linked = program.link(messages) && program.mapIO();
+    result.diagnostics << SplitLog(program.getInfoLog()) << SplitLog(program.getInfoDebugLog());
+
+    if (!linked)
+    {
+        result.compileTime = compileTimer.elapsed();
+        return result;
+    }
+
+    spv::SpvBuildLogger logger;
+    glslang::SpvOptions options;
+    options.disableOptimizer = !optimization;
+    options.validate = true;
+
+    glslang::GlslangToSpv(*program.getIntermediate(language), result.spirv, &logger, &options);
+    result.diagnostics << SplitLog(logger.getAllMessages().c_str());
+
+    result.success = !result.spirv.empty();
+    result.compileTime = compileTimer.elapsed();
+
+    return result;
+}
+
+#endif // SHADERIDE_SPIRV_EXPORT
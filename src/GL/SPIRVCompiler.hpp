@@ -0,0 +1,81 @@
+/**
+ * SPIRVCompiler Class
+ *
+ * In-process GLSL to SPIR-V compilation (glslang), used by the SPIR-V export.
+ * Requires SHADERIDE_SPIRV_EXPORT, see CMakeLists.txt.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_SPIRVCOMPILER_HPP
+#define SHADERIDE_GL_SPIRVCOMPILER_HPP
+
+#include <cstdint>
+#include <vector>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include "ProgramBuild.hpp"
+
+namespace ShaderIDE::GL {
+
+    struct SPIRVResult
+    {
+        ShaderType shaderType{ ShaderType::VertexShader };
+        bool success{ false };
+        bool cached{ false };
+        std::vector<uint32_t> spirv;
+        QStringList diagnostics;
+        qint64 compileTime{ 0 }; // Milliseconds
+    };
+
+    class SPIRVCompiler
+    {
+        static constexpr int MAX_CACHE_ENTRIES = 64;
+
+    public:
+        SPIRVCompiler();
+        ~SPIRVCompiler();
+
+        void SetOptimization(bool enabled);
+        bool Optimization() const;
+
+        // Stages are compiled in parallel, results keep the order of the sources.
+        QList<SPIRVResult> Compile(const ShaderSources& sources);
+
+    private:
+        bool optimization{ false };
+
+        QMutex cacheMutex;
+        QHash<uint64_t, SPIRVResult> cache;
+
+        uint64_t Key(const ShaderType& shaderType, const QString& source) const;
+        SPIRVResult CompileStage(const ShaderType& shaderType, const QString& source) const;
+    };
+}
+
+#endif // SHADERIDE_GL_SPIRVCOMPILER_HPP
@@ -0,0 +1,98 @@
+/**
+ * ScreenQuad Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScreenQuad.hpp"
+#include "GLDefaults.hpp"
+
+using namespace ShaderIDE::GL;
+
+ScreenQuad::ScreenQuad()
+{
+    initializeOpenGLFunctions();
+    InitProgram();
+    InitVAO();
+}
+
+ScreenQuad::~ScreenQuad()
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(program);
+}
+
+void ScreenQuad::Draw(GLuint texture)
+{
+    // The quad covers the whole viewport, depth and stencil
+    // tests would only get in the way here.
+    const auto depthTest = glIsEnabled(GL_DEPTH_TEST);
+    const auto stencilTest = glIsEnabled(GL_STENCIL_TEST);
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_STENCIL_TEST);
+
+    glUseProgram(program);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glUniform1i(glGetUniformLocation(program, GLSL_SCREENQUAD_TEXTURE_NAME), 0);
+
+    glBindVertexArray(vao);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+
+    if (depthTest) {
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    if (stencilTest) {
+        glEnable(GL_STENCIL_TEST);
+    }
+}
+
+void ScreenQuad::InitProgram()
+{
+    program = glCreateProgram();
+
+    vertexShader = Shader::MakeShared(GLSL_SCREENQUAD_VS_SOURCE, ShaderType::VertexShader);
+    fragmentShader = Shader::MakeShared(GLSL_SCREENQUAD_FS_SOURCE, ShaderType::FragmentShader);
+
+    vertexShader->Compile();
+    fragmentShader->Compile();
+
+    glAttachShader(program, vertexShader->Handle());
+    glAttachShader(program, fragmentShader->Handle());
+    glLinkProgram(program);
+}
+
+void ScreenQuad::InitVAO()
+{
+    // The fullscreen triangle is generated from gl_VertexID,
+    // but the core profile still requires a bound VAO.
+    glGenVertexArrays(1, &vao);
+}
@@ -0,0 +1,60 @@
+/**
+ * ScreenQuad Class
+ *
+ * Draws a texture over the whole viewport with a single
+ * fullscreen triangle. Used to present offscreen render
+ * targets on the default framebuffer.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_SCREENQUAD_HPP
+#define SHADERIDE_GL_SCREENQUAD_HPP
+
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "Shader.hpp"
+
+namespace ShaderIDE::GL {
+
+    class ScreenQuad : protected QOpenGLFunctions_4_5_Core
+    {
+    public:
+        ScreenQuad();
+        ~ScreenQuad();
+
+        void Draw(GLuint texture);
+
+    private:
+        GLuint program{ 0 };
+        GLuint vao{ 0 };
+        ShaderSPtr vertexShader;
+        ShaderSPtr fragmentShader;
+
+        void InitProgram();
+        void InitVAO();
+    };
+}
+
+#endif // SHADERIDE_GL_SCREENQUAD_HPP
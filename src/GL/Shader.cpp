@@ -44,6 +44,9 @@ QString Shader::ShaderTypeToString(const ShaderType& shaderType)
 
     } else if (shaderType == ShaderType::FragmentShader) {
         return "Fragment Shader";
+
+    } else if (shaderType == ShaderType::ComputeShader) {
+        return "Compute Shader";
     }
 
     return "Unknown";
@@ -66,7 +69,13 @@ void Shader::SetSource(const QString& source)
     cSource = source.trimmed();
 }
 
-void Shader::Compile(GLuint program)
+void Shader::Compile()
+{
+    BeginCompile();
+    EndCompile();
+}
+
+void Shader::BeginCompile()
 {
     // Apply Source
     auto srcStdStr = cSource.toStdString();
@@ -75,8 +84,16 @@ void Shader::Compile(GLuint program)
 
     // Compile
     glCompileShader(shader);
+}
+
+void Shader::EndCompile()
+{
     HandleCompilationErrors();
-    glAttachShader(program, shader);
+}
+
+GLuint Shader::Handle() const
+{
+    return shader;
 }
 
 void Shader::InitializeShader()
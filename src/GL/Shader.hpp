@@ -46,7 +46,8 @@ namespace ShaderIDE::GL {
 
     enum class ShaderType {
         VertexShader = GL_VERTEX_SHADER,
-        FragmentShader = GL_FRAGMENT_SHADER
+        FragmentShader = GL_FRAGMENT_SHADER,
+        ComputeShader = GL_COMPUTE_SHADER
     };
 
     class Shader : protected QOpenGLFunctions_4_5_Core
@@ -61,7 +62,13 @@ namespace ShaderIDE::GL {
         ~Shader();
 
         void SetSource(const QString& source);
-        void Compile(GLuint program);
+        void Compile();
+
+        // Split compilation, the driver may compile in the background in between.
+        void BeginCompile();
+        void EndCompile();
+
+        GLuint Handle() const;
 
     private:
         GLuint shader{ 0 };
@@ -0,0 +1,167 @@
+/**
+ * ShaderPermutations Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QRegularExpression>
+#include "ShaderPermutations.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    const QRegularExpression AXIS_PATTERN(R"(^\s*([A-Za-z_][A-Za-z0-9_]*)\s*=\s*\{(.*)\}\s*$)");
+    const QRegularExpression VERSION_PATTERN(R"(^\s*#\s*version\b)");
+}
+
+PermutationAxes ShaderPermutations::ParseAxes(const QString& text)
+{
+    PermutationAxes axes;
+    const auto lines = text.split('\n');
+
+    for (int i = 0; i < lines.size(); i++)
+    {
+        const auto line = lines.at(i).trimmed();
+
+        if (line.isEmpty() || line.startsWith("//")) {
+            continue;
+        }
+
+        const auto match = AXIS_PATTERN.match(line);
+
+        if (!match.hasMatch()) {
+            throw GeneralException(QString("Line %1: expected NAME={value, ...}.").arg(i + 1));
+        }
+
+        PermutationAxis axis;
+        axis.name = match.captured(1);
+
+        for (const auto& value : match.captured(2).split(',', Qt::SkipEmptyParts))
+        {
+            if (!value.trimmed().isEmpty()) {
+                axis.values << value.trimmed();
+            }
+        }
+
+        if (axis.values.isEmpty()) {
+            throw GeneralException(QString("Line %1: %2 has no values.").arg(i + 1).arg(axis.name));
+        }
+
+        for (const auto& other : axes)
+        {
+            if (other.name == axis.name) {
+                throw GeneralException(QString("Line %1: %2 is declared twice.").arg(i + 1).arg(axis.name));
+            }
+        }
+
+        axes << axis;
+    }
+
+    return axes;
+}
+
+QList<PermutationDefines> ShaderPermutations::Enumerate(const PermutationAxes& axes)
+{
+    qint64 count = 1;
+
+    for (const auto& axis : axes)
+    {
+        count *= axis.values.size();
+
+        if (count > MAX_PERMUTATIONS)
+        {
+            throw GeneralException(QString("More than %1 permutations, reduce the number of axes or values.")
+                                           .arg(MAX_PERMUTATIONS));
+        }
+    }
+
+    // Cartesian product, the last axis changes fastest.
+    QList<PermutationDefines> permutations{ PermutationDefines() };
+
+    for (const auto& axis : axes)
+    {
+        QList<PermutationDefines> expanded;
+
+        for (const auto& permutation : permutations)
+        {
+            for (const auto& value : axis.values) {
+                expanded << (PermutationDefines(permutation) << qMakePair(axis.name, value));
+            }
+        }
+
+        permutations = expanded;
+    }
+
+    return permutations;
+}
+
+QString ShaderPermutations::ApplyDefines(const QString& source, const PermutationDefines& defines)
+{
+    if (defines.isEmpty()) {
+        return source;
+    }
+
+    auto lines = source.split('\n');
+    int insertAt = 0;
+
+    // #version has to stay the first directive.
+    for (int i = 0; i < lines.size(); i++)
+    {
+        if (VERSION_PATTERN.match(lines.at(i)).hasMatch())
+        {
+            insertAt = i + 1;
+            break;
+        }
+    }
+
+    QStringList injected;
+
+    for (const auto& [name, value] : defines) {
+        injected << QString("#define %1 %2").arg(name, value);
+    }
+
+    // Errors are reported for the editor lines.
+    injected << QString("#line %1 0").arg(insertAt + 1);
+
+    for (int i = 0; i < injected.size(); i++) {
+        lines.insert(insertAt + i, injected.at(i));
+    }
+
+    return lines.join('\n');
+}
+
+QString ShaderPermutations::Name(const PermutationDefines& defines)
+{
+    QStringList parts;
+
+    for (const auto& [name, value] : defines) {
+        parts << QString("%1=%2").arg(name, value);
+    }
+
+    return parts.isEmpty() ? QString("(default)") : parts.join(" ");
+}
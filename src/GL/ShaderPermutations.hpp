@@ -0,0 +1,83 @@
+/**
+ * ShaderPermutations Class
+ *
+ * Define axes (i.e. USE_SHADOWS={0,1}) and the variants
+ * generated from them, one for each combination of values.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_SHADERPERMUTATIONS_HPP
+#define SHADERIDE_GL_SHADERPERMUTATIONS_HPP
+
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QMetaType>
+
+namespace ShaderIDE::GL {
+
+    struct PermutationAxis
+    {
+        QString name{ "" };
+        QStringList values;
+    };
+
+    using PermutationAxes = QList<PermutationAxis>;
+    using PermutationDefines = QList<QPair<QString, QString>>;
+
+    struct PermutationResult
+    {
+        int index{ 0 };
+        PermutationDefines defines;
+        bool success{ false };
+        qint64 compileTime{ 0 }; // Milliseconds
+        qint64 linkTime{ 0 }; // Milliseconds
+        double frameTime{ -1.0 }; // Milliseconds, negative if not benchmarked
+        QString error{ "" };
+    };
+
+    using PermutationResults = QList<PermutationResult>;
+
+    class ShaderPermutations
+    {
+    public:
+        static constexpr int MAX_PERMUTATIONS = 256;
+
+        // One axis per line: NAME={value, value, ...}
+        static PermutationAxes ParseAxes(const QString& text);
+        static QList<PermutationDefines> Enumerate(const PermutationAxes& axes);
+
+        // Defines are inserted after #version, line numbers are kept.
+        static QString ApplyDefines(const QString& source, const PermutationDefines& defines);
+        static QString Name(const PermutationDefines& defines);
+    };
+}
+
+// Results are emitted by the render thread.
+Q_DECLARE_METATYPE(ShaderIDE::GL::PermutationResults)
+
+#endif // SHADERIDE_GL_SHADERPERMUTATIONS_HPP
@@ -0,0 +1,241 @@
+/**
+ * TextureBindings Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include "TextureBindings.hpp"
+#include "TextureSlots.hpp"
+#include "GLDefaults.hpp"
+
+using namespace ShaderIDE::GL;
+
+void TextureBindings::Init(QOpenGLContext* context)
+{
+    initializeOpenGLFunctions();
+
+    if (!context->hasExtension("GL_ARB_bindless_texture")) {
+        return;
+    }
+
+    getTextureHandle = reinterpret_cast<GetTextureHandleProc>(
+            context->getProcAddress("glGetTextureHandleARB"));
+
+    makeTextureHandleResident = reinterpret_cast<TextureHandleProc>(
+            context->getProcAddress("glMakeTextureHandleResidentARB"));
+
+    isTextureHandleResident = reinterpret_cast<IsTextureHandleResidentProc>(
+            context->getProcAddress("glIsTextureHandleResidentARB"));
+
+    programUniformHandle = reinterpret_cast<ProgramUniformHandleProc>(
+            context->getProcAddress("glProgramUniformHandleui64ARB"));
+}
+
+bool TextureBindings::BindlessSupported() const
+{
+    return getTextureHandle != nullptr
+           && makeTextureHandleResident != nullptr
+           && isTextureHandleResident != nullptr
+           && programUniformHandle != nullptr;
+}
+
+void TextureBindings::Assign(const QList<GLuint>& newPrograms, bool bindlessRequested)
+{
+    programs = newPrograms;
+    samplers.clear();
+    locations.clear();
+    handleTextures.clear();
+    bindless = bindlessRequested && BindlessSupported();
+
+    const std::array<GLenum, 4> properties = { GL_NAME_LENGTH, GL_TYPE, GL_BLOCK_INDEX, GL_ARRAY_SIZE };
+
+    for (const auto program : programs)
+    {
+        if (program == 0) {
+            continue;
+        }
+
+        GLint numUniforms = 0;
+        glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &numUniforms);
+
+        for (GLint i = 0; i < numUniforms; i++)
+        {
+            std::array<GLint, 4> values{};
+            glGetProgramResourceiv(program, GL_UNIFORM, i,
+                                   static_cast<GLsizei>(properties.size()), properties.data(),
+                                   static_cast<GLsizei>(values.size()), nullptr, values.data());
+
+            if (values.at(2) != -1 || values.at(3) != 1) {
+                continue;
+            }
+
+            QByteArray name(values.at(0), '\0');
+            glGetProgramResourceName(program, GL_UNIFORM, i, values.at(0), nullptr, name.data());
+
+            SamplerBinding binding;
+
+            if (!SamplerSource(QString::fromLatin1(name.constData()), static_cast<GLenum>(values.at(1)), binding)) {
+                continue;
+            }
+
+            // Stages of a pipeline may declare the same sampler.
+            auto found = false;
+
+            for (const auto& sampler : samplers) {
+                found |= sampler.name == binding.name;
+            }
+
+            if (!found)
+            {
+                binding.unit = static_cast<GLuint>(samplers.size());
+                samplers << binding;
+            }
+        }
+    }
+
+    // Units (or handles) are set once per program.
+    for (const auto& sampler : samplers)
+    {
+        QList<GLint> samplerLocations;
+
+        for (const auto program : programs)
+        {
+            const auto location = glGetUniformLocation(program, sampler.name.toLatin1().constData());
+            samplerLocations << location;
+
+            if (location != -1 && !bindless) {
+                glProgramUniform1i(program, location, static_cast<GLint>(sampler.unit));
+            }
+        }
+
+        locations << samplerLocations;
+    }
+}
+
+const SamplerBindings& TextureBindings::Samplers() const
+{
+    return samplers;
+}
+
+bool TextureBindings::Bindless() const
+{
+    return bindless;
+}
+
+bool TextureBindings::Uses(const SamplerBinding::SOURCE& source) const
+{
+    for (const auto& sampler : samplers)
+    {
+        if (sampler.source == source) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TextureBindings::Bind(const std::vector<GLuint>& textures, uint32_t revision)
+{
+    if (samplers.isEmpty()) {
+        return;
+    }
+
+    if (bindless)
+    {
+        // Names of deleted textures may be reused by new ones.
+        if (revision != handleRevision)
+        {
+            handleTextures.clear();
+            handleRevision = revision;
+        }
+
+        ApplyHandles(textures);
+        return;
+    }
+
+    glBindTextures(0, static_cast<GLsizei>(textures.size()), textures.data());
+}
+
+void TextureBindings::Release()
+{
+    if (!bindless && !samplers.isEmpty()) {
+        glBindTextures(0, static_cast<GLsizei>(samplers.size()), nullptr);
+    }
+}
+
+bool TextureBindings::SamplerSource(const QString& name, GLenum type, SamplerBinding& binding)
+{
+    binding.name = name;
+
+    if (type == GL_SAMPLER_2D && name == GLSL_COMPUTE_OUTPUT_NAME)
+    {
+        binding.source = SamplerBinding::SOURCE::COMPUTE_OUTPUT;
+        return true;
+    }
+
+    if (type == GL_SAMPLER_2D_ARRAY && name == GLSL_TEXTURE_ARRAY_NAME)
+    {
+        binding.source = SamplerBinding::SOURCE::ARRAY;
+        return true;
+    }
+
+    binding.source = SamplerBinding::SOURCE::SLOT;
+    binding.slot = TextureSlots::Index(name);
+    return type == GL_SAMPLER_2D && binding.slot != -1;
+}
+
+void TextureBindings::ApplyHandles(const std::vector<GLuint>& textures)
+{
+    // Handles stay valid, until their texture is deleted. Changed
+    // textures are made resident and passed to the programs.
+    if (textures == handleTextures) {
+        return;
+    }
+
+    for (size_t i = 0; i < textures.size() && i < static_cast<size_t>(samplers.size()); i++)
+    {
+        if (i < handleTextures.size() && handleTextures.at(i) == textures.at(i)) {
+            continue;
+        }
+
+        const auto handle = getTextureHandle(textures.at(i));
+
+        if (!isTextureHandleResident(handle)) {
+            makeTextureHandleResident(handle);
+        }
+
+        for (int p = 0; p < programs.size(); p++)
+        {
+            const auto location = locations.at(static_cast<int>(i)).at(p);
+
+            if (location != -1) {
+                programUniformHandle(programs.at(p), location, handle);
+            }
+        }
+    }
+
+    handleTextures = textures;
+}
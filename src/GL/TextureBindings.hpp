@@ -0,0 +1,106 @@
+/**
+ * TextureBindings Class
+ *
+ * Texture units of a program. The sampler uniforms are reflected once
+ * after linking and get one unit each, all units are bound with a single
+ * call. With ARB_bindless_texture the programs receive texture handles
+ * instead and no units are bound at all.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_TEXTUREBINDINGS_HPP
+#define SHADERIDE_GL_TEXTUREBINDINGS_HPP
+
+#include <vector>
+#include <QList>
+#include <QString>
+#include <QOpenGLContext>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+
+namespace ShaderIDE::GL {
+
+    struct SamplerBinding
+    {
+        enum class SOURCE
+        {
+            SLOT, // texN
+            ARRAY, // texArray, sampler2DArray
+            COMPUTE_OUTPUT
+        };
+
+        QString name{ "" };
+        SOURCE source{ SOURCE::SLOT };
+        int slot{ -1 };
+        GLuint unit{ 0 };
+    };
+
+    using SamplerBindings = QList<SamplerBinding>;
+
+    class TextureBindings : protected QOpenGLFunctions_4_5_Core
+    {
+        using GetTextureHandleProc = GLuint64 (QOPENGLF_APIENTRYP)(GLuint texture);
+        using TextureHandleProc = void (QOPENGLF_APIENTRYP)(GLuint64 handle);
+        using IsTextureHandleResidentProc = GLboolean (QOPENGLF_APIENTRYP)(GLuint64 handle);
+        using ProgramUniformHandleProc = void (QOPENGLF_APIENTRYP)(GLuint program, GLint location, GLuint64 value);
+
+    public:
+        // Render Thread
+        void Init(QOpenGLContext* context);
+        bool BindlessSupported() const;
+
+        // Bindless handles are used, if supported and requested
+        // (the shaders enable GL_ARB_bindless_texture).
+        void Assign(const QList<GLuint>& programs, bool bindlessRequested);
+        const SamplerBindings& Samplers() const;
+        bool Bindless() const;
+        bool Uses(const SamplerBinding::SOURCE& source) const;
+
+        // One texture per sampler, see Samplers(). Handles are passed to the
+        // programs again, if the textures or their revision changed.
+        void Bind(const std::vector<GLuint>& textures, uint32_t revision);
+        void Release();
+
+        static bool SamplerSource(const QString& name, GLenum type, SamplerBinding& binding);
+
+    private:
+        QList<GLuint> programs;
+        SamplerBindings samplers;
+        QList<QList<GLint>> locations; // Per sampler and program
+
+        bool bindless{ false };
+        std::vector<GLuint> handleTextures; // Textures of the applied handles
+        uint32_t handleRevision{ 0 };
+
+        GetTextureHandleProc getTextureHandle{ nullptr };
+        TextureHandleProc makeTextureHandleResident{ nullptr };
+        IsTextureHandleResidentProc isTextureHandleResident{ nullptr };
+        ProgramUniformHandleProc programUniformHandle{ nullptr };
+
+        void ApplyHandles(const std::vector<GLuint>& textures);
+    };
+}
+
+#endif // SHADERIDE_GL_TEXTUREBINDINGS_HPP
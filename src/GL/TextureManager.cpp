@@ -0,0 +1,408 @@
+/**
+ * TextureManager Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <algorithm>
+#include "TextureManager.hpp"
+
+using namespace ShaderIDE::GL;
+
+TextureManager::TextureManager(int slotCount)
+        : slots(std::max(0, slotCount))
+{
+}
+
+void TextureManager::Init()
+{
+    initializeOpenGLFunctions();
+
+    // Shared by all empty slots, samplers read black.
+    const uint32_t black = 0xFF000000;
+    fallbackTexture = CreateTexture(QSize(1, 1), 1, GL_RGBA8);
+    glTextureSubImage2D(fallbackTexture, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &black);
+}
+
+void TextureManager::Release()
+{
+    for (int i = 0; i < SlotCount(); i++) {
+        Clear(i);
+    }
+
+    DeleteTexture(fallbackTexture);
+    DeleteTexture(arrayTexture);
+    arraySize = QSize();
+    arrayLayers = 0;
+    arrayBytes = 0;
+}
+
+bool TextureManager::SetImage(int slot, const QImage& image)
+{
+    return SetUploadImage(slot, MakeUploadImage(image));
+}
+
+bool TextureManager::SetUploadImage(int slot, const QImage& upload)
+{
+    const auto reused = Allocate(slot, upload.size());
+
+    glTextureSubImage2D(slots.at(slot).texture, 0, 0, 0,
+                        upload.width(), upload.height(),
+                        GL_RGBA, GL_UNSIGNED_BYTE, upload.constBits());
+
+    GenerateMipmaps(slot);
+    return reused;
+}
+
+bool TextureManager::Allocate(int slot, const QSize& size)
+{
+    auto& target = slots.at(slot);
+
+    if (target.texture != 0 && target.format == GL_RGBA8 && target.size == size) {
+        return true;
+    }
+
+    // Immutable storage, a new size needs a new texture.
+    const auto levels = MipLevels(size);
+    Clear(slot);
+    target.texture = CreateTexture(size, levels, GL_RGBA8);
+    target.format = GL_RGBA8;
+    target.size = size;
+    target.levels = levels;
+    target.bytes = StorageBytes(size, levels, 4);
+
+    return false;
+}
+
+void TextureManager::Reallocate(int slot, const QSize& size)
+{
+    auto& target = slots.at(slot);
+
+    if (target.texture != 0 && target.format == GL_RGBA8 && target.size == size) {
+        return;
+    }
+
+    const auto levels = MipLevels(size);
+    auto texture = CreateTexture(size, levels, GL_RGBA8);
+
+    // Until the new content is uploaded, the previous image is shown.
+    if (target.texture != 0 && target.format == GL_RGBA8)
+    {
+        GLuint framebuffers[2] = { 0, 0 };
+        glCreateFramebuffers(2, framebuffers);
+        glNamedFramebufferTexture(framebuffers[0], GL_COLOR_ATTACHMENT0, target.texture, 0);
+        glNamedFramebufferTexture(framebuffers[1], GL_COLOR_ATTACHMENT0, texture, 0);
+
+        glBlitNamedFramebuffer(framebuffers[0], framebuffers[1],
+                               0, 0, target.size.width(), target.size.height(),
+                               0, 0, size.width(), size.height(),
+                               GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+        glDeleteFramebuffers(2, framebuffers);
+
+    } else {
+        glClearTexImage(texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    Clear(slot);
+    target.texture = texture;
+    target.format = GL_RGBA8;
+    target.size = size;
+    target.levels = levels;
+    target.bytes = StorageBytes(size, levels, 4);
+
+    GenerateMipmaps(slot);
+}
+
+void TextureManager::SetUploadRegion(int slot, const QPoint& offset, const QImage& upload)
+{
+    // Mipmaps are generated by the caller, once for all regions of a frame.
+    const auto& target = slots.at(slot);
+
+    if (target.texture == 0 || target.format != GL_RGBA8) {
+        return;
+    }
+
+    glTextureSubImage2D(target.texture, 0, offset.x(), offset.y(),
+                        upload.width(), upload.height(),
+                        GL_RGBA, GL_UNSIGNED_BYTE, upload.constBits());
+}
+
+void TextureManager::GenerateMipmaps(int slot)
+{
+    const auto& target = slots.at(slot);
+
+    // Compressed slots bring their own levels.
+    if (target.texture != 0 && target.format == GL_RGBA8) {
+        glGenerateTextureMipmap(target.texture);
+    }
+}
+
+void TextureManager::Clear(int slot)
+{
+    auto& target = slots.at(slot);
+    DeleteTexture(target.texture);
+    target.format = GL_RGBA8;
+    target.size = QSize();
+    target.levels = 0;
+    target.bytes = 0;
+}
+
+bool TextureManager::SetCompressedImage(int slot, const CompressedImage& image)
+{
+    auto& target = slots.at(slot);
+    const auto format = image.InternalFormat();
+    const auto levels = static_cast<int>(image.Levels().size());
+    const auto reused = target.texture != 0
+                        && target.format == format
+                        && target.size == image.Size()
+                        && target.levels == levels;
+
+    if (!reused)
+    {
+        Clear(slot);
+        target.texture = CreateTexture(image.Size(), levels, format);
+        target.format = format;
+        target.size = image.Size();
+        target.levels = levels;
+        target.bytes = image.Bytes();
+    }
+
+    for (int level = 0; level < levels; level++)
+    {
+        const auto& source = image.Levels().at(level);
+
+        glCompressedTextureSubImage2D(target.texture, level, 0, 0,
+                                      source.size.width(), source.size.height(), format,
+                                      static_cast<GLsizei>(source.data.size()), source.data.constData());
+    }
+
+    return reused;
+}
+
+bool TextureManager::CompressedSupported(GLenum internalFormat)
+{
+    GLint supported = GL_FALSE;
+    glGetInternalformativ(GL_TEXTURE_2D, internalFormat, GL_INTERNALFORMAT_SUPPORTED, 1, &supported);
+    return supported == GL_TRUE;
+}
+
+void TextureManager::SetSlotCount(int count)
+{
+    for (int i = std::max(0, count); i < SlotCount(); i++) {
+        Clear(i);
+    }
+
+    slots.resize(std::max(0, count));
+}
+
+int TextureManager::SlotCount() const
+{
+    return static_cast<int>(slots.size());
+}
+
+bool TextureManager::Empty(int slot) const
+{
+    return slots.at(slot).texture == 0;
+}
+
+QSize TextureManager::Size(int slot) const
+{
+    return slots.at(slot).size;
+}
+
+GLuint TextureManager::Texture(int slot) const
+{
+    if (slot < 0 || slot >= SlotCount()) {
+        return fallbackTexture;
+    }
+
+    const auto texture = slots.at(slot).texture;
+    return texture != 0 ? texture : fallbackTexture;
+}
+
+QList<int> TextureManager::UpdateArray()
+{
+    QSize size;
+
+    for (const auto& slot : slots)
+    {
+        if (slot.texture != 0 && slot.format == GL_RGBA8)
+        {
+            size = slot.size;
+            break;
+        }
+    }
+
+    if (size.isEmpty()) {
+        size = QSize(1, 1);
+    }
+
+    const auto layers = std::max(1, SlotCount());
+
+    if (arrayTexture == 0 || arraySize != size || arrayLayers != layers) {
+        CreateArray(size, layers);
+    }
+
+    // Copies on the GPU, layers of empty or skipped slots are cleared.
+    QList<int> skipped;
+
+    for (int i = 0; i < SlotCount(); i++)
+    {
+        const auto& slot = slots.at(i);
+
+        if (slot.texture != 0 && slot.format == GL_RGBA8 && slot.size == size)
+        {
+            glCopyImageSubData(slot.texture, GL_TEXTURE_2D, 0, 0, 0, 0,
+                               arrayTexture, GL_TEXTURE_2D_ARRAY, 0, 0, 0, i,
+                               size.width(), size.height(), 1);
+            continue;
+        }
+
+        glClearTexSubImage(arrayTexture, 0, 0, 0, i, size.width(), size.height(), 1,
+                           GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+        if (slot.texture != 0) {
+            skipped << i;
+        }
+    }
+
+    glGenerateTextureMipmap(arrayTexture);
+    return skipped;
+}
+
+GLuint TextureManager::ArrayTexture() const
+{
+    return arrayTexture;
+}
+
+qint64 TextureManager::SlotBytes(int slot) const
+{
+    return slots.at(slot).bytes;
+}
+
+qint64 TextureManager::TotalBytes() const
+{
+    qint64 total = (fallbackTexture != 0 ? StorageBytes(QSize(1, 1), 1, 4) : 0) + arrayBytes;
+
+    for (const auto& slot : slots) {
+        total += slot.bytes;
+    }
+
+    return total;
+}
+
+int TextureManager::Allocations() const
+{
+    return allocations;
+}
+
+int TextureManager::LiveTextures() const
+{
+    return liveTextures;
+}
+
+QImage TextureManager::MakeUploadImage(const QImage& image)
+{
+    // Rows are flipped, GL textures start at the bottom.
+    return image.convertToFormat(QImage::Format_RGBA8888).mirrored();
+}
+
+int TextureManager::MipLevels(const QSize& size)
+{
+    int levels = 1;
+    int extent = std::max(size.width(), size.height());
+
+    while (extent > 1)
+    {
+        extent /= 2;
+        levels++;
+    }
+
+    return levels;
+}
+
+qint64 TextureManager::StorageBytes(const QSize& size, int levels, int bytesPerPixel)
+{
+    qint64 bytes = 0;
+    qint64 width = size.width();
+    qint64 height = size.height();
+
+    for (int level = 0; level < levels; level++)
+    {
+        bytes += width * height * bytesPerPixel;
+        width = std::max<qint64>(1, width / 2);
+        height = std::max<qint64>(1, height / 2);
+    }
+
+    return bytes;
+}
+
+GLuint TextureManager::CreateTexture(const QSize& size, int levels, GLenum internalFormat)
+{
+    GLuint texture = 0;
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, levels, internalFormat, size.width(), size.height());
+    glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    allocations++;
+    liveTextures++;
+    return texture;
+}
+
+void TextureManager::CreateArray(const QSize& size, int layers)
+{
+    DeleteTexture(arrayTexture);
+
+    const auto levels = MipLevels(size);
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &arrayTexture);
+    glTextureStorage3D(arrayTexture, levels, GL_RGBA8, size.width(), size.height(), layers);
+    glTextureParameteri(arrayTexture, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTextureParameteri(arrayTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(arrayTexture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTextureParameteri(arrayTexture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    arraySize = size;
+    arrayLayers = layers;
+    arrayBytes = StorageBytes(size, levels, 4) * layers;
+
+    allocations++;
+    liveTextures++;
+}
+
+void TextureManager::DeleteTexture(GLuint& texture)
+{
+    if (texture == 0) {
+        return;
+    }
+
+    glDeleteTextures(1, &texture);
+    texture = 0;
+    liveTextures--;
+}
@@ -0,0 +1,119 @@
+/**
+ * TextureManager Class
+ *
+ * Owns the textures of the texture slots. Storage is immutable and reused,
+ * if the size of a new image matches, empty slots share a black fallback.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_TEXTUREMANAGER_HPP
+#define SHADERIDE_GL_TEXTUREMANAGER_HPP
+
+#include <vector>
+#include <QList>
+#include <QImage>
+#include <QSize>
+#include <QPoint>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "CompressedImage.hpp"
+
+namespace ShaderIDE::GL {
+
+    class TextureManager : protected QOpenGLFunctions_4_5_Core
+    {
+    public:
+        explicit TextureManager(int slotCount);
+
+        // Render Thread
+        void Init();
+        void Release();
+
+        // Returns true, if the storage of the slot was reused.
+        bool SetImage(int slot, const QImage& image);
+        bool SetUploadImage(int slot, const QImage& upload);
+        bool Allocate(int slot, const QSize& size);
+        void Reallocate(int slot, const QSize& size); // Keeps the image, scaled on the GPU
+        void SetUploadRegion(int slot, const QPoint& offset, const QImage& upload);
+        void GenerateMipmaps(int slot);
+        void Clear(int slot);
+
+        // All levels are uploaded as stored, see CompressedSupported().
+        bool SetCompressedImage(int slot, const CompressedImage& image);
+        bool CompressedSupported(GLenum internalFormat);
+
+        // Textures of removed slots are deleted.
+        void SetSlotCount(int count);
+        int SlotCount() const;
+        bool Empty(int slot) const;
+        QSize Size(int slot) const;
+        GLuint Texture(int slot) const; // Fallback for empty or missing slots
+
+        // One layer per slot, RGBA8 slots of the size of the first filled
+        // slot are copied. Returns the filled slots, which were not packed.
+        QList<int> UpdateArray();
+        GLuint ArrayTexture() const;
+
+        // GPU Memory (Bytes)
+        qint64 SlotBytes(int slot) const;
+        qint64 TotalBytes() const;
+
+        // Textures created by the manager, the fallback included.
+        int Allocations() const;
+        int LiveTextures() const;
+
+        // RGBA8888 with flipped rows, may be called on any thread.
+        static QImage MakeUploadImage(const QImage& image);
+        static int MipLevels(const QSize& size);
+        static qint64 StorageBytes(const QSize& size, int levels, int bytesPerPixel);
+
+    private:
+        struct Slot
+        {
+            GLuint texture{ 0 };
+            GLenum format{ GL_RGBA8 };
+            QSize size;
+            int levels{ 0 };
+            qint64 bytes{ 0 };
+        };
+
+        std::vector<Slot> slots;
+        GLuint fallbackTexture{ 0 };
+
+        GLuint arrayTexture{ 0 };
+        QSize arraySize;
+        int arrayLayers{ 0 };
+        qint64 arrayBytes{ 0 };
+
+        int allocations{ 0 };
+        int liveTextures{ 0 };
+
+        GLuint CreateTexture(const QSize& size, int levels, GLenum internalFormat);
+        void CreateArray(const QSize& size, int layers);
+        void DeleteTexture(GLuint& texture);
+    };
+}
+
+#endif // SHADERIDE_GL_TEXTUREMANAGER_HPP
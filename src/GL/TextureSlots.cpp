@@ -0,0 +1,59 @@
+/**
+ * TextureSlots Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QRegularExpression>
+#include "TextureSlots.hpp"
+#include "GLDefaults.hpp"
+
+using namespace ShaderIDE::GL;
+
+QString TextureSlots::Name(int slot)
+{
+    return QString(GLSL_TEXTURE_SLOT_PREFIX) + QString::number(slot);
+}
+
+int TextureSlots::Index(const QString& name)
+{
+    static const QRegularExpression SLOT_NAME(
+            QString("^") + GLSL_TEXTURE_SLOT_PREFIX + "(0|[1-9][0-9]?)$"
+    );
+
+    const auto match = SLOT_NAME.match(name);
+
+    if (!match.hasMatch()) {
+        return -1;
+    }
+
+    const auto slot = match.captured(1).toInt();
+    return slot < GLSL_TEXTURE_SLOTS_MAX ? slot : -1;
+}
+
+int TextureSlots::ClampCount(int count)
+{
+    return qBound(1, count, GLSL_TEXTURE_SLOTS_MAX);
+}
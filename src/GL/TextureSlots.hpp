@@ -1,5 +1,7 @@
 /**
- * Shell Class
+ * TextureSlots Class
+ *
+ * Names of the texture slots (tex0, tex1, ...).
  *
  * -------------------------------------------------------------------------------
  * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
@@ -26,18 +28,23 @@
  * SOFTWARE.
  */
 
-#ifndef SHADERIDE_CORE_SHELL_HPP
-#define SHADERIDE_CORE_SHELL_HPP
+#ifndef SHADERIDE_GL_TEXTURESLOTS_HPP
+#define SHADERIDE_GL_TEXTURESLOTS_HPP
 
 #include <QString>
 
-namespace ShaderIDE {
+namespace ShaderIDE::GL {
 
-    class Shell
+    class TextureSlots
     {
     public:
-        static QString Exec(const QString& cmd);
+        static QString Name(int slot);
+
+        // Returns -1 for names, which are no valid slot.
+        static int Index(const QString& name);
+
+        static int ClampCount(int count);
     };
 }
 
-#endif // SHADERIDE_CORE_SHELL_HPP
+#endif // SHADERIDE_GL_TEXTURESLOTS_HPP
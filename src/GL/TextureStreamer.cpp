@@ -0,0 +1,179 @@
+/**
+ * TextureStreamer Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstring>
+#include "TextureStreamer.hpp"
+
+using namespace ShaderIDE::GL;
+
+void TextureStreamer::Init()
+{
+    initializeOpenGLFunctions();
+    threadPool.setMaxThreadCount(RING_SIZE);
+}
+
+void TextureStreamer::Release()
+{
+    // Workers must not write into the unmapped buffer.
+    threadPool.waitForDone();
+    DeleteBuffer();
+}
+
+int TextureStreamer::Stream(const QImage& upload, const std::function<void(int region)>& finished)
+{
+    const auto bytes = static_cast<qint64>(upload.sizeInBytes());
+    const auto region = AcquireRegion(bytes);
+
+    if (region == -1) {
+        return -1;
+    }
+
+    auto* target = mapping + region * regionSize;
+    regions.at(region).state = STATE::COPYING;
+
+    threadPool.start([upload, bytes, target, region, finished]() {
+        std::memcpy(target, upload.constBits(), static_cast<size_t>(bytes));
+        finished(region);
+    });
+
+    return region;
+}
+
+void TextureStreamer::Upload(int region, GLuint texture, const QSize& size)
+{
+    const auto offset = static_cast<intptr_t>(region * regionSize);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    glTextureSubImage2D(texture, 0, 0, 0,
+                        size.width(), size.height(),
+                        GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(offset));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    auto& target = regions.at(region);
+    target.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    target.state = STATE::UPLOADING;
+}
+
+void TextureStreamer::Discard(int region)
+{
+    regions.at(region).state = STATE::FREE;
+}
+
+qint64 TextureStreamer::RegionSize() const
+{
+    return regionSize;
+}
+
+int TextureStreamer::AcquireRegion(qint64 bytes)
+{
+    if (bytes > MAX_REGION_SIZE) {
+        return -1;
+    }
+
+    // The buffer grows, once no worker writes into it. Pending uploads
+    // keep reading the old buffer, GL deletes it after them.
+    if (bytes > regionSize)
+    {
+        if (Copying()) {
+            return -1;
+        }
+
+        DeleteBuffer();
+        CreateBuffer(bytes);
+
+        if (mapping == nullptr)
+        {
+            DeleteBuffer();
+            return -1;
+        }
+    }
+
+    for (int i = 0; i < RING_SIZE; i++)
+    {
+        auto& region = regions.at(i);
+
+        if (region.state == STATE::UPLOADING)
+        {
+            const auto status = glClientWaitSync(region.fence, 0, 0);
+
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+            {
+                glDeleteSync(region.fence);
+                region.fence = nullptr;
+                region.state = STATE::FREE;
+            }
+        }
+
+        if (region.state == STATE::FREE) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool TextureStreamer::Copying() const
+{
+    for (const auto& region : regions)
+    {
+        if (region.state == STATE::COPYING) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TextureStreamer::CreateBuffer(qint64 bytes)
+{
+    regionSize = (bytes + REGION_ALIGNMENT - 1) / REGION_ALIGNMENT * REGION_ALIGNMENT;
+
+    const auto flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, regionSize * RING_SIZE, nullptr, flags);
+    mapping = static_cast<uchar*>(glMapNamedBufferRange(buffer, 0, regionSize * RING_SIZE, flags));
+}
+
+void TextureStreamer::DeleteBuffer()
+{
+    for (auto& region : regions)
+    {
+        glDeleteSync(region.fence);
+        region.fence = nullptr;
+        region.state = STATE::FREE;
+    }
+
+    if (buffer != 0) {
+        glUnmapNamedBuffer(buffer);
+    }
+
+    glDeleteBuffers(1, &buffer);
+    buffer = 0;
+    mapping = nullptr;
+    regionSize = 0;
+}
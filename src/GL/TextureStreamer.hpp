@@ -0,0 +1,95 @@
+/**
+ * TextureStreamer Class
+ *
+ * Streams texture uploads through a persistently mapped pixel unpack
+ * buffer. Pixels are copied into a free region of the ring on a worker
+ * thread, the render thread uploads the region with the next frame.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_TEXTURESTREAMER_HPP
+#define SHADERIDE_GL_TEXTURESTREAMER_HPP
+
+#include <array>
+#include <functional>
+#include <QImage>
+#include <QThreadPool>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+
+namespace ShaderIDE::GL {
+
+    class TextureStreamer : protected QOpenGLFunctions_4_5_Core
+    {
+        static constexpr int RING_SIZE = 3;
+        static constexpr qint64 REGION_ALIGNMENT = 64 * 1024;
+
+    public:
+        // Larger images are uploaded directly.
+        static constexpr qint64 MAX_REGION_SIZE = 64 * 1024 * 1024;
+
+        // Render Thread
+        void Init();
+        void Release();
+
+        // Returns the region, the pixels are copied to, or -1, if the ring
+        // is busy or the image is too large. Finished is called on the worker.
+        int Stream(const QImage& upload, const std::function<void(int region)>& finished);
+
+        // Uploads level 0 of the texture, the region is reused after the GPU read it.
+        void Upload(int region, GLuint texture, const QSize& size);
+        void Discard(int region);
+
+        qint64 RegionSize() const;
+
+    private:
+        enum class STATE
+        {
+            FREE,
+            COPYING, // Worker writes into the mapping
+            UPLOADING // Fence pending
+        };
+
+        struct Region
+        {
+            STATE state{ STATE::FREE };
+            GLsync fence{ nullptr };
+        };
+
+        GLuint buffer{ 0 };
+        uchar* mapping{ nullptr };
+        qint64 regionSize{ 0 };
+        std::array<Region, RING_SIZE> regions{};
+
+        QThreadPool threadPool;
+
+        int AcquireRegion(qint64 bytes);
+        bool Copying() const;
+        void CreateBuffer(qint64 bytes);
+        void DeleteBuffer();
+    };
+}
+
+#endif // SHADERIDE_GL_TEXTURESTREAMER_HPP
@@ -0,0 +1,390 @@
+/**
+ * TilePyramid Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstring>
+#include <algorithm>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QPainter>
+#include <QImageReader>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStandardPaths>
+#include "TilePyramid.hpp"
+#include "TextureManager.hpp"
+#include "src/Core/Hash.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+TilePyramid::TilePyramid(const QString& directory, const QSize& size)
+        : directory(directory),
+          size(size),
+          levelSizes(LevelSizes(size))
+{
+}
+
+TilePyramid TilePyramid::Build(const QString& sourcePath, const QString& directory)
+{
+    // Only the header is read.
+    const auto sourceSize = QImageReader(sourcePath).size();
+
+    if (!sourceSize.isValid() || sourceSize.isEmpty()) {
+        throw GeneralException(QString("Could not read the size of image \"%1\".").arg(sourcePath));
+    }
+
+    TilePyramid pyramid(directory, sourceSize);
+
+    if (!pyramid.IndexMatches())
+    {
+        QDir(directory).removeRecursively();
+
+        for (int level = 0; level < pyramid.Levels(); level++) {
+            QDir().mkpath(directory + "/" + QString::number(level));
+        }
+
+        pyramid.WriteSourceLevel(sourcePath);
+
+        for (int level = 1; level < pyramid.Levels(); level++) {
+            pyramid.WriteReducedLevel(level);
+        }
+    }
+
+    // Written last, also marks reused pyramids as recently used.
+    pyramid.WriteIndex();
+    PruneCache(directory);
+
+    return pyramid;
+}
+
+QString TilePyramid::CacheDirectory(const QString& sourcePath)
+{
+    // Changed files get a new pyramid.
+    const QFileInfo info(sourcePath);
+
+    const auto key = Hash()
+            .Add(info.absoluteFilePath())
+            .Add(info.lastModified().toMSecsSinceEpoch())
+            .Add(info.size())
+            .Value();
+
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)
+           + DIRECTORY_NAME + "/" + QString::number(key, 16);
+}
+
+QList<QSize> TilePyramid::LevelSizes(const QSize& size)
+{
+    QList<QSize> sizes;
+
+    if (size.isEmpty()) {
+        return sizes;
+    }
+
+    sizes << size;
+
+    while (std::max(sizes.last().width(), sizes.last().height()) > TILE_SIZE) {
+        sizes << QSize(std::max(1, sizes.last().width() / 2), std::max(1, sizes.last().height() / 2));
+    }
+
+    return sizes;
+}
+
+bool TilePyramid::IsNull() const
+{
+    return levelSizes.isEmpty();
+}
+
+QSize TilePyramid::Size() const
+{
+    return size;
+}
+
+int TilePyramid::Levels() const
+{
+    return static_cast<int>(levelSizes.size());
+}
+
+QSize TilePyramid::LevelSize(int level) const
+{
+    return levelSizes.at(level);
+}
+
+int TilePyramid::Columns(int level) const
+{
+    return (LevelSize(level).width() + TILE_SIZE - 1) / TILE_SIZE;
+}
+
+int TilePyramid::Rows(int level) const
+{
+    return (LevelSize(level).height() + TILE_SIZE - 1) / TILE_SIZE;
+}
+
+QRect TilePyramid::TileRect(int level, int column, int row) const
+{
+    const auto levelSize = LevelSize(level);
+    const auto x = column * TILE_SIZE;
+    const auto y = row * TILE_SIZE;
+
+    return { x, y, std::min(TILE_SIZE, levelSize.width() - x), std::min(TILE_SIZE, levelSize.height() - y) };
+}
+
+QString TilePyramid::Description() const
+{
+    return QString("Streamed %1 x %2, %3 tile levels").arg(size.width()).arg(size.height()).arg(Levels());
+}
+
+QImage TilePyramid::ReadTile(int level, int column, int row) const
+{
+    const auto rect = TileRect(level, column, row);
+    QFile file(TilePath(level, column, row));
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+
+    // Raw rows, 4 byte pixels need no padding.
+    const auto data = file.readAll();
+
+    if (data.size() != static_cast<qint64>(rect.width()) * rect.height() * 4) {
+        return {};
+    }
+
+    QImage tile(rect.size(), QImage::Format_RGBA8888);
+    std::memcpy(tile.bits(), data.constData(), data.size());
+
+    return tile;
+}
+
+QImage TilePyramid::ReadLevel(int level) const
+{
+    QImage image(LevelSize(level), QImage::Format_RGBA8888);
+    QPainter painter(&image);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+
+    for (int row = 0; row < Rows(level); row++)
+    {
+        for (int column = 0; column < Columns(level); column++)
+        {
+            const auto tile = ReadTile(level, column, row);
+
+            if (tile.isNull()) {
+                return {};
+            }
+
+            painter.drawImage(TileRect(level, column, row).topLeft(), tile);
+        }
+    }
+
+    return image;
+}
+
+int TilePyramid::LevelForExtent(int extent) const
+{
+    for (int level = Levels() - 1; level > 0; level--)
+    {
+        const auto levelSize = LevelSize(level);
+
+        if (std::max(levelSize.width(), levelSize.height()) >= extent) {
+            return level;
+        }
+    }
+
+    return 0;
+}
+
+int TilePyramid::LevelForExtent(int extent, qint64 maxBytes) const
+{
+    auto level = LevelForExtent(extent);
+
+    while (level < Levels() - 1)
+    {
+        const auto levelSize = LevelSize(level);
+
+        if (TextureManager::StorageBytes(levelSize, TextureManager::MipLevels(levelSize), 4) <= maxBytes) {
+            break;
+        }
+
+        level++;
+    }
+
+    return level;
+}
+
+QString TilePyramid::TilePath(int level, int column, int row) const
+{
+    return QString("%1/%2/%3_%4.raw").arg(directory).arg(level).arg(column).arg(row);
+}
+
+void TilePyramid::WriteTile(int level, int column, int row, const QImage& tile) const
+{
+    // Scaled tiles may come back premultiplied.
+    const auto pixels = tile.convertToFormat(QImage::Format_RGBA8888);
+    QFile file(TilePath(level, column, row));
+
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(reinterpret_cast<const char*>(pixels.constBits()), pixels.sizeInBytes()) != pixels.sizeInBytes())
+    {
+        throw GeneralException(QString("Could not write tile \"%1\".").arg(file.fileName()));
+    }
+}
+
+void TilePyramid::WriteSourceLevel(const QString& sourcePath) const
+{
+    // JPEG stops decoding at the end of the clip rectangle, bands of tile rows
+    // keep the full image out of memory. Other formats are decoded once.
+    const auto bandRows = QImageReader(sourcePath).format() == "jpeg"
+                          ? static_cast<int>(std::max<qint64>(1, BAND_BYTES / (static_cast<qint64>(size.width()) * 4 * TILE_SIZE)))
+                          : Rows(0);
+
+    for (int firstRow = 0; firstRow < Rows(0); firstRow += bandRows)
+    {
+        const auto lastRow = std::min(Rows(0), firstRow + bandRows) - 1;
+        const auto bandRect = TileRect(0, 0, firstRow).united(TileRect(0, Columns(0) - 1, lastRow));
+
+        QImageReader reader(sourcePath);
+
+        if (bandRect.size() != size) {
+            reader.setClipRect(bandRect);
+        }
+
+        const auto band = reader.read().convertToFormat(QImage::Format_RGBA8888);
+
+        if (band.isNull()) {
+            throw GeneralException(QString("Could not decode image \"%1\": %2").arg(sourcePath, reader.errorString()));
+        }
+
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int column = 0; column < Columns(0); column++) {
+                WriteTile(0, column, row, band.copy(TileRect(0, column, row).translated(0, -bandRect.y())));
+            }
+        }
+    }
+}
+
+void TilePyramid::WriteReducedLevel(int level) const
+{
+    // Each tile is reduced from up to 2 x 2 tiles of the finer level.
+    const auto finer = level - 1;
+
+    for (int row = 0; row < Rows(level); row++)
+    {
+        for (int column = 0; column < Columns(level); column++)
+        {
+            const auto lastColumn = std::min(column * 2 + 1, Columns(finer) - 1);
+            const auto lastRow = std::min(row * 2 + 1, Rows(finer) - 1);
+            const auto sourceRect = TileRect(finer, column * 2, row * 2).united(TileRect(finer, lastColumn, lastRow));
+
+            QImage source(sourceRect.size(), QImage::Format_RGBA8888);
+            QPainter painter(&source);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+
+            for (int sourceRow = row * 2; sourceRow <= lastRow; sourceRow++)
+            {
+                for (int sourceColumn = column * 2; sourceColumn <= lastColumn; sourceColumn++)
+                {
+                    const auto tile = ReadTile(finer, sourceColumn, sourceRow);
+
+                    if (tile.isNull()) {
+                        throw GeneralException(QString("Tile %1_%2 of level %3 is missing.").arg(sourceColumn).arg(sourceRow).arg(finer));
+                    }
+
+                    painter.drawImage(TileRect(finer, sourceColumn, sourceRow).topLeft() - sourceRect.topLeft(), tile);
+                }
+            }
+
+            painter.end();
+
+            WriteTile(level, column, row, source.scaled(TileRect(level, column, row).size(),
+                                                        Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+        }
+    }
+}
+
+bool TilePyramid::IndexMatches() const
+{
+    QFile file(directory + "/" + INDEX_FILE_NAME);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const auto index = QJsonDocument::fromJson(file.readAll()).object();
+
+    return index["width"].toInt() == size.width()
+           && index["height"].toInt() == size.height()
+           && index["tileSize"].toInt() == TILE_SIZE
+           && index["levels"].toInt() == Levels();
+}
+
+void TilePyramid::WriteIndex() const
+{
+    QJsonObject index;
+    index["width"] = size.width();
+    index["height"] = size.height();
+    index["tileSize"] = TILE_SIZE;
+    index["levels"] = Levels();
+
+    QSaveFile file(directory + "/" + INDEX_FILE_NAME);
+
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(QJsonDocument(index).toJson()) == -1
+        || !file.commit())
+    {
+        throw GeneralException(QString("Could not write the tile index of \"%1\".").arg(directory));
+    }
+}
+
+void TilePyramid::PruneCache(const QString& keepDirectory)
+{
+    // Pyramids outside of the cache (i.e. tests) are never removed.
+    const auto cacheDirectory = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + DIRECTORY_NAME;
+    const QFileInfo keep(keepDirectory);
+
+    if (QDir(keep.absolutePath()) != QDir(cacheDirectory)) {
+        return;
+    }
+
+    // Least recently used first.
+    auto pyramids = QDir(cacheDirectory).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
+
+    std::sort(pyramids.begin(), pyramids.end(), [](const QFileInfo& a, const QFileInfo& b) {
+        return QFileInfo(a.filePath() + "/" + INDEX_FILE_NAME).lastModified()
+               < QFileInfo(b.filePath() + "/" + INDEX_FILE_NAME).lastModified();
+    });
+
+    for (int i = 0; i < pyramids.size() - CACHED_PYRAMIDS; i++)
+    {
+        if (pyramids.at(i).absoluteFilePath() != keep.absoluteFilePath()) {
+            QDir(pyramids.at(i).absoluteFilePath()).removeRecursively();
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * TilePyramid Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_TILEPYRAMID_HPP
+#define SHADERIDE_GL_TILEPYRAMID_HPP
+
+#include <QList>
+#include <QSize>
+#include <QRect>
+#include <QImage>
+#include <QString>
+
+namespace ShaderIDE::GL {
+
+    // Mip levels of a large image, cut into tiles which are stored on disk.
+    // Level 0 is the source, the coarsest level fits into a single tile.
+    class TilePyramid
+    {
+        static constexpr qint64 BAND_BYTES = 256 * 1024 * 1024; // Decoded rows per read
+        static constexpr int CACHED_PYRAMIDS = 4;
+        static constexpr const char* DIRECTORY_NAME = "/ShaderIDE/tiles";
+        static constexpr const char* INDEX_FILE_NAME = "pyramid.json";
+
+    public:
+        static constexpr int TILE_SIZE = 256;
+        static constexpr int PROXY_SIZE = 512; // Uploaded before any tile
+
+        TilePyramid() = default;
+
+        // Worker Thread
+        // Throws GeneralException for images, which cannot be read. A complete
+        // pyramid of the same source in the directory is reused.
+        static TilePyramid Build(const QString& sourcePath, const QString& directory);
+        static QString CacheDirectory(const QString& sourcePath);
+        static QList<QSize> LevelSizes(const QSize& size);
+
+        bool IsNull() const;
+        QSize Size() const;
+        int Levels() const;
+        QSize LevelSize(int level) const;
+        int Columns(int level) const;
+        int Rows(int level) const;
+        QRect TileRect(int level, int column, int row) const; // Top row first
+        QString Description() const;
+
+        // RGBA8888, null for missing tiles.
+        QImage ReadTile(int level, int column, int row) const;
+        QImage ReadLevel(int level) const;
+
+        // Coarsest level of at least extent pixels, finer levels than
+        // maxBytes allows (with mipmaps on the GPU) are not returned.
+        int LevelForExtent(int extent) const;
+        int LevelForExtent(int extent, qint64 maxBytes) const;
+
+    private:
+        QString directory{ "" };
+        QSize size;
+        QList<QSize> levelSizes;
+
+        TilePyramid(const QString& directory, const QSize& size);
+
+        QString TilePath(int level, int column, int row) const;
+        void WriteTile(int level, int column, int row, const QImage& tile) const;
+        void WriteSourceLevel(const QString& sourcePath) const;
+        void WriteReducedLevel(int level) const;
+        bool IndexMatches() const;
+        void WriteIndex() const;
+
+        static void PruneCache(const QString& keepDirectory);
+    };
+}
+
+#endif // SHADERIDE_GL_TILEPYRAMID_HPP
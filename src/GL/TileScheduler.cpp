@@ -0,0 +1,79 @@
+/**
+ * TileScheduler Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include "TileScheduler.hpp"
+
+using namespace ShaderIDE::GL;
+
+TileScheduler::TileScheduler(int tileSize)
+    : tileSize(std::max(1, tileSize))
+{}
+
+void TileScheduler::Reset(int newWidth, int newHeight)
+{
+    width = std::max(0, newWidth);
+    height = std::max(0, newHeight);
+    columns = (width + tileSize - 1) / tileSize;
+    rows = (height + tileSize - 1) / tileSize;
+    nextTile = 0;
+}
+
+QRect TileScheduler::NextTile()
+{
+    if (Finished()) {
+        return {};
+    }
+
+    const auto column = nextTile % columns;
+    const auto row = nextTile / columns;
+    nextTile++;
+
+    const auto x = column * tileSize;
+    const auto top = row * tileSize;
+    const auto tileWidth = std::min(tileSize, width - x);
+    const auto tileHeight = std::min(tileSize, height - top);
+
+    // Flip rows, since the first row is the top one on screen.
+    return { x, height - top - tileHeight, tileWidth, tileHeight };
+}
+
+bool TileScheduler::Finished() const
+{
+    return nextTile >= TileCount();
+}
+
+int TileScheduler::TileCount() const
+{
+    return columns * rows;
+}
+
+int TileScheduler::CompletedTiles() const
+{
+    return nextTile;
+}
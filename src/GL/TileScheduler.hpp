@@ -0,0 +1,65 @@
+/**
+ * TileScheduler Class
+ *
+ * Splits a viewport into equally sized tiles and hands
+ * them out one by one, from the top left to the bottom
+ * right corner. Tile rectangles are given in OpenGL
+ * window coordinates (origin at the bottom left).
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_TILESCHEDULER_HPP
+#define SHADERIDE_GL_TILESCHEDULER_HPP
+
+#include <QRect>
+
+namespace ShaderIDE::GL {
+
+    class TileScheduler
+    {
+    public:
+        static constexpr int DEFAULT_TILE_SIZE = 64;
+
+        explicit TileScheduler(int tileSize = DEFAULT_TILE_SIZE);
+
+        void Reset(int newWidth, int newHeight);
+        QRect NextTile();
+
+        bool Finished() const;
+        int TileCount() const;
+        int CompletedTiles() const;
+
+    private:
+        int tileSize;
+        int width{ 0 };
+        int height{ 0 };
+        int columns{ 0 };
+        int rows{ 0 };
+        int nextTile{ 0 };
+    };
+}
+
+#endif // SHADERIDE_GL_TILESCHEDULER_HPP
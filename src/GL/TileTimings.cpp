@@ -0,0 +1,170 @@
+/**
+ * TileTimings Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#include <algorithm>
+#include <QStringList>
+#include "TileTimings.hpp"
+#include "TileScheduler.hpp"
+
+using namespace ShaderIDE::GL;
+
+TileTimings::TileTimings(const QSize& size, int tileSize, TIMER timer)
+        : size(size),
+          tileSize(std::max(1, tileSize)),
+          timer(timer)
+{
+    columns = (size.width() + this->tileSize - 1) / this->tileSize;
+    rows = (size.height() + this->tileSize - 1) / this->tileSize;
+
+    // Same tiles as rendered, see TileScheduler.
+    TileScheduler scheduler(this->tileSize);
+    scheduler.Reset(size.width(), size.height());
+
+    while (!scheduler.Finished()) {
+        rects.push_back(scheduler.NextTile());
+    }
+
+    samples.resize(rects.size());
+}
+
+bool TileTimings::Empty() const
+{
+    return rects.empty();
+}
+
+QSize TileTimings::Size() const
+{
+    return size;
+}
+
+int TileTimings::TileSize() const
+{
+    return tileSize;
+}
+
+int TileTimings::Columns() const
+{
+    return columns;
+}
+
+int TileTimings::Rows() const
+{
+    return rows;
+}
+
+int TileTimings::TileCount() const
+{
+    return static_cast<int>(rects.size());
+}
+
+TileTimings::TIMER TileTimings::Timer() const
+{
+    return timer;
+}
+
+QRect TileTimings::TileRect(int index) const
+{
+    return rects.at(index);
+}
+
+void TileTimings::AddSample(int index, double milliseconds)
+{
+    samples.at(index).push_back(milliseconds);
+}
+
+int TileTimings::Samples(int index) const
+{
+    return static_cast<int>(samples.at(index).size());
+}
+
+double TileTimings::Median(int index) const
+{
+    auto sorted = samples.at(index);
+
+    if (sorted.empty()) {
+        return 0.0;
+    }
+
+    const auto median = sorted.begin() + static_cast<long>(sorted.size() / 2);
+    std::nth_element(sorted.begin(), median, sorted.end());
+    return *median;
+}
+
+double TileTimings::MaxMedian() const
+{
+    double maxMedian = 0.0;
+
+    for (int i = 0; i < TileCount(); i++) {
+        maxMedian = std::max(maxMedian, Median(i));
+    }
+
+    return maxMedian;
+}
+
+double TileTimings::TotalMedian() const
+{
+    double total = 0.0;
+
+    for (int i = 0; i < TileCount(); i++) {
+        total += Median(i);
+    }
+
+    return total;
+}
+
+QString TileTimings::ToCSV() const
+{
+    QStringList lines;
+    lines << "row,column,x,y,width,height,median_ms,min_ms,max_ms,samples";
+
+    for (int i = 0; i < TileCount(); i++)
+    {
+        const auto& rect = rects.at(i);
+        const auto& tileSamples = samples.at(i);
+        const auto [minTime, maxTime] = tileSamples.empty()
+                ? std::make_pair(0.0, 0.0)
+                : std::make_pair(*std::min_element(tileSamples.begin(), tileSamples.end()),
+                                 *std::max_element(tileSamples.begin(), tileSamples.end()));
+
+        // Image coordinates, the origin is the top left corner.
+        lines << QString("%1,%2,%3,%4,%5,%6,%7,%8,%9,%10")
+                .arg(i / columns)
+                .arg(i % columns)
+                .arg(rect.x())
+                .arg(size.height() - rect.y() - rect.height())
+                .arg(rect.width())
+                .arg(rect.height())
+                .arg(Median(i), 0, 'f', 4)
+                .arg(minTime, 0, 'f', 4)
+                .arg(maxTime, 0, 'f', 4)
+                .arg(static_cast<int>(tileSamples.size()));
+    }
+
+    return lines.join('\n') + '\n';
+}
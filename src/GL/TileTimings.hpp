@@ -0,0 +1,92 @@
+/**
+ * TileTimings Class
+ *
+ * Render times of the viewport tiles over multiple profiling frames.
+ * Tiles are ordered like the TileScheduler hands them out, from the
+ * top left to the bottom right, rectangles in OpenGL window coordinates.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#ifndef SHADERIDE_GL_TILETIMINGS_HPP
+#define SHADERIDE_GL_TILETIMINGS_HPP
+
+#include <vector>
+#include <QRect>
+#include <QSize>
+#include <QString>
+#include <QMetaType>
+
+namespace ShaderIDE::GL {
+
+    class TileTimings
+    {
+    public:
+        enum class TIMER
+        {
+            GPU, // GL_TIME_ELAPSED queries
+            CPU // Wall clock, tiles are finished one by one (software renderers)
+        };
+
+        TileTimings() = default;
+        TileTimings(const QSize& size, int tileSize, TIMER timer);
+
+        bool Empty() const;
+        QSize Size() const;
+        int TileSize() const;
+        int Columns() const;
+        int Rows() const;
+        int TileCount() const;
+        TIMER Timer() const;
+
+        QRect TileRect(int index) const;
+        void AddSample(int index, double milliseconds);
+        int Samples(int index) const;
+
+        // Milliseconds, single stalls of the driver are ignored.
+        double Median(int index) const;
+        double MaxMedian() const;
+        double TotalMedian() const;
+
+        // One line per tile, rows counted from the top.
+        QString ToCSV() const;
+
+    private:
+        QSize size;
+        int tileSize{ 0 };
+        int columns{ 0 };
+        int rows{ 0 };
+        TIMER timer{ TIMER::GPU };
+
+        std::vector<QRect> rects;
+        std::vector<std::vector<double>> samples;
+    };
+}
+
+// Timings are emitted by the render thread.
+Q_DECLARE_METATYPE(ShaderIDE::GL::TileTimings)
+
+#endif // SHADERIDE_GL_TILETIMINGS_HPP
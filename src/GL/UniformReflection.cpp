@@ -0,0 +1,201 @@
+/**
+ * UniformReflection Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include <QStringList>
+#include <glm/gtc/type_ptr.hpp>
+#include "UniformReflection.hpp"
+#include "HotLiterals.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    // Uniforms set by the renderer itself.
+    const QStringList BUILTIN_UNIFORMS = {
+            "time",
+            "resolution",
+            "mousePos",
+            "jitter",
+            "modelMat",
+            "viewMat",
+            "projectionMat"
+    };
+
+    bool Type(GLenum glType, ShaderUniform::TYPE& type)
+    {
+        switch (glType)
+        {
+            case GL_FLOAT:
+                type = ShaderUniform::TYPE::FLOAT;
+                return true;
+
+            case GL_FLOAT_VEC2:
+                type = ShaderUniform::TYPE::VEC2;
+                return true;
+
+            case GL_FLOAT_VEC3:
+                type = ShaderUniform::TYPE::VEC3;
+                return true;
+
+            case GL_FLOAT_VEC4:
+                type = ShaderUniform::TYPE::VEC4;
+                return true;
+
+            case GL_INT:
+                type = ShaderUniform::TYPE::INT;
+                return true;
+
+            case GL_BOOL:
+                type = ShaderUniform::TYPE::BOOL;
+                return true;
+
+            default:
+                return false;
+        }
+    }
+}
+
+void UniformReflection::Init()
+{
+    initializeOpenGLFunctions();
+}
+
+ShaderUniforms UniformReflection::Reflect(const QList<GLuint>& programs)
+{
+    ShaderUniforms uniforms;
+    QStringList names;
+
+    for (const auto program : programs)
+    {
+        if (program == 0) {
+            continue;
+        }
+
+        GLint numUniforms = 0;
+        glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &numUniforms);
+
+        const std::array<GLenum, 4> properties = { GL_NAME_LENGTH, GL_TYPE, GL_BLOCK_INDEX, GL_ARRAY_SIZE };
+
+        for (GLint i = 0; i < numUniforms; i++)
+        {
+            std::array<GLint, 4> values{};
+            glGetProgramResourceiv(program, GL_UNIFORM, i,
+                                   static_cast<GLsizei>(properties.size()), properties.data(),
+                                   static_cast<GLsizei>(values.size()), nullptr, values.data());
+
+            ShaderUniform uniform;
+
+            // Default block scalars and vectors only, no arrays.
+            if (values.at(2) != -1 || values.at(3) != 1 || !Type(values.at(1), uniform.type)) {
+                continue;
+            }
+
+            QByteArray name(values.at(0), '\0');
+            glGetProgramResourceName(program, GL_UNIFORM, i, values.at(0), nullptr, name.data());
+            uniform.name = QString::fromLatin1(name.constData());
+
+            if (uniform.name.startsWith("gl_") || uniform.name.startsWith(HotLiterals::UNIFORM_PREFIX)
+                || BUILTIN_UNIFORMS.contains(uniform.name) || names.contains(uniform.name)) {
+                continue;
+            }
+
+            const auto location = glGetUniformLocation(program, name.constData());
+
+            if (uniform.type == ShaderUniform::TYPE::INT || uniform.type == ShaderUniform::TYPE::BOOL)
+            {
+                GLint value = 0;
+                glGetUniformiv(program, location, &value);
+                uniform.value.x = static_cast<float>(value);
+
+            } else {
+                glGetUniformfv(program, location, glm::value_ptr(uniform.value));
+            }
+
+            uniform.color = (uniform.type == ShaderUniform::TYPE::VEC3 || uniform.type == ShaderUniform::TYPE::VEC4)
+                            && (uniform.name.contains("color", Qt::CaseInsensitive)
+                                || uniform.name.contains("colour", Qt::CaseInsensitive));
+
+            names << uniform.name;
+            uniforms << uniform;
+        }
+    }
+
+    return uniforms;
+}
+
+void UniformReflection::Apply(GLuint program, const ShaderUniform& uniform, const glm::vec4& value)
+{
+    const auto location = glGetUniformLocation(program, uniform.name.toStdString().c_str());
+
+    if (location == -1) {
+        return;
+    }
+
+    switch (uniform.type)
+    {
+        case ShaderUniform::TYPE::FLOAT:
+            glProgramUniform1f(program, location, value.x);
+            break;
+
+        case ShaderUniform::TYPE::VEC2:
+            glProgramUniform2f(program, location, value.x, value.y);
+            break;
+
+        case ShaderUniform::TYPE::VEC3:
+            glProgramUniform3f(program, location, value.x, value.y, value.z);
+            break;
+
+        case ShaderUniform::TYPE::VEC4:
+            glProgramUniform4f(program, location, value.x, value.y, value.z, value.w);
+            break;
+
+        case ShaderUniform::TYPE::INT:
+        case ShaderUniform::TYPE::BOOL:
+            glProgramUniform1i(program, location, static_cast<GLint>(value.x));
+            break;
+    }
+}
+
+int UniformReflection::Components(const ShaderUniform::TYPE& type)
+{
+    switch (type)
+    {
+        case ShaderUniform::TYPE::VEC2:
+            return 2;
+
+        case ShaderUniform::TYPE::VEC3:
+            return 3;
+
+        case ShaderUniform::TYPE::VEC4:
+            return 4;
+
+        default:
+            return 1;
+    }
+}
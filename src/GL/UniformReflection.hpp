@@ -0,0 +1,86 @@
+/**
+ * UniformReflection Class
+ *
+ * Discovers the user declared uniforms of linked programs,
+ * which are controlled by the uniform panel instead of the source.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GL_UNIFORMREFLECTION_HPP
+#define SHADERIDE_GL_UNIFORMREFLECTION_HPP
+
+#include <QList>
+#include <QString>
+#include <QMetaType>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include <glm/glm.hpp>
+
+namespace ShaderIDE::GL {
+
+    struct ShaderUniform
+    {
+        enum class TYPE
+        {
+            FLOAT,
+            VEC2,
+            VEC3,
+            VEC4,
+            INT,
+            BOOL
+        };
+
+        QString name{ "" };
+        TYPE type{ TYPE::FLOAT };
+        bool color{ false }; // vec3 / vec4 named like a color
+        glm::vec4 value{ glm::vec4(0.0f) }; // Initial value of the program
+
+        bool operator==(const ShaderUniform& other) const
+        {
+            return name == other.name && type == other.type;
+        }
+    };
+
+    using ShaderUniforms = QList<ShaderUniform>;
+
+    class UniformReflection : protected QOpenGLFunctions_4_5_Core
+    {
+    public:
+        void Init();
+
+        // Uniforms of all programs, each name once.
+        ShaderUniforms Reflect(const QList<GLuint>& programs);
+
+        // Applies a value with the function matching the type.
+        void Apply(GLuint program, const ShaderUniform& uniform, const glm::vec4& value);
+
+        static int Components(const ShaderUniform::TYPE& type);
+    };
+}
+
+// Reflected uniforms are emitted by the render thread.
+Q_DECLARE_METATYPE(ShaderIDE::GL::ShaderUniforms)
+
+#endif // SHADERIDE_GL_UNIFORMREFLECTION_HPP
@@ -0,0 +1,298 @@
+/**
+ * AsyncImageDecoder Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <QThread>
+#include <QFile>
+#include <QFileInfo>
+#include <QImageReader>
+#include "AsyncImageDecoder.hpp"
+#include "src/Core/QtUtility.hpp"
+#include "src/GL/TextureManager.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE::GL;
+
+using namespace ShaderIDE::GUI;
+
+AsyncImageDecoder::AsyncImageDecoder(QObject* parent)
+        : QObject(parent)
+{
+    qRegisterMetaType<DecodedImage>("DecodedImage");
+
+    // Leave a core for the UI and the render thread.
+    threadPool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() - 1));
+}
+
+AsyncImageDecoder::~AsyncImageDecoder()
+{
+    threadPool.clear();
+    threadPool.waitForDone();
+}
+
+void AsyncImageDecoder::DecodeFile(const QString& name, const QString& path, bool encode)
+{
+    ImageRequest request;
+    request.name = name;
+    request.path = path;
+    request.encode = encode;
+    request.streamingBytes = streamingLimit;
+    Start(request);
+}
+
+void AsyncImageDecoder::DecodeData(const QString& name, const QByteArray& data)
+{
+    // Project data is already encoded.
+    ImageRequest request;
+    request.name = name;
+    request.data = data;
+    Start(request);
+}
+
+void AsyncImageDecoder::DecodeImage(const QString& name, const QImage& image)
+{
+    ImageRequest request;
+    request.name = name;
+    request.image = image;
+    Start(request);
+}
+
+void AsyncImageDecoder::Cancel(const QString& name)
+{
+    // Results of running requests are dropped.
+    latestRequests[name] = ++nextRequestId;
+}
+
+void AsyncImageDecoder::SetStreamingLimit(qint64 bytes)
+{
+    streamingLimit = bytes;
+}
+
+DecodedImage AsyncImageDecoder::Decode(const ImageRequest& request)
+{
+    // Block compressed textures are not decoded, see DecodeCompressed().
+    if (CompressedImage::IsCompressedFile(request.path) || CompressedImage::IsCompressed(request.data)) {
+        return DecodeCompressed(request);
+    }
+
+    DecodedImage result;
+    result.name = request.name;
+    result.id = request.id;
+
+    if (!request.path.isEmpty()) {
+        result.image = QImage(request.path);
+
+    } else if (!request.data.isEmpty()) {
+        result.image = QImage::fromData(request.data);
+
+    } else {
+        result.image = request.image;
+    }
+
+    if (result.image.isNull())
+    {
+        result.error = request.path.isEmpty()
+                ? QString("Could not decode the image of \"%1\".").arg(request.name)
+                : QString("Could not decode image \"%1\".").arg(request.path);
+
+        return result;
+    }
+
+    result.upload = TextureManager::MakeUploadImage(result.image);
+    result.thumbnail = MakeThumbnail(result.image);
+
+    if (request.encode) {
+        result.base64 = QtUtility::MakeBase64FromImage(result.image);
+    }
+
+    return result;
+}
+
+DecodedImage AsyncImageDecoder::DecodeCompressed(const ImageRequest& request)
+{
+    DecodedImage result;
+    result.name = request.name;
+    result.id = request.id;
+
+    auto data = request.data;
+
+    if (!request.path.isEmpty())
+    {
+        QFile file(request.path);
+
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            result.error = QString("Could not open texture \"%1\".").arg(request.path);
+            return result;
+        }
+
+        data = file.readAll();
+    }
+
+    try
+    {
+        result.compressed = CompressedImage::FromData(data);
+
+    }
+    catch (GeneralException& e)
+    {
+        result.error = QString("Could not load the texture of \"%1\": %2").arg(request.name, e.what());
+        return result;
+    }
+
+    // Only a small level is decoded for the thumbnail, the file is kept for the project.
+    const auto& compressed = result.compressed;
+    const auto preview = compressed.Decode(compressed.LevelForExtent(THUMBNAIL_SIZE));
+
+    if (!preview.isNull()) {
+        result.thumbnail = MakeThumbnail(preview);
+    }
+
+    if (request.encode) {
+        result.base64 = QString::fromLatin1(data.toBase64());
+    }
+
+    return result;
+}
+
+bool AsyncImageDecoder::StreamingRequired(const ImageRequest& request)
+{
+    if (request.streamingBytes <= 0 || request.path.isEmpty() || CompressedImage::IsCompressedFile(request.path)) {
+        return false;
+    }
+
+    // Only the header is read.
+    const auto size = QImageReader(request.path).size();
+
+    return size.isValid()
+           && TextureManager::StorageBytes(size, TextureManager::MipLevels(size), 4) > request.streamingBytes;
+}
+
+DecodedImage AsyncImageDecoder::Stream(const ImageRequest& request,
+                                       const std::function<void(const DecodedImage&)>& proxyDecoded)
+{
+    DecodedImage result;
+    result.name = request.name;
+    result.id = request.id;
+
+    // JPEG is scaled while decoding, the proxy is
+    // shown while the tile pyramid is built.
+    QImageReader reader(request.path);
+
+    if (reader.format() == "jpeg")
+    {
+        reader.setScaledSize(reader.size().scaled(TilePyramid::PROXY_SIZE, TilePyramid::PROXY_SIZE, Qt::KeepAspectRatio));
+        const auto proxy = reader.read();
+
+        if (!proxy.isNull())
+        {
+            auto partial = result;
+            partial.partial = true;
+            partial.upload = TextureManager::MakeUploadImage(proxy);
+            partial.thumbnail = MakeThumbnail(proxy);
+            proxyDecoded(partial);
+        }
+    }
+
+    try
+    {
+        result.pyramid = TilePyramid::Build(request.path, TilePyramid::CacheDirectory(request.path));
+
+    }
+    catch (GeneralException& e)
+    {
+        result.error = QString("Could not stream texture \"%1\": %2").arg(request.path, e.what());
+        return result;
+    }
+
+    // The renderer starts with the same level, see Renderer::SetStreamedTexture().
+    const auto& pyramid = result.pyramid;
+    const auto proxy = pyramid.ReadLevel(pyramid.LevelForExtent(TilePyramid::PROXY_SIZE));
+
+    if (proxy.isNull())
+    {
+        result.error = QString("Could not read the tiles of texture \"%1\".").arg(request.path);
+        return result;
+    }
+
+    result.upload = TextureManager::MakeUploadImage(proxy);
+    result.thumbnail = MakeThumbnail(proxy);
+
+    if (request.encode) {
+        result.path = QFileInfo(request.path).absoluteFilePath();
+    }
+
+    return result;
+}
+
+QImage AsyncImageDecoder::MakeThumbnail(const QImage& image)
+{
+    // Large images are reduced with a fast filter first, a smooth
+    // transformation of the full image takes seconds for 8K images.
+    auto source = image;
+
+    if (std::max(image.width(), image.height()) > THUMBNAIL_SIZE * 4)
+    {
+        source = image.scaled(THUMBNAIL_SIZE * 4, THUMBNAIL_SIZE * 4,
+                              Qt::KeepAspectRatio, Qt::FastTransformation);
+    }
+
+    return source.scaled(THUMBNAIL_SIZE, THUMBNAIL_SIZE,
+                         Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+void AsyncImageDecoder::Start(ImageRequest request)
+{
+    request.id = ++nextRequestId;
+    latestRequests[request.name] = request.id;
+
+    threadPool.start([this, request]() {
+        const auto deliver = [this](const DecodedImage& result) {
+            QMetaObject::invokeMethod(this, [this, result]() {
+                OnDecoded(result);
+            }, Qt::QueuedConnection);
+        };
+
+        deliver(StreamingRequired(request) ? Stream(request, deliver) : Decode(request));
+    });
+}
+
+void AsyncImageDecoder::OnDecoded(const DecodedImage& result)
+{
+    // Superseded or cancelled.
+    if (latestRequests.value(result.name) != result.id) {
+        return;
+    }
+
+    // Proxies are followed by the final result.
+    if (!result.partial) {
+        latestRequests.remove(result.name);
+    }
+
+    emit NotifyImageDecoded(result);
+}
@@ -0,0 +1,119 @@
+/**
+ * AsyncImageDecoder Class
+ *
+ * Decodes texture images on a thread pool. Each result holds the image,
+ * its GL upload copy (RGBA8888, rows flipped), a thumbnail and optionally
+ * the JPEG (base64) data of the project file.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GUI_ASYNCIMAGEDECODER_HPP
+#define SHADERIDE_GUI_ASYNCIMAGEDECODER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <QObject>
+#include <QImage>
+#include <QHash>
+#include <QThreadPool>
+#include <QMetaType>
+#include "src/GL/CompressedImage.hpp"
+#include "src/GL/TilePyramid.hpp"
+
+namespace ShaderIDE::GUI {
+
+    struct ImageRequest
+    {
+        QString name{ "" }; // Texture slot
+        uint64_t id{ 0 };
+
+        // Source, the first one available is used.
+        QString path{ "" };
+        QByteArray data; // Encoded image or KTX2 / DDS file (base64 decoded)
+        QImage image;
+
+        bool encode{ false }; // Make JPEG data for the project
+        qint64 streamingBytes{ 0 }; // Larger files are streamed, 0 for never
+    };
+
+    struct DecodedImage
+    {
+        QString name{ "" };
+        uint64_t id{ 0 };
+        QImage image;
+        QImage upload;
+        GL::CompressedImage compressed; // Uploaded instead of the image, if not null
+        GL::TilePyramid pyramid; // Streamed, the upload is its proxy
+        QString path{ "" }; // Streamed file, kept by the project instead of data
+        bool partial{ false }; // Early proxy, the pyramid follows
+        QImage thumbnail;
+        QString base64{ "" };
+        QString error{ "" };
+    };
+
+    class AsyncImageDecoder : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        static constexpr int THUMBNAIL_SIZE = 128;
+
+        explicit AsyncImageDecoder(QObject* parent = nullptr);
+        ~AsyncImageDecoder() override;
+
+        // A new request replaces pending ones of the same name.
+        void DecodeFile(const QString& name, const QString& path, bool encode = true);
+        void DecodeData(const QString& name, const QByteArray& data);
+        void DecodeImage(const QString& name, const QImage& image);
+        void Cancel(const QString& name);
+        void SetStreamingLimit(qint64 bytes); // GPU memory of the full image
+
+        // Worker Thread
+        static DecodedImage Decode(const ImageRequest& request);
+        static DecodedImage DecodeCompressed(const ImageRequest& request);
+        static bool StreamingRequired(const ImageRequest& request);
+        static DecodedImage Stream(const ImageRequest& request,
+                                   const std::function<void(const DecodedImage&)>& proxyDecoded);
+        static QImage MakeThumbnail(const QImage& image);
+
+    signals:
+        void NotifyImageDecoded(const DecodedImage& result);
+
+    private:
+        QThreadPool threadPool;
+        QHash<QString, uint64_t> latestRequests;
+        uint64_t nextRequestId{ 0 };
+        qint64 streamingLimit{ 0 };
+
+        void Start(ImageRequest request);
+        void OnDecoded(const DecodedImage& result);
+    };
+}
+
+// Results are emitted on the UI thread.
+Q_DECLARE_METATYPE(ShaderIDE::GUI::DecodedImage)
+
+#endif // SHADERIDE_GUI_ASYNCIMAGEDECODER_HPP
@@ -32,6 +32,11 @@
 #include <QMenu>
 #include <QScrollBar>
 #include <QPainter>
+#include <QMap>
+#include <QToolTip>
+#include <QTextCursor>
+#include <algorithm>
+#include <cmath>
 #include "CodeEditor.hpp"
 #include "src/GUI/Style/CodeEditorStyle.hpp"
 #include "src/Core/Application.hpp"
@@ -83,16 +88,58 @@ void CodeEditor::LoadSyntaxFile(const QString& path)
     syntaxHighlighter->LoadSyntaxFile(path);
 }
 
-void CodeEditor::HighlightErrorLine(const int& line, const QColor& color)
+void CodeEditor::SetDiagnostics(const GL::GLSLDiagnosticList& diagnostics)
 {
-    QTextCursor cursor(document()->findBlockByLineNumber(line - 1));
+    using Severity = GL::GLSLDiagnostic::SEVERITY;
 
-    QTextEdit::ExtraSelection selection{};
-    selection.format.setBackground(color);
-    selection.format.setProperty(QTextFormat::FullWidthSelection, true);
-    selection.cursor = cursor;
-    selection.cursor.clearSelection();
-    errorLines.append(selection);
+    // One highlight per line, errors take precedence over warnings.
+    QMap<uint32_t, Severity> lines;
+    QList<QTextEdit::ExtraSelection> columns;
+
+    for (const auto& diagnostic : diagnostics)
+    {
+        if (diagnostic.line == 0) {
+            continue;
+        }
+
+        const auto error = diagnostic.severity == Severity::FAILURE;
+
+        if (error || !lines.contains(diagnostic.line)) {
+            lines.insert(diagnostic.line, diagnostic.severity);
+        }
+
+        // Underline the word at the reported column.
+        const auto block = document()->findBlockByNumber(static_cast<int>(diagnostic.line) - 1);
+
+        if (diagnostic.column > 0 && block.isValid())
+        {
+            const auto column = std::min(static_cast<int>(diagnostic.column) - 1, std::max(block.length() - 2, 0));
+
+            QTextEdit::ExtraSelection selection{};
+            selection.format.setUnderlineStyle(QTextCharFormat::WaveUnderline);
+            selection.format.setUnderlineColor(error ? STYLE_CODEEDITOR_ERROR_UNDERLINE_COLOR
+                                                     : STYLE_CODEEDITOR_WARNING_UNDERLINE_COLOR);
+            selection.cursor = QTextCursor(block);
+            selection.cursor.movePosition(QTextCursor::NextCharacter, QTextCursor::MoveAnchor, column);
+            selection.cursor.select(QTextCursor::WordUnderCursor);
+            columns.append(selection);
+        }
+    }
+
+    errorLines.clear();
+
+    for (auto it = lines.cbegin(); it != lines.cend(); ++it)
+    {
+        QTextEdit::ExtraSelection selection{};
+        selection.format.setBackground(it.value() == Severity::FAILURE ? STYLE_CODEEDITOR_ERROR_COLOR
+                                                                     : STYLE_CODEEDITOR_WARNING_COLOR);
+        selection.format.setProperty(QTextFormat::FullWidthSelection, true);
+        selection.cursor = QTextCursor(document()->findBlockByNumber(static_cast<int>(it.key()) - 1));
+        selection.cursor.clearSelection();
+        errorLines.append(selection);
+    }
+
+    errorLines.append(columns);
     ApplyExtraSelections();
 }
 
@@ -155,6 +202,21 @@ void CodeEditor::ResetSearchLines()
     ApplyExtraSelections();
 }
 
+void CodeEditor::SetHotLiteralsEnabled(bool enabled)
+{
+    hotLiteralsEnabled = enabled;
+    hotLiterals = enabled ? GL::HotLiterals::Find(toPlainText()) : GL::HotLiteralList();
+
+    // Hovered literals change the cursor.
+    viewport()->setMouseTracking(enabled);
+    viewport()->setCursor(Qt::IBeamCursor);
+}
+
+bool CodeEditor::HotLiteralsEnabled() const
+{
+    return hotLiteralsEnabled;
+}
+
 void CodeEditor::OnIncreaseFontSize()
 {
     ApplyFontScale(1.0f);
@@ -167,6 +229,10 @@ void CodeEditor::OnDecreaseFontSize()
 
 void CodeEditor::OnCodeChanged()
 {
+    if (hotLiteralsEnabled) {
+        hotLiterals = GL::HotLiterals::Find(toPlainText());
+    }
+
     emit NotifyCodeChanged(toPlainText());
 }
 
@@ -217,16 +283,66 @@ void CodeEditor::keyReleaseEvent(QKeyEvent* event)
 
 void CodeEditor::mousePressEvent(QMouseEvent* event)
 {
+    if (hotLiteralsEnabled && event->button() == Qt::LeftButton)
+    {
+        hotLiteralIndex = HotLiteralAt(event->position().toPoint());
+
+        if (hotLiteralIndex != -1)
+        {
+            hotLiteral = hotLiterals.at(hotLiteralIndex);
+            hotLiteralValue = hotLiteral.value;
+            hotLiteralStartX = event->position().toPoint().x();
+        }
+    }
+
     QPlainTextEdit::mousePressEvent(event);
     UpdateLineNumberArea();
 }
 
 void CodeEditor::mouseReleaseEvent(QMouseEvent* event)
 {
+    if (hotLiteralScrubbing) {
+        BakeHotLiteral();
+    }
+
+    hotLiteralScrubbing = false;
+    hotLiteralIndex = -1;
+
     QPlainTextEdit::mouseReleaseEvent(event);
     emit NotifyMouseReleased();
 }
 
+void CodeEditor::mouseMoveEvent(QMouseEvent* event)
+{
+    const auto position = event->position().toPoint();
+
+    if (hotLiteralIndex != -1 && (event->buttons() & Qt::LeftButton))
+    {
+        const auto dx = position.x() - hotLiteralStartX;
+
+        if (hotLiteralScrubbing || std::abs(dx) >= HOT_LITERAL_DRAG_THRESHOLD)
+        {
+            // The text is only changed on release, until then
+            // the value is sent to the renderer as a uniform.
+            hotLiteralScrubbing = true;
+
+            const auto precision = event->modifiers() & Qt::ShiftModifier ? 0.1f : 1.0f;
+            const auto step = std::max(std::abs(hotLiteral.value), 0.1f) * HOT_LITERAL_SENSITIVITY * precision;
+            hotLiteralValue = hotLiteral.value + static_cast<float>(dx) * step;
+
+            QToolTip::showText(event->globalPosition().toPoint(), GL::HotLiterals::Format(hotLiteral, hotLiteralValue), this);
+            emit NotifyHotLiteralChanged(hotLiteralIndex, hotLiteralValue);
+            return;
+        }
+    }
+
+    if (hotLiteralsEnabled && event->buttons() == Qt::NoButton) {
+        viewport()->setCursor(HotLiteralAt(position) != -1 ? Qt::SizeHorCursor : Qt::IBeamCursor);
+    }
+
+    QPlainTextEdit::mouseMoveEvent(event);
+}
+
 void CodeEditor::wheelEvent(QWheelEvent* event)
 {
     if (fontScalingEnabled)
@@ -372,3 +488,21 @@ void CodeEditor::ApplyExtraSelections()
     selections.append(searchLines);
     setExtraSelections(selections);
 }
+
+int CodeEditor::HotLiteralAt(const QPoint& position) const
+{
+    return GL::HotLiterals::IndexAt(hotLiterals, cursorForPosition(position).position());
+}
+
+void CodeEditor::BakeHotLiteral()
+{
+    const auto edit = GL::HotLiterals::Bake(toPlainText(), hotLiteral, hotLiteralValue);
+
+    // A single edit, so it's undone at once.
+    QTextCursor cursor(document());
+    cursor.setPosition(edit.position);
+    cursor.setPosition(edit.position + edit.length, QTextCursor::KeepAnchor);
+    cursor.insertText(edit.text);
+
+    QToolTip::hideText();
+}
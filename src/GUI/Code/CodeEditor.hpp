@@ -33,6 +33,8 @@
 #include <QShortcut>
 #include "SyntaxHighlighter.hpp"
 #include "LineNumberArea.hpp"
+#include "src/GL/GLSLDiagnostics.hpp"
+#include "src/GL/HotLiterals.hpp"
 
 namespace ShaderIDE::GUI {
 
@@ -44,6 +46,8 @@ namespace ShaderIDE::GUI {
 
         static constexpr float FONT_SIZE_MIN = 6.0f;
         static constexpr float FONT_SIZE_MAX = 100.0f;
+        static constexpr int HOT_LITERAL_DRAG_THRESHOLD = 3; // Pixels
+        static constexpr float HOT_LITERAL_SENSITIVITY = 0.005f; // Relative change per pixel
 
     public:
         explicit CodeEditor(QWidget* parent = nullptr);
@@ -51,11 +55,16 @@ namespace ShaderIDE::GUI {
 
         void LoadSyntaxFile(const QString& path);
 
-        void HighlightErrorLine(const int& line, const QColor& color);
+        // Replaces all diagnostic highlights at once.
+        void SetDiagnostics(const ShaderIDE::GL::GLSLDiagnosticList& diagnostics);
         void ResetErrorLines();
 
         void ToggleWordWrap();
 
+        // Float literals are scrubbed by dragging them horizontally.
+        void SetHotLiteralsEnabled(bool enabled);
+        bool HotLiteralsEnabled() const;
+
         void Find(const QString& text,
                   bool caseSensitive = false,
                   bool words = false);
@@ -65,6 +74,7 @@ namespace ShaderIDE::GUI {
     signals:
         void NotifyCodeChanged(const QString& code);
         void NotifyMouseReleased();
+        void NotifyHotLiteralChanged(int index, float value);
 
     public slots:
         void OnIncreaseFontSize();
@@ -81,6 +91,7 @@ namespace ShaderIDE::GUI {
         void keyReleaseEvent(QKeyEvent* event) override;
         void mousePressEvent(QMouseEvent* event) override;
         void mouseReleaseEvent(QMouseEvent* event) override;
+        void mouseMoveEvent(QMouseEvent* event) override;
         void wheelEvent(QWheelEvent* event) override;
         void contextMenuEvent(QContextMenuEvent* event) override;
         void resizeEvent(QResizeEvent* event) override;
@@ -96,6 +107,15 @@ namespace ShaderIDE::GUI {
         QList<QTextEdit::ExtraSelection> cursorLines;
         QList<QTextEdit::ExtraSelection> searchLines;
 
+        // Hot Literals
+        bool hotLiteralsEnabled{ false };
+        ShaderIDE::GL::HotLiteralList hotLiterals;
+        ShaderIDE::GL::HotLiteral hotLiteral;
+        int hotLiteralIndex{ -1 };
+        float hotLiteralValue{ 0.0f };
+        int hotLiteralStartX{ 0 };
+        bool hotLiteralScrubbing{ false };
+
         QShortcut* increaseFontSizeSC{ nullptr };
         QShortcut* decreaseFontSizeSC{ nullptr };
 
@@ -112,6 +132,9 @@ namespace ShaderIDE::GUI {
         void ApplyFontScale(const float& value);
 
         void ApplyExtraSelections();
+
+        int HotLiteralAt(const QPoint& position) const;
+        void BakeHotLiteral();
     };
 }
 
@@ -0,0 +1,138 @@
+/**
+ * CompileScheduler Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "CompileScheduler.hpp"
+#include "src/Core/Hash.hpp"
+#include "src/GL/GLSLFingerprint.hpp"
+
+using namespace ShaderIDE::GUI;
+using namespace ShaderIDE::GL;
+
+CompileScheduler::CompileScheduler(QObject* parent)
+        : QObject(parent)
+{
+    delayTimer.setSingleShot(true);
+    delayTimer.setInterval(SHADERIDE_CODE_EDITOR_COMPILE_DELAY);
+
+    connect(&delayTimer, SIGNAL(timeout()),
+            this, SLOT(OnDelayElapsed()));
+
+    sessionTimer.setSingleShot(true);
+    sessionTimer.setInterval(SESSION_TIMEOUT);
+
+    connect(&sessionTimer, SIGNAL(timeout()),
+            this, SLOT(OnSessionEnded()));
+}
+
+void CompileScheduler::SetDelay(int milliseconds)
+{
+    delayTimer.setInterval(qMax(0, milliseconds));
+}
+
+int CompileScheduler::Delay() const
+{
+    return delayTimer.interval();
+}
+
+void CompileScheduler::Request(const QString& vertexShaderSource,
+                               const QString& fragmentShaderSource,
+                               const QString& computeShaderSource)
+{
+    pendingVertexShaderSource = vertexShaderSource;
+    pendingFragmentShaderSource = fragmentShaderSource;
+    pendingComputeShaderSource = computeShaderSource;
+    requestedCompiles++;
+
+    // Every request restarts the delay, so only
+    // the last one of a typing burst compiles.
+    delayTimer.start();
+    sessionTimer.start();
+}
+
+void CompileScheduler::MarkCompiled(const QString& vertexShaderSource,
+                                    const QString& fragmentShaderSource,
+                                    const QString& computeShaderSource)
+{
+    // Compiled directly (i.e. by shortcut), a pending request is obsolete.
+    delayTimer.stop();
+    compiledFingerprint = Fingerprint(vertexShaderSource, fragmentShaderSource, computeShaderSource);
+}
+
+void CompileScheduler::Invalidate()
+{
+    // Failed compilations are repeated for equal sources, error lines may have moved.
+    compiledFingerprint = 0;
+}
+
+void CompileScheduler::OnDelayElapsed()
+{
+    const auto fingerprint = Fingerprint(pendingVertexShaderSource,
+                                         pendingFragmentShaderSource,
+                                         pendingComputeShaderSource);
+
+    // Only comments or whitespace changed.
+    if (fingerprint == compiledFingerprint)
+    {
+        skippedCompiles++;
+        return;
+    }
+
+    compiledFingerprint = fingerprint;
+    issuedCompiles++;
+
+    emit NotifyCompile();
+}
+
+void CompileScheduler::OnSessionEnded()
+{
+    if (requestedCompiles == 0) {
+        return;
+    }
+
+    emit NotifyLogMessage(
+            QString("Realtime compilation: %1 requested, %2 issued, %3 skipped (unchanged).")
+                    .arg(requestedCompiles)
+                    .arg(issuedCompiles)
+                    .arg(skippedCompiles)
+    );
+
+    requestedCompiles = 0;
+    issuedCompiles = 0;
+    skippedCompiles = 0;
+}
+
+uint64_t CompileScheduler::Fingerprint(const QString& vertexShaderSource,
+                                       const QString& fragmentShaderSource,
+                                       const QString& computeShaderSource)
+{
+    return Hash()
+            .Add(GLSLFingerprint::Compute(vertexShaderSource))
+            .Add(GLSLFingerprint::Compute(fragmentShaderSource))
+            .Add(GLSLFingerprint::Compute(computeShaderSource))
+            .Value();
+}
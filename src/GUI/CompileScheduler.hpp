@@ -0,0 +1,93 @@
+/**
+ * CompileScheduler Class
+ *
+ * Debounces realtime compilation requests of the code editors. Requests
+ * arriving within the delay are coalesced into a single compilation, which
+ * is skipped if the normalized sources did not change.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GUI_COMPILESCHEDULER_HPP
+#define SHADERIDE_GUI_COMPILESCHEDULER_HPP
+
+#include <cstdint>
+#include <QObject>
+#include <QTimer>
+#include "src/Core/ApplicationDefaults.hpp"
+
+namespace ShaderIDE::GUI {
+
+    class CompileScheduler : public QObject
+    {
+        Q_OBJECT
+
+        static constexpr int SESSION_TIMEOUT = 5000; // Milliseconds
+
+    public:
+        explicit CompileScheduler(QObject* parent = nullptr);
+
+        void SetDelay(int milliseconds);
+        int Delay() const;
+
+        void Request(const QString& vertexShaderSource,
+                     const QString& fragmentShaderSource,
+                     const QString& computeShaderSource = "");
+
+        void MarkCompiled(const QString& vertexShaderSource,
+                          const QString& fragmentShaderSource,
+                          const QString& computeShaderSource = "");
+
+        void Invalidate();
+
+    signals:
+        void NotifyCompile();
+        void NotifyLogMessage(const QString& message);
+
+    private slots:
+        void OnDelayElapsed();
+        void OnSessionEnded();
+
+    private:
+        QTimer delayTimer;
+        QTimer sessionTimer;
+
+        QString pendingVertexShaderSource{ "" };
+        QString pendingFragmentShaderSource{ "" };
+        QString pendingComputeShaderSource{ "" };
+        uint64_t compiledFingerprint{ 0 };
+
+        // Editing Session Statistics
+        int requestedCompiles{ 0 };
+        int issuedCompiles{ 0 };
+        int skippedCompiles{ 0 };
+
+        static uint64_t Fingerprint(const QString& vertexShaderSource,
+                                    const QString& fragmentShaderSource,
+                                    const QString& computeShaderSource);
+    };
+}
+
+#endif // SHADERIDE_GUI_COMPILESCHEDULER_HPP
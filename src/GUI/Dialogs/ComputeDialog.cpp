@@ -0,0 +1,228 @@
+/**
+ * ComputeDialog Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#include "ComputeDialog.hpp"
+#include "src/Core/Memory.hpp"
+#include "src/GL/GLDefaults.hpp"
+#include "src/GUI/Style/ComputeDialogStyle.hpp"
+
+using namespace ShaderIDE::GUI;
+
+ComputeDialog::ComputeDialog(QWidget* parent)
+        : QDialog(parent)
+{
+    InitLayout();
+    InitDispatchSection();
+    InitBindingsSection();
+    InitButtonLayout();
+}
+
+ComputeDialog::~ComputeDialog()
+{
+    // Buttons
+    Memory::Release(btApply);
+    Memory::Release(btDispatch);
+    Memory::Release(statusLabel);
+    Memory::Release(buttonLayout);
+
+    // Bindings
+    Memory::Release(bindingsNote);
+    Memory::Release(teBindings);
+    Memory::Release(bindingsTitle);
+
+    // Dispatch
+    Memory::Release(sbGroupsZ);
+    Memory::Release(sbGroupsY);
+    Memory::Release(sbGroupsX);
+    Memory::Release(groupsLabel);
+    Memory::Release(groupsLayout);
+    Memory::Release(cbEveryFrame);
+    Memory::Release(cbEnabled);
+    Memory::Release(modeLayout);
+    Memory::Release(dispatchTitle);
+
+    // Main Layout
+    Memory::Release(mainLayout);
+}
+
+ComputeSettings ComputeDialog::Settings()
+{
+    ComputeSettings settings;
+    settings.enabled = cbEnabled->isChecked();
+    settings.everyFrame = cbEveryFrame->isChecked();
+    settings.groupsX = sbGroupsX->value();
+    settings.groupsY = sbGroupsY->value();
+    settings.groupsZ = sbGroupsZ->value();
+    settings.bindings = ComputeBindings::Parse(teBindings->toPlainText());
+    return settings;
+}
+
+void ComputeDialog::SetSettings(const ComputeSettings& settings)
+{
+    cbEnabled->setChecked(settings.enabled);
+    cbEveryFrame->setChecked(settings.everyFrame);
+    sbGroupsX->setValue(settings.groupsX);
+    sbGroupsY->setValue(settings.groupsY);
+    sbGroupsZ->setValue(settings.groupsZ);
+    teBindings->setPlainText(ComputeBindings::Format(settings.bindings));
+    statusLabel->setText("");
+}
+
+void ComputeDialog::ShowError(const QString& message)
+{
+    statusLabel->setText(message);
+}
+
+void ComputeDialog::OnComputeTimings(double lastTime, double medianTime, int dispatches)
+{
+    statusLabel->setText(
+            QString("Last: %1 ms, median: %2 ms (%3 dispatches).")
+                    .arg(lastTime, 0, 'f', 3)
+                    .arg(medianTime, 0, 'f', 3)
+                    .arg(dispatches)
+    );
+}
+
+void ComputeDialog::OnApply()
+{
+    statusLabel->setText("");
+    emit NotifyApplyComputeSettings();
+}
+
+void ComputeDialog::InitLayout()
+{
+    // Window
+    setWindowTitle("Compute Shader");
+    setWindowFlags(Qt::WindowCloseButtonHint);
+    setMinimumSize(500, 400);
+    setStyleSheet(STYLE_COMPUTEDIALOG);
+
+    // Main Layout
+    mainLayout = new QVBoxLayout();
+    mainLayout->setContentsMargins(10, 10, 10, 10);
+    mainLayout->setSpacing(10);
+    setLayout(mainLayout);
+}
+
+void ComputeDialog::InitDispatchSection()
+{
+    // Title
+    dispatchTitle = new QLabel("Dispatch");
+    dispatchTitle->setProperty("class", "title");
+    mainLayout->addWidget(dispatchTitle);
+
+    // Mode
+    modeLayout = new QHBoxLayout();
+    modeLayout->setContentsMargins(0, 0, 0, 0);
+    modeLayout->setSpacing(10);
+    mainLayout->addLayout(modeLayout);
+
+    cbEnabled = new QCheckBox("Enabled");
+    modeLayout->addWidget(cbEnabled);
+
+    // Otherwise only dispatched by the button or after changes of the shader or bindings.
+    cbEveryFrame = new QCheckBox("Dispatch Every Frame");
+    cbEveryFrame->setChecked(true);
+    modeLayout->addWidget(cbEveryFrame);
+    modeLayout->addStretch(1);
+
+    // Work Groups
+    groupsLayout = new QHBoxLayout();
+    groupsLayout->setContentsMargins(0, 0, 0, 0);
+    groupsLayout->setSpacing(10);
+    mainLayout->addLayout(groupsLayout);
+
+    groupsLabel = new QLabel("Work Groups (X, Y, Z)");
+    groupsLayout->addWidget(groupsLabel, 1);
+
+    sbGroupsX = MakeGroupsSpinBox();
+    sbGroupsY = MakeGroupsSpinBox();
+    sbGroupsZ = MakeGroupsSpinBox();
+    groupsLayout->addWidget(sbGroupsX);
+    groupsLayout->addWidget(sbGroupsY);
+    groupsLayout->addWidget(sbGroupsZ);
+}
+
+void ComputeDialog::InitBindingsSection()
+{
+    // Title
+    bindingsTitle = new QLabel("Bindings");
+    bindingsTitle->setProperty("class", "title");
+    mainLayout->addWidget(bindingsTitle);
+
+    // Bindings, one per line.
+    teBindings = new QPlainTextEdit();
+    teBindings->setPlaceholderText("image 0 512x512\nbuffer 1 4096");
+    mainLayout->addWidget(teBindings, 1);
+
+    // Note
+    bindingsNote = new QLabel(
+            QString("One binding per line: \"buffer <binding> <bytes>\" for zero initialized shader storage "
+                    "buffers, \"image <binding> <width>x<height>\" for rgba32f images (bindings 0 to %1). "
+                    "The first image is available as sampler2D %2 in the vertex and fragment shader.")
+                    .arg(ComputeBindings::MAX_BINDING)
+                    .arg(GLSL_COMPUTE_OUTPUT_NAME));
+
+    bindingsNote->setProperty("class", "note");
+    bindingsNote->setWordWrap(true);
+    mainLayout->addWidget(bindingsNote);
+}
+
+void ComputeDialog::InitButtonLayout()
+{
+    buttonLayout = new QHBoxLayout();
+    buttonLayout->setContentsMargins(0, 0, 0, 0);
+    buttonLayout->setSpacing(10);
+    mainLayout->addLayout(buttonLayout);
+
+    // Errors and dispatch times
+    statusLabel = new QLabel("");
+    statusLabel->setWordWrap(true);
+    buttonLayout->addWidget(statusLabel, 1);
+
+    btDispatch = new QPushButton("Dispatch");
+    buttonLayout->addWidget(btDispatch);
+
+    btApply = new QPushButton("Apply");
+    buttonLayout->addWidget(btApply);
+
+    connect(btDispatch, SIGNAL(clicked(bool)),
+            this, SIGNAL(NotifyDispatchCompute()));
+
+    connect(btApply, SIGNAL(clicked(bool)),
+            this, SLOT(OnApply()));
+}
+
+QSpinBox* ComputeDialog::MakeGroupsSpinBox()
+{
+    auto* spinBox = new QSpinBox();
+    spinBox->setRange(1, ComputeBindings::MAX_GROUPS);
+    spinBox->setValue(1);
+    return spinBox;
+}
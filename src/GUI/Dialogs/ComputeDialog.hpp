@@ -0,0 +1,107 @@
+/**
+ * ComputeDialog Class
+ *
+ * Settings of the compute shader stage: bindings, dispatch size
+ * and the GPU time of the last dispatches.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#ifndef SHADERIDE_GUI_DIALOGS_COMPUTEDIALOG_HPP
+#define SHADERIDE_GUI_DIALOGS_COMPUTEDIALOG_HPP
+
+#include <QDialog>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QLabel>
+#include <QCheckBox>
+#include <QSpinBox>
+#include <QPlainTextEdit>
+#include "src/GL/ComputeBindings.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace ShaderIDE::GUI {
+
+    class ComputeDialog : public QDialog
+    {
+        Q_OBJECT
+
+    public:
+        explicit ComputeDialog(QWidget* parent = nullptr);
+        ~ComputeDialog() override;
+
+        // Throws GeneralException for invalid bindings.
+        ComputeSettings Settings();
+        void SetSettings(const ComputeSettings& settings);
+        void ShowError(const QString& message);
+
+    signals:
+        void NotifyApplyComputeSettings();
+        void NotifyDispatchCompute();
+
+    public slots:
+        void OnComputeTimings(double lastTime, double medianTime, int dispatches);
+
+    private slots:
+        void OnApply();
+
+    private:
+        QVBoxLayout* mainLayout{ nullptr };
+
+        // Dispatch
+        QLabel* dispatchTitle{ nullptr };
+        QHBoxLayout* modeLayout{ nullptr };
+        QCheckBox* cbEnabled{ nullptr };
+        QCheckBox* cbEveryFrame{ nullptr };
+        QHBoxLayout* groupsLayout{ nullptr };
+        QLabel* groupsLabel{ nullptr };
+        QSpinBox* sbGroupsX{ nullptr };
+        QSpinBox* sbGroupsY{ nullptr };
+        QSpinBox* sbGroupsZ{ nullptr };
+
+        // Bindings
+        QLabel* bindingsTitle{ nullptr };
+        QPlainTextEdit* teBindings{ nullptr };
+        QLabel* bindingsNote{ nullptr };
+
+        // Buttons
+        QHBoxLayout* buttonLayout{ nullptr };
+        QLabel* statusLabel{ nullptr };
+        QPushButton* btDispatch{ nullptr };
+        QPushButton* btApply{ nullptr };
+
+        void InitLayout();
+        void InitDispatchSection();
+        void InitBindingsSection();
+        void InitButtonLayout();
+
+        static QSpinBox* MakeGroupsSpinBox();
+    };
+}
+
+#endif // SHADERIDE_GUI_DIALOGS_COMPUTEDIALOG_HPP
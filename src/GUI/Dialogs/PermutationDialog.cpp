@@ -0,0 +1,219 @@
+/**
+ * PermutationDialog Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cmath>
+#include <QHeaderView>
+#include "PermutationDialog.hpp"
+#include "src/Core/Memory.hpp"
+#include "src/GUI/Style/PermutationDialogStyle.hpp"
+
+using namespace ShaderIDE::GUI;
+
+namespace {
+
+    // Items with numbers are sorted by value, not by text.
+    QTableWidgetItem* NumberItem(double value)
+    {
+        auto* item = new QTableWidgetItem();
+        item->setData(Qt::DisplayRole, std::round(value * 1000.0) / 1000.0);
+        item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+        return item;
+    }
+}
+
+PermutationDialog::PermutationDialog(QWidget* parent)
+        : QDialog(parent)
+{
+    InitLayout();
+    InitAxesSection();
+    InitBuildLayout();
+    InitResultsSection();
+}
+
+PermutationDialog::~PermutationDialog()
+{
+    // Results
+    Memory::Release(resultsTable);
+    Memory::Release(resultsTitle);
+
+    // Build
+    Memory::Release(btBuild);
+    Memory::Release(statusLabel);
+    Memory::Release(cbBenchmark);
+    Memory::Release(buildLayout);
+
+    // Axes
+    Memory::Release(axesNote);
+    Memory::Release(teAxes);
+    Memory::Release(axesTitle);
+
+    // Main Layout
+    Memory::Release(mainLayout);
+}
+
+QString PermutationDialog::Axes()
+{
+    return teAxes->toPlainText();
+}
+
+void PermutationDialog::SetAxes(const QString& axes)
+{
+    teAxes->setPlainText(axes);
+}
+
+void PermutationDialog::ShowError(const QString& message)
+{
+    statusLabel->setText(message);
+    btBuild->setEnabled(true);
+}
+
+void PermutationDialog::OnPermutationResults(const PermutationResults& results)
+{
+    // Sorting is suspended, rows would move while being filled otherwise.
+    resultsTable->setSortingEnabled(false);
+    resultsTable->clearContents();
+    resultsTable->setRowCount(static_cast<int>(results.size()));
+
+    int failed = 0;
+
+    for (int row = 0; row < results.size(); row++)
+    {
+        const auto& result = results.at(row);
+
+        auto* statusItem = new QTableWidgetItem(result.success ? "OK" : "Failed");
+        statusItem->setForeground(result.success ? QColor("#54CF49") : QColor("#CF3550")); // TODO Stylesheet.
+
+        resultsTable->setItem(row, VARIANT, new QTableWidgetItem(ShaderPermutations::Name(result.defines)));
+        resultsTable->setItem(row, STATUS, statusItem);
+        resultsTable->setItem(row, ERROR_MESSAGE, new QTableWidgetItem(result.error));
+
+        if (result.success)
+        {
+            resultsTable->setItem(row, COMPILE_TIME, NumberItem(static_cast<double>(result.compileTime)));
+            resultsTable->setItem(row, LINK_TIME, NumberItem(static_cast<double>(result.linkTime)));
+
+        } else {
+            failed++;
+        }
+
+        if (result.frameTime >= 0.0) {
+            resultsTable->setItem(row, FRAME_TIME, NumberItem(result.frameTime));
+        }
+    }
+
+    resultsTable->setSortingEnabled(true);
+    resultsTable->resizeColumnsToContents();
+
+    statusLabel->setText(QString("%1 variants, %2 failed.").arg(results.size()).arg(failed));
+    btBuild->setEnabled(true);
+}
+
+void PermutationDialog::OnBuild()
+{
+    statusLabel->setText("Building...");
+    btBuild->setEnabled(false);
+
+    emit NotifyBuildPermutations(teAxes->toPlainText(), cbBenchmark->isChecked());
+}
+
+void PermutationDialog::InitLayout()
+{
+    // Window
+    setWindowTitle("Shader Permutations");
+    setWindowFlags(Qt::WindowCloseButtonHint);
+    setMinimumSize(700, 550);
+    setStyleSheet(STYLE_PERMUTATIONDIALOG);
+
+    // Main Layout
+    mainLayout = new QVBoxLayout();
+    mainLayout->setContentsMargins(10, 10, 10, 10);
+    mainLayout->setSpacing(10);
+    setLayout(mainLayout);
+}
+
+void PermutationDialog::InitAxesSection()
+{
+    // Title
+    axesTitle = new QLabel("Define Axes");
+    axesTitle->setProperty("class", "title");
+    mainLayout->addWidget(axesTitle);
+
+    // Axes, one per line.
+    teAxes = new QPlainTextEdit();
+    teAxes->setFixedHeight(100);
+    teAxes->setPlaceholderText("USE_SHADOWS={0,1}\nQUALITY={0,1,2}");
+    mainLayout->addWidget(teAxes);
+
+    // Note
+    axesNote = new QLabel(
+            QString("One axis per line. Every combination is compiled with its values as #define "
+                    "(at most %1 variants).").arg(ShaderPermutations::MAX_PERMUTATIONS));
+
+    axesNote->setProperty("class", "note");
+    axesNote->setWordWrap(true);
+    mainLayout->addWidget(axesNote);
+}
+
+void PermutationDialog::InitBuildLayout()
+{
+    buildLayout = new QHBoxLayout();
+    buildLayout->setContentsMargins(0, 0, 0, 0);
+    buildLayout->setSpacing(10);
+    mainLayout->addLayout(buildLayout);
+
+    // Frame times are measured with the current mesh and viewport size.
+    cbBenchmark = new QCheckBox("Benchmark Frame Time");
+    buildLayout->addWidget(cbBenchmark);
+
+    statusLabel = new QLabel("");
+    buildLayout->addWidget(statusLabel, 1);
+
+    btBuild = new QPushButton("Build");
+    buildLayout->addWidget(btBuild);
+
+    connect(btBuild, SIGNAL(clicked(bool)),
+            this, SLOT(OnBuild()));
+}
+
+void PermutationDialog::InitResultsSection()
+{
+    // Title
+    resultsTitle = new QLabel("Variants");
+    resultsTitle->setProperty("class", "title");
+    mainLayout->addWidget(resultsTitle);
+
+    // Table, sortable by each column.
+    resultsTable = new QTableWidget(0, NUM_COLUMNS);
+    resultsTable->setHorizontalHeaderLabels({ "Variant", "Status", "Compile (ms)", "Link (ms)", "Frame (ms)", "Error" });
+    resultsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    resultsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    resultsTable->verticalHeader()->setVisible(false);
+    resultsTable->horizontalHeader()->setStretchLastSection(true);
+    resultsTable->setSortingEnabled(true);
+    mainLayout->addWidget(resultsTable, 1);
+}
@@ -0,0 +1,106 @@
+/**
+ * PermutationDialog Class
+ *
+ * Declares define axes, builds all shader permutations and
+ * lists their compile status, link and frame times.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GUI_DIALOGS_PERMUTATIONDIALOG_HPP
+#define SHADERIDE_GUI_DIALOGS_PERMUTATIONDIALOG_HPP
+
+#include <QDialog>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QLabel>
+#include <QCheckBox>
+#include <QPlainTextEdit>
+#include <QTableWidget>
+#include "src/GL/ShaderPermutations.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace ShaderIDE::GUI {
+
+    class PermutationDialog : public QDialog
+    {
+        Q_OBJECT
+
+        enum COLUMN
+        {
+            VARIANT,
+            STATUS,
+            COMPILE_TIME,
+            LINK_TIME,
+            FRAME_TIME,
+            ERROR_MESSAGE,
+            NUM_COLUMNS
+        };
+
+    public:
+        explicit PermutationDialog(QWidget* parent = nullptr);
+        ~PermutationDialog() override;
+
+        QString Axes();
+        void SetAxes(const QString& axes);
+        void ShowError(const QString& message);
+
+    signals:
+        void NotifyBuildPermutations(const QString& axes, bool benchmark);
+
+    public slots:
+        void OnPermutationResults(const PermutationResults& results);
+
+    private slots:
+        void OnBuild();
+
+    private:
+        QVBoxLayout* mainLayout{ nullptr };
+
+        // Axes
+        QLabel* axesTitle{ nullptr };
+        QPlainTextEdit* teAxes{ nullptr };
+        QLabel* axesNote{ nullptr };
+
+        // Build
+        QHBoxLayout* buildLayout{ nullptr };
+        QCheckBox* cbBenchmark{ nullptr };
+        QLabel* statusLabel{ nullptr };
+        QPushButton* btBuild{ nullptr };
+
+        // Results
+        QLabel* resultsTitle{ nullptr };
+        QTableWidget* resultsTable{ nullptr };
+
+        void InitLayout();
+        void InitAxesSection();
+        void InitBuildLayout();
+        void InitResultsSection();
+    };
+}
+
+#endif // SHADERIDE_GUI_DIALOGS_PERMUTATIONDIALOG_HPP
@@ -40,6 +40,7 @@ SettingsDialog::SettingsDialog(MainWindow* mainWindow)
     InitLayout();
     InitViewportSection();
     InitCodeEditorSection();
+    InitExportSection();
     InitButtonLayout();
 }
 
@@ -49,14 +50,23 @@ SettingsDialog::~SettingsDialog()
     Memory::Release(btSave);
     Memory::Release(buttonLayout);
 
+    // Export
+    Memory::Release(lePostExportCommand);
+    Memory::Release(exportForm);
+    Memory::Release(exportTitle);
+    Memory::Release(exportLayout);
+
     // Code Editor
+    Memory::Release(cboxShaderStages);
+    Memory::Release(cboxCompileDelay);
     Memory::Release(cboxTabWidth);
     Memory::Release(codeEditorForm);
     Memory::Release(codeEditorTitle);
     Memory::Release(codeEditorLayout);
 
     // 3D Viewport
-    Memory::Release(viewportRestartNote);
+    Memory::Release(viewportSamplesNote);
+    Memory::Release(cboxTextureMemory);
     Memory::Release(cboxMultisampling);
     Memory::Release(viewportForm);
     Memory::Release(viewportTitle);
@@ -84,7 +94,7 @@ void SettingsDialog::InitLayout()
     setWindowTitle("Settings");
     setWindowFlags(Qt::WindowCloseButtonHint);
     setFixedWidth(500);
-    setFixedHeight(300);
+    setFixedHeight(510);
     setStyleSheet(STYLE_SETTINGSDIALOG);
 
     // Main Layout
@@ -118,15 +128,28 @@ void SettingsDialog::InitViewportSection()
     cboxMultisampling->addItem("2 Samples", 2);
     cboxMultisampling->addItem("4 Samples", 4);
     cboxMultisampling->addItem("8 Samples", 8);
+    cboxMultisampling->addItem("16 Samples", 16);
     viewportForm->addRow("Multisampling", cboxMultisampling);
     viewportForm->setAlignment(cboxMultisampling, Qt::AlignRight);
 
-    // Restart Note
-    viewportRestartNote = new QLabel("Application restart required for multisampling to be applied.");
-
-    viewportRestartNote->setProperty("class", "note");
-    viewportRestartNote->setWordWrap(true);
-    viewportLayout->addWidget(viewportRestartNote);
+    // Texture Memory per Slot, larger images are streamed from a tile pyramid.
+    cboxTextureMemory = new QComboBox();
+    cboxTextureMemory->setFixedWidth(120);
+    cboxTextureMemory->addItem("64 MB", 64);
+    cboxTextureMemory->addItem("128 MB", 128);
+    cboxTextureMemory->addItem("256 MB", 256);
+    cboxTextureMemory->addItem("512 MB", 512);
+    cboxTextureMemory->addItem("1024 MB", 1024);
+    viewportForm->addRow("Texture Memory per Slot", cboxTextureMemory);
+    viewportForm->setAlignment(cboxTextureMemory, Qt::AlignRight);
+
+    // Sample Limit & Streaming Note
+    viewportSamplesNote = new QLabel("Sample counts above the limit of the graphics driver are reduced. "
+                                     "Images needing more texture memory are streamed from tiles.");
+
+    viewportSamplesNote->setProperty("class", "note");
+    viewportSamplesNote->setWordWrap(true);
+    viewportLayout->addWidget(viewportSamplesNote);
 }
 
 void SettingsDialog::InitCodeEditorSection()
@@ -153,6 +176,49 @@ void SettingsDialog::InitCodeEditorSection()
     cboxTabWidth->addItem("8 Spaces", 8);
     codeEditorForm->addRow("Tab Width", cboxTabWidth);
     codeEditorForm->setAlignment(cboxTabWidth, Qt::AlignRight);
+
+    // Realtime Compile Delay
+    cboxCompileDelay = new QComboBox();
+    cboxCompileDelay->setFixedWidth(120);
+    cboxCompileDelay->addItem("Immediately", 0);
+    cboxCompileDelay->addItem("150 ms", 150);
+    cboxCompileDelay->addItem("300 ms", 300);
+    cboxCompileDelay->addItem("500 ms", 500);
+    cboxCompileDelay->addItem("1000 ms", 1000);
+    codeEditorForm->addRow("Realtime Compile Delay", cboxCompileDelay);
+    codeEditorForm->setAlignment(cboxCompileDelay, Qt::AlignRight);
+
+    // Shader Stages (linked program or separable program pipeline)
+    cboxShaderStages = new QComboBox();
+    cboxShaderStages->setFixedWidth(120);
+    cboxShaderStages->addItem("Linked", false);
+    cboxShaderStages->addItem("Separable", true);
+    codeEditorForm->addRow("Shader Stages", cboxShaderStages);
+    codeEditorForm->setAlignment(cboxShaderStages, Qt::AlignRight);
+}
+
+void SettingsDialog::InitExportSection()
+{
+    exportLayout = new QVBoxLayout();
+    mainLayout->addLayout(exportLayout);
+
+    // Title
+    exportTitle = new QLabel("Export");
+    exportTitle->setProperty("class", "title");
+    exportLayout->addWidget(exportTitle);
+
+    // Layout
+    exportForm = new QFormLayout();
+    exportForm->setContentsMargins(0, 0, 0, 0);
+    exportForm->setSpacing(10);
+    exportLayout->addLayout(exportForm);
+
+    // Post Export Command, {dir} is replaced by the export directory.
+    lePostExportCommand = new QLineEdit();
+    lePostExportCommand->setFixedWidth(240);
+    lePostExportCommand->setPlaceholderText("i.e. spirv-val {dir}/shader.frag.spv");
+    exportForm->addRow("Post Export Command", lePostExportCommand);
+    exportForm->setAlignment(lePostExportCommand, Qt::AlignRight);
 }
 
 void SettingsDialog::InitButtonLayout()
@@ -174,9 +240,20 @@ void SettingsDialog::ApplySettings()
 {
     // 3D Viewport
     mainWindow->applicationSettings.numSamples = cboxMultisampling->itemData(cboxMultisampling->currentIndex()).toInt();
+    mainWindow->openGLWidget->SetSamples(mainWindow->applicationSettings.numSamples);
+    mainWindow->applicationSettings.textureMemory = cboxTextureMemory->itemData(cboxTextureMemory->currentIndex()).toInt();
+    mainWindow->openGLWidget->SetTextureMemoryLimit(mainWindow->TextureMemoryLimit());
+    mainWindow->imageDecoder->SetStreamingLimit(mainWindow->TextureMemoryLimit());
 
     // Code Editor
     mainWindow->applicationSettings.tabWidth = cboxTabWidth->itemData(cboxTabWidth->currentIndex()).toInt();
+    mainWindow->applicationSettings.compileDelay = cboxCompileDelay->itemData(cboxCompileDelay->currentIndex()).toInt();
+    mainWindow->openGLWidget->SetCompileDelay(mainWindow->applicationSettings.compileDelay);
+    mainWindow->applicationSettings.separableStages = cboxShaderStages->itemData(cboxShaderStages->currentIndex()).toBool();
+    mainWindow->openGLWidget->SetSeparableStages(mainWindow->applicationSettings.separableStages);
+
+    // Export
+    mainWindow->applicationSettings.postExportCommand = lePostExportCommand->text().trimmed();
 
     mainWindow->SaveApplicationSettings();
 }
@@ -195,10 +272,17 @@ void SettingsDialog::FetchSettings()
     } else if (mainWindow->applicationSettings.numSamples == 8) {
         cboxMultisampling->setCurrentIndex(3);
 
+    } else if (mainWindow->applicationSettings.numSamples == 16) {
+        cboxMultisampling->setCurrentIndex(4);
+
     } else {
         cboxMultisampling->setCurrentIndex(0);
     }
 
+    // Texture Memory per Slot
+    auto textureMemoryIndex = cboxTextureMemory->findData(mainWindow->applicationSettings.textureMemory);
+    cboxTextureMemory->setCurrentIndex(textureMemoryIndex >= 0 ? textureMemoryIndex : 2);
+
     // ++++ 3D Viewport ++++
 
     // Tab Width
@@ -211,4 +295,16 @@ void SettingsDialog::FetchSettings()
     } else if (mainWindow->applicationSettings.tabWidth == 8) {
         cboxTabWidth->setCurrentIndex(2);
     }
+
+    // Realtime Compile Delay
+    auto compileDelayIndex = cboxCompileDelay->findData(mainWindow->applicationSettings.compileDelay);
+    cboxCompileDelay->setCurrentIndex(compileDelayIndex >= 0 ? compileDelayIndex : 2);
+
+    // Shader Stages
+    cboxShaderStages->setCurrentIndex(mainWindow->applicationSettings.separableStages ? 1 : 0);
+
+    // ++++ Export ++++
+
+    // Post Export Command
+    lePostExportCommand->setText(mainWindow->applicationSettings.postExportCommand);
 }
@@ -38,6 +38,7 @@
 #include <QFormLayout>
 #include <QCheckBox>
 #include <QComboBox>
+#include <QLineEdit>
 
 namespace ShaderIDE::GUI {
 
@@ -66,13 +67,22 @@ namespace ShaderIDE::GUI {
         QLabel* viewportTitle{ nullptr };
         QFormLayout* viewportForm{ nullptr };
         QComboBox* cboxMultisampling{ nullptr };
-        QLabel* viewportRestartNote{ nullptr };
+        QComboBox* cboxTextureMemory{ nullptr };
+        QLabel* viewportSamplesNote{ nullptr };
 
         // Code Editor
         QVBoxLayout* codeEditorLayout{ nullptr };
         QLabel* codeEditorTitle{ nullptr };
         QFormLayout* codeEditorForm{ nullptr };
         QComboBox* cboxTabWidth{ nullptr };
+        QComboBox* cboxCompileDelay{ nullptr };
+        QComboBox* cboxShaderStages{ nullptr };
+
+        // Export
+        QVBoxLayout* exportLayout{ nullptr };
+        QLabel* exportTitle{ nullptr };
+        QFormLayout* exportForm{ nullptr };
+        QLineEdit* lePostExportCommand{ nullptr };
 
         // Button Layout
         QHBoxLayout* buttonLayout{ nullptr };
@@ -81,6 +91,7 @@ namespace ShaderIDE::GUI {
         void InitLayout();
         void InitViewportSection();
         void InitCodeEditorSection();
+        void InitExportSection();
         void InitButtonLayout();
 
         void ApplySettings();
@@ -73,13 +73,43 @@ void LogOutputWidget::LogErrorMessage(const QString& message)
 
 QString LogOutputWidget::LogGLSLError(GLSLCompileError& error)
 {
-    QString err("[GLSL] [");
-    err.append(Shader::ShaderTypeToString(error.GetShaderType()));
-    err.append("] Syntax error at line ");
-    err.append(QString::number(error.Line()));
-    err.append(": Code ").append(error.Code()).append(" ");
-    err.append("-> ").append(error.Message());
-    LogErrorMessage(err);
+    const auto shaderType = Shader::ShaderTypeToString(error.GetShaderType());
+    const auto diagnostics = error.Diagnostics();
+    QStringList messages;
+
+    for (const auto& diagnostic : diagnostics)
+    {
+        if (messages.size() == MAX_LOG_DIAGNOSTICS)
+        {
+            messages << QString("[GLSL] [%1] %2 more diagnostics not shown.")
+                    .arg(shaderType)
+                    .arg(diagnostics.size() - MAX_LOG_DIAGNOSTICS);
+            break;
+        }
+
+        const auto prefix = diagnostic.severity == GLSLDiagnostic::SEVERITY::FAILURE ? "[ERROR] " : "[WARNING] ";
+        messages << prefix + DiagnosticMessage(shaderType, diagnostic);
+    }
+
+    // All diagnostics of a compile count as one log message.
+    AppendPlainTextWithAutomaticCleanup(messages.join("\n"));
+
+    GLSLDiagnostic first;
+    first.sourceIndex = error.SourceIndex();
+    first.line = error.Line();
+    first.code = error.Code();
+    first.message = error.Message();
+    first.file = error.File();
+
+    auto err = DiagnosticMessage(shaderType, first);
+
+    if (error.ErrorCount() > 1 || error.WarningCount() > 0)
+    {
+        err.append(QString(" (%1 errors, %2 warnings)")
+                .arg(error.ErrorCount())
+                .arg(error.WarningCount()));
+    }
+
     return err;
 }
 
@@ -130,6 +160,16 @@ void LogOutputWidget::InitSyntaxHighlighter()
         errorFormat,
         "(\\[ERROR\\].*)"
     });
+
+    // Warning Messages
+    QTextCharFormat warningFormat;
+    warningFormat.setFontWeight(QFont::Bold);
+    warningFormat.setForeground(QColor("#E0B84A")); // TODO Stylesheet.
+
+    syntaxHighlighter->AddMatchBlock({
+        warningFormat,
+        "(\\[WARNING\\].*)"
+    });
 }
 
 void LogOutputWidget::InitContextMenu()
@@ -153,3 +193,29 @@ void LogOutputWidget::AppendPlainTextWithAutomaticCleanup(const QString& message
     appendPlainText(message);
     logCounter++;
 }
+
+QString LogOutputWidget::DiagnosticMessage(const QString& shaderType,
+                                           const GLSLDiagnostic& diagnostic)
+{
+    QString message("[GLSL] [");
+    message.append(shaderType);
+    message.append(diagnostic.severity == GLSLDiagnostic::SEVERITY::FAILURE ? "] Syntax error at " : "] Warning at ");
+
+    if (!diagnostic.file.isEmpty()) {
+        message.append(diagnostic.file).append(":").append(QString::number(diagnostic.line));
+
+    } else {
+        message.append("line ").append(QString::number(diagnostic.line));
+    }
+
+    if (diagnostic.column > 0) {
+        message.append(":").append(QString::number(diagnostic.column));
+    }
+
+    if (!diagnostic.code.isEmpty()) {
+        message.append(": Code ").append(diagnostic.code);
+    }
+
+    message.append(" -> ").append(diagnostic.message);
+    return message;
+}
@@ -43,6 +43,7 @@ namespace ShaderIDE::GUI {
     {
         Q_OBJECT
         constexpr static uint16_t MAX_LOG_MESSAGES = 100;
+        constexpr static int MAX_LOG_DIAGNOSTICS = 50;
 
     public:
         explicit LogOutputWidget(QWidget* parent = nullptr);
@@ -71,6 +72,9 @@ namespace ShaderIDE::GUI {
         void InitContextMenu();
 
         void AppendPlainTextWithAutomaticCleanup(const QString& message);
+
+        static QString DiagnosticMessage(const QString& shaderType,
+                                         const GLSLDiagnostic& diagnostic);
     };
 }
 
@@ -27,7 +27,6 @@
  */
 
 #include <QDebug>
-#include <QSurfaceFormat>
 #include <QMenuBar>
 #include <QFileDialog>
 #include <QMessageBox>
@@ -36,15 +35,14 @@
 #include <QMimeData>
 #include <QStandardPaths>
 #include <QJsonDocument>
+#include <QElapsedTimer>
+#include <QThread>
 #include "MainWindow.hpp"
 #include "StyleSheets.hpp"
 #include "src/Core/Memory.hpp"
 #include <src/Core/QtUtility.hpp>
 #include "src/Project/ProjectException.hpp"
-
-#ifdef SHADERIDE_SPIRV_EXPORT
-#include "src/Core/Shell.hpp"
-#endif
+#include "src/GL/TextureSlots.hpp"
 
 using namespace ShaderIDE::GUI;
 
@@ -54,12 +52,6 @@ MainWindow::MainWindow(QWidget* parent)
     setAcceptDrops(true);
     LoadApplicationSettings();
 
-    // Apply default surface format for Anti-Aliasing.
-    QSurfaceFormat surfaceFormat;
-    surfaceFormat.setSamples(applicationSettings.numSamples);
-
-    QSurfaceFormat::setDefaultFormat(surfaceFormat);
-
     InitLayout();
     InitMenuBar();
     InitOpenGLWidget();
@@ -67,8 +59,12 @@ MainWindow::MainWindow(QWidget* parent)
     InitLogOutputWidget();
     InitSettingsDialog();
     InitAboutDialog();
+    InitPermutationDialog();
+    InitComputeDialog();
+    InitImageDecoder();
     InitStatusBar();
     InitShaderProject();
+    InitProcessRunner();
 
     UpdateWindowTitle();
 
@@ -80,6 +76,12 @@ MainWindow::MainWindow(QWidget* parent)
 
 MainWindow::~MainWindow()
 {
+    // External Tools
+    Memory::Release(processRunner);
+
+    // Images, running decodes are finished first.
+    Memory::Release(imageDecoder);
+
     // Project
     Memory::Release(shaderProject);
 
@@ -88,6 +90,12 @@ MainWindow::~MainWindow()
     Memory::Release(helpMenu);
 
     // Code Menu
+    Memory::Release(clearTileHeatmapAction);
+    Memory::Release(exportTileProfileAction);
+    Memory::Release(profileTilesAction);
+    Memory::Release(computeAction);
+    Memory::Release(permutationsAction);
+    Memory::Release(toggleHotLiteralsAction);
     Memory::Release(toggleWordWrapAction);
     Memory::Release(toggleRealtimeCompilationAction);
     Memory::Release(compileCodeAction);
@@ -102,6 +110,7 @@ MainWindow::~MainWindow()
     // File Menu
     Memory::Release(exitAction);
     Memory::Release(settingsAction);
+    Memory::Release(toggleSPIRVOptimizationAction);
     Memory::Release(exportSPIRVAction);
     Memory::Release(exportShadersAction);
     Memory::Release(saveProjectAsAction);
@@ -121,6 +130,8 @@ MainWindow::~MainWindow()
     Memory::Release(verticalLayout);
     Memory::Release(centralWidget);
 
+    computeDialog->deleteLater();
+    permutationDialog->deleteLater();
     aboutDialog->deleteLater();
     settingsDialog->deleteLater();
 }
@@ -142,25 +153,96 @@ void MainWindow::OnFSCodeChanged(const QString& code)
     shaderProject->SetFragmentShaderSource(code);
 }
 
-void MainWindow::OnTextureBrowserImageChanged(TextureBrowserImage* image)
+void MainWindow::OnCSCodeChanged(const QString& code)
 {
-    auto slot = OpenGLWidget::FindSlotByName(image->Name());
-    openGLWidget->ApplyTextureToSlot(image->ImageHQ(), slot);
+    openGLWidget->SetComputeShaderSource(code);
+    shaderProject->SetComputeShaderSource(code);
+}
 
-    const auto data = QtUtility::MakeBase64FromImage(image->ImageHQ());
-    shaderProject->SetTextureData(image->Name(), data);
+void MainWindow::OnVSHotLiteralChanged(int index, float value)
+{
+    openGLWidget->SetHotLiteral(ShaderType::VertexShader, index, value);
+}
+
+void MainWindow::OnFSHotLiteralChanged(int index, float value)
+{
+    openGLWidget->SetHotLiteral(ShaderType::FragmentShader, index, value);
+}
 
-    OnUpdateStatusBarMessage(QString("Texture \"") + image->Name() + "\" changed.");
+void MainWindow::OnTextureBrowserImageRequested(TextureBrowserImage* image, const QString& path)
+{
+    imageDecoder->DecodeFile(image->Name(), path);
+    OnUpdateStatusBarMessage(QString("Loading texture \"") + image->Name() + "\"...");
 }
 
 void MainWindow::OnTextureBrowserImageCleared(TextureBrowserImage* image)
 {
-    auto slot = OpenGLWidget::FindSlotByName(image->Name());
-    openGLWidget->ClearTextureSlot(slot);
+    imageDecoder->Cancel(image->Name());
+
+    openGLWidget->ClearTextureSlot(TextureSlots::Index(image->Name()));
     shaderProject->ClearTextureData(image->Name());
     OnUpdateStatusBarMessage(QString("Texture \"") + image->Name() + "\" cleared.");
 }
 
+void MainWindow::OnTextureBrowserSlotCountRequested(int count)
+{
+    // Images of removed slots are dropped from the project.
+    for (int slot = count; slot < shaderProject->TextureSlots(); slot++) {
+        imageDecoder->Cancel(TextureSlots::Name(slot));
+    }
+
+    shaderProject->SetTextureSlots(count);
+    ApplyTextureSlotCount(shaderProject->TextureSlots());
+    OnUpdateStatusBarMessage(QString("Texture slots: %1").arg(shaderProject->TextureSlots()));
+}
+
+void MainWindow::OnImageDecoded(const DecodedImage& result)
+{
+    if (!result.error.isEmpty())
+    {
+        OnGeneralError(result.error);
+        return;
+    }
+
+    auto* image = fileTabWidget->GetTextureBrowser()->GetImage(result.name);
+
+    if (image == nullptr) {
+        return;
+    }
+
+    // Compressed textures keep their blocks, no image is decoded.
+    if (!result.compressed.IsNull())
+    {
+        image->SetDecodedImage(QImage(), result.thumbnail, result.compressed.Description());
+        openGLWidget->ApplyCompressedTextureToSlot(result.compressed, TextureSlots::Index(result.name));
+
+    } else if (!result.pyramid.IsNull()) {
+        // Streamed textures are never held in memory, only their proxy.
+        image->SetDecodedImage(QImage(), result.thumbnail, result.pyramid.Description());
+        openGLWidget->ApplyStreamedTextureToSlot(result.upload, result.pyramid, TextureSlots::Index(result.name));
+
+    } else if (result.partial) {
+        image->SetDecodedImage(QImage(), result.thumbnail, "Building tile pyramid...");
+        openGLWidget->ApplyTextureToSlot(result.upload, TextureSlots::Index(result.name));
+
+    } else {
+        image->SetDecodedImage(result.image, result.thumbnail);
+        openGLWidget->ApplyTextureToSlot(result.upload, TextureSlots::Index(result.name));
+    }
+
+    // Only new files are encoded, project data and slots
+    // applied again after initialization are unchanged.
+    if (!result.base64.isEmpty())
+    {
+        shaderProject->SetTextureData(result.name, result.base64);
+        OnUpdateStatusBarMessage(QString("Texture \"") + result.name + "\" changed.");
+
+    } else if (!result.path.isEmpty()) {
+        shaderProject->SetTexturePath(result.name, result.path);
+        OnUpdateStatusBarMessage(QString("Texture \"") + result.name + "\" changed, streamed from its file.");
+    }
+}
+
 void MainWindow::OnGLInitialized()
 {
     // Fetch all textures from File Tab Widget's texture browser
@@ -176,6 +258,7 @@ void MainWindow::OnGLInitialized()
     {
         fileTabWidget->SetVertexShaderSource(GLSL_DEFAULT_VS_SOURCE);
         fileTabWidget->SetFragmentShaderSource(GLSL_DEFAULT_FS_SOURCE);
+        fileTabWidget->SetComputeShaderSource(GLSL_DEFAULT_CS_SOURCE);
 
         // Only compile at first initialization if realtime compilation
         // is not enabled, otherwise this step is redundant.
@@ -198,24 +281,40 @@ void MainWindow::OnCompileError(GLSLCompileError& error)
     auto errorMessage = logOutputWidget->LogGLSLError(error);
     OnUpdateStatusBarMessage(errorMessage);
 
-    // TODO Stylesheet.
-    auto highlightColor = QColor("#7A1F2F");
+    // Diagnostics in included files can't be highlighted in the editors.
+    GLSLDiagnosticList editorDiagnostics;
 
-    if (error.GetShaderType() == ShaderType::VertexShader)
+    for (const auto& diagnostic : error.Diagnostics())
     {
-        auto* vsCodeEditor = fileTabWidget->GetVSCodeEditor();
-        vsCodeEditor->HighlightErrorLine(error.Line(), highlightColor);
-        fileTabWidget->setCurrentWidget(vsCodeEditor);
+        if (diagnostic.file.isEmpty()) {
+            editorDiagnostics << diagnostic;
+        }
     }
 
-    if (error.GetShaderType() == ShaderType::FragmentShader)
-    {
-        auto* fsCodeEditor = fileTabWidget->GetFSCodeEditor();
-        fsCodeEditor->HighlightErrorLine(error.Line(), highlightColor);
-        fileTabWidget->setCurrentWidget(fsCodeEditor);
+    auto* codeEditor = fileTabWidget->GetFSCodeEditor();
+
+    if (error.GetShaderType() == ShaderType::VertexShader) {
+        codeEditor = fileTabWidget->GetVSCodeEditor();
+
+    } else if (error.GetShaderType() == ShaderType::ComputeShader) {
+        codeEditor = fileTabWidget->GetCSCodeEditor();
+    }
+
+    codeEditor->SetDiagnostics(editorDiagnostics);
+
+    if (error.File().isEmpty()) {
+        fileTabWidget->setCurrentWidget(codeEditor);
     }
 }
 
+void MainWindow::OnComputeCompiled(const QString& message)
+{
+    // Compiled separately, errors of the other stages stay.
+    fileTabWidget->GetCSCodeEditor()->ResetErrorLines();
+    logOutputWidget->LogSuccessMessage(message);
+    OnUpdateStatusBarMessage(message);
+}
+
 void MainWindow::OnGeneralError(const QString& error)
 {
     logOutputWidget->LogErrorMessage(error);
@@ -316,8 +415,10 @@ void MainWindow::OnMenuFileExportShaders()
 {
     auto directoryURL = QFileDialog::getExistingDirectoryUrl();
 
-    if (!directoryURL.isEmpty()) {
+    if (!directoryURL.isEmpty())
+    {
         ExportShaders(directoryURL);
+        RunPostExportCommand(directoryURL);
     }
 }
 
@@ -330,6 +431,13 @@ void MainWindow::OnMenuFileExportSPIRV()
     }
 }
 
+void MainWindow::OnMenuFileToggleSPIRVOptimization()
+{
+    applicationSettings.spirvOptimization = !applicationSettings.spirvOptimization;
+    toggleSPIRVOptimizationAction->setIconVisibleInMenu(applicationSettings.spirvOptimization);
+    SaveApplicationSettings();
+}
+
 void MainWindow::OnMenuFileSettings()
 {
     settingsDialog->show();
@@ -428,6 +536,143 @@ void MainWindow::OnMenuCodeToggleWordWrap()
     toggleWordWrapAction->setIconVisibleInMenu(fileTabWidget->WordWrap());
 }
 
+void MainWindow::OnMenuCodeToggleHotLiterals()
+{
+    const auto enabled = !openGLWidget->HotLiteralsEnabled();
+    openGLWidget->SetHotLiteralsEnabled(enabled);
+    fileTabWidget->SetHotLiteralsEnabled(enabled);
+    toggleHotLiteralsAction->setIconVisibleInMenu(enabled);
+}
+
+void MainWindow::OnMenuCodePermutations()
+{
+    permutationDialog->show();
+    permutationDialog->raise();
+}
+
+void MainWindow::OnMenuCodeCompute()
+{
+    computeDialog->show();
+    computeDialog->raise();
+}
+
+void MainWindow::OnMenuCodeProfileTiles()
+{
+    if (!openGLWidget->Plane2D())
+    {
+        OnGeneralError("Tile profiling requires the Plane 2D mode.");
+        return;
+    }
+
+    logOutputWidget->LogMessage("Profiling tiles...");
+    openGLWidget->ProfileTiles();
+}
+
+void MainWindow::OnMenuCodeExportTileProfile()
+{
+    const auto& timings = openGLWidget->TileProfile();
+
+    if (timings.Empty())
+    {
+        OnGeneralError("No tile profile available, run \"Profile Tiles\" first.");
+        return;
+    }
+
+    QString path = QFileDialog::getSaveFileName(
+            this,
+            "Export Tile Profile...",
+            QString(),
+            "CSV Files (*.csv)"
+    );
+
+    if (path.isEmpty()) {
+        return;
+    }
+
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        OnGeneralError(QString("Could not write tile profile \"%1\".").arg(path));
+        return;
+    }
+
+    file.write(timings.ToCSV().toUtf8());
+    OnUpdateStatusBarMessage(QString("Tile profile exported to ") + path);
+}
+
+void MainWindow::OnMenuCodeClearTileHeatmap()
+{
+    openGLWidget->ClearTileProfile();
+}
+
+void MainWindow::OnProcessOutput(uint64_t id, const QString& line)
+{
+    Q_UNUSED(id)
+    logOutputWidget->LogMessage(line);
+}
+
+void MainWindow::OnProcessErrorOutput(uint64_t id, const QString& line)
+{
+    Q_UNUSED(id)
+    logOutputWidget->LogErrorMessage(line);
+}
+
+void MainWindow::OnProcessFinished(uint64_t id, const ShaderIDE::ProcessResult& result)
+{
+    Q_UNUSED(id)
+
+    if (!result.started) {
+        logOutputWidget->LogErrorMessage(QString("Could not start \"%1\".").arg(result.program));
+
+    } else if (result.timedOut) {
+        logOutputWidget->LogErrorMessage(QString("\"%1\" was stopped after %2 ms.").arg(result.program).arg(result.duration));
+
+    } else if (result.exitCode != 0) {
+        logOutputWidget->LogErrorMessage(QString("\"%1\" failed with exit code %2.").arg(result.program).arg(result.exitCode));
+
+    } else {
+        logOutputWidget->LogSuccessMessage(QString("\"%1\" finished in %2 ms.").arg(result.program).arg(result.duration));
+    }
+}
+
+void MainWindow::OnBuildPermutations(const QString& axes, bool benchmark)
+{
+    QList<PermutationDefines> permutations;
+
+    try
+    {
+        permutations = ShaderPermutations::Enumerate(ShaderPermutations::ParseAxes(axes));
+
+    }
+    catch (GeneralException& e)
+    {
+        permutationDialog->ShowError(e.what());
+        return;
+    }
+
+    openGLWidget->BuildPermutations(permutations, benchmark);
+}
+
+void MainWindow::OnApplyComputeSettings()
+{
+    ComputeSettings settings;
+
+    try
+    {
+        settings = computeDialog->Settings();
+
+    }
+    catch (GeneralException& e)
+    {
+        computeDialog->ShowError(e.what());
+        return;
+    }
+
+    openGLWidget->SetComputeSettings(settings);
+    shaderProject->SetCompute(settings);
+}
+
 void MainWindow::OnMenuHelpAbout()
 {
     aboutDialog->show();
@@ -461,6 +706,22 @@ void MainWindow::OnOpenGLWidgetCameraPositionChanged(const glm::vec3& cameraPosi
     shaderProject->SetCameraPosition(cameraPosition);
 }
 
+void MainWindow::OnOpenGLWidgetLogMessage(const QString& message)
+{
+    logOutputWidget->LogMessage(message);
+}
+
+void MainWindow::OnOpenGLWidgetUniformsReflected(const ShaderUniforms& uniforms)
+{
+    fileTabWidget->GetUniformPanel()->SetUniforms(uniforms, shaderProject->UniformValues());
+}
+
+void MainWindow::OnUniformPanelUniformChanged(const QString& name, const glm::vec4& value)
+{
+    openGLWidget->SetUniformValue(name, value);
+    shaderProject->SetUniformValue(name, value);
+}
+
 void MainWindow::OnShaderProjectMarkSaved()
 {
     UpdateWindowTitle();
@@ -573,7 +834,10 @@ void MainWindow::InitMenuFile()
     exportShadersAction = new QAction("Export Shaders...");
 
 #ifdef SHADERIDE_SPIRV_EXPORT
-    exportSPIRVAction   = new QAction("Export SPIR-V...");
+    exportSPIRVAction = new QAction("Export SPIR-V...");
+    toggleSPIRVOptimizationAction = new QAction("Optimize SPIR-V");
+    toggleSPIRVOptimizationAction->setIcon(QIcon(":/icons/icon-menu-check.png"));
+    toggleSPIRVOptimizationAction->setIconVisibleInMenu(applicationSettings.spirvOptimization);
 #endif
 
     settingsAction = new QAction("Settings...");
@@ -591,6 +855,7 @@ void MainWindow::InitMenuFile()
 
 #ifdef SHADERIDE_SPIRV_EXPORT
     fileMenu->addAction(exportSPIRVAction);
+    fileMenu->addAction(toggleSPIRVOptimizationAction);
 #endif
 
     fileMenu->addSeparator();
@@ -616,6 +881,9 @@ void MainWindow::InitMenuFile()
 #ifdef SHADERIDE_SPIRV_EXPORT
     connect(exportSPIRVAction, SIGNAL(triggered(bool)),
             this, SLOT(OnMenuFileExportSPIRV()));
+
+    connect(toggleSPIRVOptimizationAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuFileToggleSPIRVOptimization()));
 #endif
 
     connect(settingsAction, SIGNAL(triggered(bool)),
@@ -673,12 +941,36 @@ void MainWindow::InitMenuCode()
     toggleWordWrapAction->setIcon(QIcon(":/icons/icon-menu-check.png"));
     toggleWordWrapAction->setIconVisibleInMenu(false);
 
+    // Hot Literals
+    toggleHotLiteralsAction = new QAction("Toggle Hot Literals");
+    toggleHotLiteralsAction->setIcon(QIcon(":/icons/icon-menu-check.png"));
+    toggleHotLiteralsAction->setIconVisibleInMenu(false);
+
+    // Shader Permutations
+    permutationsAction = new QAction("Shader Permutations...");
+
+    // Compute Shader
+    computeAction = new QAction("Compute Shader...");
+
+    // Tile Profiling
+    profileTilesAction = new QAction("Profile Tiles (Plane 2D)");
+    exportTileProfileAction = new QAction("Export Tile Profile...");
+    clearTileHeatmapAction = new QAction("Clear Tile Heatmap");
+
     // Add Actions
     codeMenu->addAction(compileCodeAction);
     codeMenu->addSeparator();
     codeMenu->addAction(toggleRealtimeCompilationAction);
     codeMenu->addSeparator();
     codeMenu->addAction(toggleWordWrapAction);
+    codeMenu->addAction(toggleHotLiteralsAction);
+    codeMenu->addSeparator();
+    codeMenu->addAction(permutationsAction);
+    codeMenu->addAction(computeAction);
+    codeMenu->addSeparator();
+    codeMenu->addAction(profileTilesAction);
+    codeMenu->addAction(exportTileProfileAction);
+    codeMenu->addAction(clearTileHeatmapAction);
 
     // Signals & Slots
     connect(compileCodeAction, SIGNAL(triggered(bool)),
@@ -689,6 +981,24 @@ void MainWindow::InitMenuCode()
 
     connect(toggleWordWrapAction, SIGNAL(triggered(bool)),
             this, SLOT(OnMenuCodeToggleWordWrap()));
+
+    connect(toggleHotLiteralsAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodeToggleHotLiterals()));
+
+    connect(permutationsAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodePermutations()));
+
+    connect(computeAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodeCompute()));
+
+    connect(profileTilesAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodeProfileTiles()));
+
+    connect(exportTileProfileAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodeExportTileProfile()));
+
+    connect(clearTileHeatmapAction, SIGNAL(triggered(bool)),
+            this, SLOT(OnMenuCodeClearTileHeatmap()));
 }
 
 void MainWindow::InitMenuHelp()
@@ -708,6 +1018,10 @@ void MainWindow::InitOpenGLWidget()
     openGLWidget = new OpenGLWidget(mainSplitter);
     openGLWidget->setMinimumWidth(400);
     openGLWidget->resize(800, openGLWidget->height());
+    openGLWidget->SetSamples(applicationSettings.numSamples);
+    openGLWidget->SetCompileDelay(applicationSettings.compileDelay);
+    openGLWidget->SetSeparableStages(applicationSettings.separableStages);
+    openGLWidget->SetTextureMemoryLimit(TextureMemoryLimit());
     mainSplitter->addWidget(openGLWidget);
     mainSplitter->setCollapsible(mainSplitter->indexOf(openGLWidget), false);
 
@@ -740,6 +1054,9 @@ void MainWindow::InitOpenGLWidget()
 
     connect(openGLWidget, SIGNAL(NotifyCameraPositionChanged(const glm::vec3&)),
             this, SLOT(OnOpenGLWidgetCameraPositionChanged(const glm::vec3&)));
+
+    connect(openGLWidget, SIGNAL(NotifyLogMessage(const QString&)),
+            this, SLOT(OnOpenGLWidgetLogMessage(const QString&)));
 }
 
 void MainWindow::InitFileTabWidget()
@@ -759,11 +1076,29 @@ void MainWindow::InitFileTabWidget()
     connect(fileTabWidget, SIGNAL(NotifyFSCodeChanged(const QString&)),
             this, SLOT(OnFSCodeChanged(const QString&)));
 
-    connect(fileTabWidget->GetTextureBrowser(), SIGNAL(NotifyImageChanged(TextureBrowserImage*)),
-            this, SLOT(OnTextureBrowserImageChanged(TextureBrowserImage *)));
+    connect(fileTabWidget, SIGNAL(NotifyCSCodeChanged(const QString&)),
+            this, SLOT(OnCSCodeChanged(const QString&)));
+
+    connect(fileTabWidget, SIGNAL(NotifyVSHotLiteralChanged(int, float)),
+            this, SLOT(OnVSHotLiteralChanged(int, float)));
+
+    connect(fileTabWidget, SIGNAL(NotifyFSHotLiteralChanged(int, float)),
+            this, SLOT(OnFSHotLiteralChanged(int, float)));
+
+    connect(fileTabWidget->GetTextureBrowser(), SIGNAL(NotifyImageRequested(TextureBrowserImage*, const QString&)),
+            this, SLOT(OnTextureBrowserImageRequested(TextureBrowserImage*, const QString&)));
 
     connect(fileTabWidget->GetTextureBrowser(), SIGNAL(NotifyImageCleared(TextureBrowserImage*)),
             this, SLOT(OnTextureBrowserImageCleared(TextureBrowserImage *)));
+
+    connect(fileTabWidget->GetTextureBrowser(), SIGNAL(NotifySlotCountRequested(int)),
+            this, SLOT(OnTextureBrowserSlotCountRequested(int)));
+
+    connect(fileTabWidget->GetUniformPanel(), SIGNAL(NotifyUniformChanged(const QString&, const glm::vec4&)),
+            this, SLOT(OnUniformPanelUniformChanged(const QString&, const glm::vec4&)));
+
+    connect(openGLWidget, SIGNAL(NotifyUniformsReflected(const ShaderUniforms&)),
+            this, SLOT(OnOpenGLWidgetUniformsReflected(const ShaderUniforms&)));
 }
 
 void MainWindow::InitLogOutputWidget()
@@ -785,6 +1120,43 @@ void MainWindow::InitAboutDialog()
     aboutDialog = new AboutDialog();
 }
 
+void MainWindow::InitPermutationDialog()
+{
+    permutationDialog = new PermutationDialog();
+
+    connect(permutationDialog, SIGNAL(NotifyBuildPermutations(const QString&, bool)),
+            this, SLOT(OnBuildPermutations(const QString&, bool)));
+
+    connect(openGLWidget, SIGNAL(NotifyPermutationResults(const PermutationResults&)),
+            permutationDialog, SLOT(OnPermutationResults(const PermutationResults&)));
+}
+
+void MainWindow::InitComputeDialog()
+{
+    computeDialog = new ComputeDialog();
+
+    connect(computeDialog, SIGNAL(NotifyApplyComputeSettings()),
+            this, SLOT(OnApplyComputeSettings()));
+
+    connect(computeDialog, SIGNAL(NotifyDispatchCompute()),
+            openGLWidget, SLOT(OnDispatchCompute()));
+
+    connect(openGLWidget, SIGNAL(NotifyComputeCompiled(const QString&)),
+            this, SLOT(OnComputeCompiled(const QString&)));
+
+    connect(openGLWidget, SIGNAL(NotifyComputeTimings(double, double, int)),
+            computeDialog, SLOT(OnComputeTimings(double, double, int)));
+}
+
+void MainWindow::InitImageDecoder()
+{
+    imageDecoder = new AsyncImageDecoder();
+    imageDecoder->SetStreamingLimit(TextureMemoryLimit());
+
+    connect(imageDecoder, SIGNAL(NotifyImageDecoded(const DecodedImage&)),
+            this, SLOT(OnImageDecoded(const DecodedImage&)));
+}
+
 void MainWindow::InitStatusBar()
 {
     statusBar = new QStatusBar();
@@ -792,15 +1164,31 @@ void MainWindow::InitStatusBar()
     verticalLayout->addWidget(statusBar);
 }
 
+void MainWindow::InitProcessRunner()
+{
+    processRunner = new ProcessRunner(QThread::idealThreadCount());
+
+    connect(processRunner, SIGNAL(NotifyOutput(uint64_t, const QString&)),
+            this, SLOT(OnProcessOutput(uint64_t, const QString&)));
+
+    connect(processRunner, SIGNAL(NotifyErrorOutput(uint64_t, const QString&)),
+            this, SLOT(OnProcessErrorOutput(uint64_t, const QString&)));
+
+    connect(processRunner, SIGNAL(NotifyFinished(uint64_t, const ShaderIDE::ProcessResult&)),
+            this, SLOT(OnProcessFinished(uint64_t, const ShaderIDE::ProcessResult&)));
+}
+
 void MainWindow::InitShaderProject()
 {
     shaderProject = new ShaderProject("");
     ConnectShaderProjectSignals();
 
-    shaderProject->SetTextureData(GLSL_TEXTURE_SLOT_0_NAME, "");
-    shaderProject->SetTextureData(GLSL_TEXTURE_SLOT_1_NAME, "");
-    shaderProject->SetTextureData(GLSL_TEXTURE_SLOT_2_NAME, "");
-    shaderProject->SetTextureData(GLSL_TEXTURE_SLOT_3_NAME, "");
+    for (int slot = 0; slot < shaderProject->TextureSlots(); slot++) {
+        shaderProject->SetTextureData(TextureSlots::Name(slot), "");
+    }
+
+    computeDialog->SetSettings(shaderProject->Compute());
+    openGLWidget->SetComputeSettings(shaderProject->Compute());
 }
 
 void MainWindow::SwapLayout()
@@ -871,38 +1259,45 @@ void MainWindow::UpdateWindowTitle()
 
 void MainWindow::ApplyTextureSlots()
 {
-    auto textures = fileTabWidget->GetTextureBrowser()->Images();
-
-    // Find Textures
-    auto slotIt0 = textures.find(GLSL_TEXTURE_SLOT_0_NAME);
-    auto slotIt1 = textures.find(GLSL_TEXTURE_SLOT_1_NAME);
-    auto slotIt2 = textures.find(GLSL_TEXTURE_SLOT_2_NAME);
-    auto slotIt3 = textures.find(GLSL_TEXTURE_SLOT_3_NAME);
-
+    auto* textureBrowser = fileTabWidget->GetTextureBrowser();
     const auto errorFmt = "Slot texture \"%s\" not available in texture browser. Ignored.";
 
-    if (slotIt0 != textures.end()) {
-        openGLWidget->ApplyTextureToSlot(slotIt0.value()->ImageHQ(), OpenGLWidget::SLOT::TEX_0);
-    } else {
-        LogMessage(QString::asprintf(errorFmt, GLSL_TEXTURE_SLOT_0_NAME));
-    }
+    for (int slot = 0; slot < textureBrowser->SlotCount(); slot++)
+    {
+        const auto name = TextureSlots::Name(slot);
+        auto* image = textureBrowser->GetImage(name);
 
-    if (slotIt1 != textures.end()) {
-        openGLWidget->ApplyTextureToSlot(slotIt1.value()->ImageHQ(), OpenGLWidget::SLOT::TEX_1);
-    } else {
-        LogMessage(QString::asprintf(errorFmt, GLSL_TEXTURE_SLOT_1_NAME));
+        if (image != nullptr) {
+            ApplyTextureSlot(image);
+        } else {
+            LogMessage(QString::asprintf(errorFmt, name.toLatin1().constData()));
+        }
     }
+}
 
-    if (slotIt2 != textures.end()) {
-        openGLWidget->ApplyTextureToSlot(slotIt2.value()->ImageHQ(), OpenGLWidget::SLOT::TEX_2);
-    } else {
-        LogMessage(QString::asprintf(errorFmt, GLSL_TEXTURE_SLOT_2_NAME));
-    }
+void MainWindow::ApplyTextureSlotCount(int count)
+{
+    fileTabWidget->GetTextureBrowser()->SetSlotCount(count);
+    openGLWidget->SetTextureSlotCount(count);
+}
 
-    if (slotIt3 != textures.end()) {
-        openGLWidget->ApplyTextureToSlot(slotIt3.value()->ImageHQ(), OpenGLWidget::SLOT::TEX_3);
-    } else {
-        LogMessage(QString::asprintf(errorFmt, GLSL_TEXTURE_SLOT_3_NAME));
+void MainWindow::ApplyTextureSlot(TextureBrowserImage* image)
+{
+    // Empty slots sample the black fallback texture, compressed textures
+    // are read from the project again, streamed ones from their file.
+    const auto textureData = shaderProject->TextureData();
+    const auto data = textureData.find(image->Name());
+    const auto texturePaths = shaderProject->TexturePaths();
+    const auto texturePath = texturePaths.find(image->Name());
+
+    if (!image->ImageHQ().isNull()) {
+        imageDecoder->DecodeImage(image->Name(), image->ImageHQ());
+
+    } else if (texturePath != texturePaths.end()) {
+        imageDecoder->DecodeFile(image->Name(), texturePath->second, false);
+
+    } else if (data != textureData.end() && !data->second.isEmpty()) {
+        imageDecoder->DecodeData(image->Name(), QByteArray::fromBase64(data->second.toLatin1()));
     }
 }
 
@@ -921,6 +1316,7 @@ void MainWindow::ResetProject()
 
     shaderProject->SetVertexShaderSource(GLSL_DEFAULT_VS_SOURCE);
     shaderProject->SetFragmentShaderSource(GLSL_DEFAULT_FS_SOURCE);
+    shaderProject->SetComputeShaderSource(GLSL_DEFAULT_CS_SOURCE);
 
     openGLWidget->ResetUI();
     fileTabWidget->ResetUI();
@@ -977,12 +1373,31 @@ bool MainWindow::ApplyUIFromProject()
 
     fileTabWidget->SetVertexShaderSource(shaderProject->VertexShaderSource());
     fileTabWidget->SetFragmentShaderSource(shaderProject->FragmentShaderSource());
+    fileTabWidget->SetComputeShaderSource(shaderProject->ComputeShaderSource());
+
+    // Compute resources are created before the sources are compiled.
+    computeDialog->SetSettings(shaderProject->Compute());
+    openGLWidget->SetComputeSettings(shaderProject->Compute());
 
     openGLWidget->CheckPlane2D(shaderProject->Plane2D());
 
+    // Includes are resolved relative to the project file.
+    openGLWidget->SetIncludeDirectory(shaderProject->Path().isEmpty() ? "" : shaderProject->PathOnly());
+
+    // Stored uniform values are applied with the first frame of the compiled program.
+    fileTabWidget->GetUniformPanel()->ClearUniforms();
+    openGLWidget->ClearUniformValues();
+
+    for (auto& uniformValue : shaderProject->UniformValues()) {
+        openGLWidget->SetUniformValue(uniformValue.first, uniformValue.second);
+    }
+
     openGLWidget->OnCompileShaders();
     openGLWidget->SelectMesh(shaderProject->MeshName());
 
+    // Slots exist before their images are decoded.
+    ApplyTextureSlotCount(shaderProject->TextureSlots());
+
     for (auto& texture : shaderProject->TextureData())
     {
         auto data = texture.second;
@@ -991,12 +1406,13 @@ bool MainWindow::ApplyUIFromProject()
             continue;
         }
 
-        const auto slotName = texture.first;
-        const auto slot = OpenGLWidget::FindSlotByName(slotName);
-        const auto image = QtUtility::MakeQImageFromBase64(data);
+        // Decoded on a worker thread, see OnImageDecoded().
+        imageDecoder->DecodeData(texture.first, QByteArray::fromBase64(data.toLatin1()));
+    }
 
-        openGLWidget->ApplyTextureToSlot(image, slot);
-        fileTabWidget->GetTextureBrowser()->GetImage(slotName)->UpdateImage(image);
+    // The tile pyramids of streamed textures are reused from the cache.
+    for (auto& texture : shaderProject->TexturePaths()) {
+        imageDecoder->DecodeFile(texture.first, texture.second, false);
     }
 
     openGLWidget->CheckRealtime(shaderProject->Realtime());
@@ -1049,32 +1465,89 @@ void MainWindow::ExportShaders(const QUrl& directory)
 void MainWindow::ExportSPIRV(const QUrl& directory)
 {
 #ifdef SHADERIDE_SPIRV_EXPORT
-    // Export shader files first.
-    ExportShaders(directory);
+    QElapsedTimer exportTimer;
+    exportTimer.start();
+
+    // Both stages are compiled in memory, unchanged ones come from the cache.
+    spirvCompiler.SetOptimization(applicationSettings.spirvOptimization);
+
+    const auto results = spirvCompiler.Compile({
+            qMakePair(ShaderType::VertexShader, fileTabWidget->VertexShaderSource()),
+            qMakePair(ShaderType::FragmentShader, fileTabWidget->FragmentShaderSource())
+    });
+
+    bool failed = false;
+    int cachedStages = 0;
+
+    for (const auto& result : results)
+    {
+        const auto stageName = result.shaderType == ShaderType::VertexShader ? "Vertex shader" : "Fragment shader";
+
+        for (const auto& diagnostic : result.diagnostics) {
+            logOutputWidget->LogMessage(QString("%1: %2").arg(stageName, diagnostic));
+        }
+
+        if (!result.success)
+        {
+            failed = true;
+            continue;
+        }
 
-    auto vsFilePath = MakeVSPath(directory).toStdString();
-    auto fsFilePath = MakeFSPath(directory).toStdString();
+        cachedStages += result.cached ? 1 : 0;
 
-    // TODO Move "glslangValidator" path to settings.
-    const auto cmd = "glslangValidator --auto-map-bindings --auto-map-locations -V ";
-    const auto vsOutput = Shell::Exec(QString(cmd) + vsFilePath);
-    const auto fsOutput = Shell::Exec(QString(cmd) + fsFilePath);
+        const auto path = (result.shaderType == ShaderType::VertexShader
+                ? MakeVSPath(directory)
+                : MakeFSPath(directory)) + ".spv";
 
-    logOutputWidget->LogMessage(vsOutput.c_str());
-    logOutputWidget->LogMessage(fsOutput.c_str());
+        QFile file(path);
 
-    remove(vsFilePath.c_str());
-    remove(fsFilePath.c_str());
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            OnGeneralError(QString("Could not write SPIR-V binary \"%1\".").arg(path));
+            return;
+        }
 
-    const auto errorTag = "ERROR:";
+        file.write(reinterpret_cast<const char*>(result.spirv.data()),
+                   static_cast<qint64>(result.spirv.size() * sizeof(uint32_t)));
+    }
 
-    if (vsOutput.find(errorTag) != QString::npos ||
-        fsOutput.find(errorTag) != QString::npos) {
+    if (failed)
+    {
         OnGeneralError("Could not export SPIR-V shader binaries. See log above.");
+        return;
     }
+
+    logOutputWidget->LogSuccessMessage(
+            QString("SPIR-V exported in %1 ms (%2 of %3 stages from cache%4).")
+                    .arg(exportTimer.elapsed())
+                    .arg(cachedStages)
+                    .arg(results.size())
+                    .arg(applicationSettings.spirvOptimization ? ", optimized" : "")
+    );
+
+    RunPostExportCommand(directory);
 #endif
 }
 
+void MainWindow::RunPostExportCommand(const QUrl& directory)
+{
+    auto arguments = QProcess::splitCommand(applicationSettings.postExportCommand);
+
+    if (arguments.isEmpty()) {
+        return;
+    }
+
+    for (auto& argument : arguments) {
+        argument.replace("{dir}", directory.toLocalFile());
+    }
+
+    const auto program = arguments.takeFirst();
+    logOutputWidget->LogMessage(QString("Running post export command \"%1\"...").arg(program));
+
+    // Runs in the background, output is logged as it arrives.
+    processRunner->Run(program, arguments, ProcessRunner::DEFAULT_TIMEOUT, directory.toLocalFile());
+}
+
 void MainWindow::ConnectShaderProjectSignals()
 {
     connect(shaderProject, SIGNAL(NotifyMarkSaved()),
@@ -1299,13 +1772,22 @@ void MainWindow::SaveApplicationSettings()
     // 3D Viewport
     QJsonObject settings_viewport;
     settings_viewport["multisampling"] = applicationSettings.numSamples;
+    settings_viewport["texture_memory"] = applicationSettings.textureMemory;
     settings["viewport"] = settings_viewport;
 
     // Code Editor
     QJsonObject settings_code_editor;
     settings_code_editor["tab_width"] = applicationSettings.tabWidth;
+    settings_code_editor["compile_delay"] = applicationSettings.compileDelay;
+    settings_code_editor["separable_stages"] = applicationSettings.separableStages;
     settings["code_editor"] = settings_code_editor;
 
+    // Export
+    QJsonObject settings_export;
+    settings_export["spirv_optimization"] = applicationSettings.spirvOptimization;
+    settings_export["post_export_command"] = applicationSettings.postExportCommand;
+    settings["export"] = settings_export;
+
     QJsonDocument jsonDocument(settings);
     file.write(jsonDocument.toJson());
 }
@@ -1341,6 +1823,10 @@ void MainWindow::LoadApplicationSettings()
         if (settings_viewport.contains("multisampling")) {
             applicationSettings.numSamples = settings_viewport["multisampling"].toInt();
         }
+
+        if (settings_viewport.contains("texture_memory")) {
+            applicationSettings.textureMemory = settings_viewport["texture_memory"].toInt();
+        }
     }
 
     // Code Editor
@@ -1351,5 +1837,33 @@ void MainWindow::LoadApplicationSettings()
         if (settings_code_editor.contains("tab_width")) {
             applicationSettings.tabWidth = settings_code_editor["tab_width"].toInt();
         }
+
+        if (settings_code_editor.contains("compile_delay")) {
+            applicationSettings.compileDelay = settings_code_editor["compile_delay"].toInt();
+        }
+
+        if (settings_code_editor.contains("separable_stages")) {
+            applicationSettings.separableStages = settings_code_editor["separable_stages"].toBool();
+        }
+    }
+
+    // Export
+    if (settings.find("export") != settings.end())
+    {
+        auto settings_export = settings.find("export")->toObject();
+
+        if (settings_export.contains("spirv_optimization")) {
+            applicationSettings.spirvOptimization = settings_export["spirv_optimization"].toBool();
+        }
+
+        if (settings_export.contains("post_export_command")) {
+            applicationSettings.postExportCommand = settings_export["post_export_command"].toString();
+        }
     }
 }
+
+qint64 MainWindow::TextureMemoryLimit() const
+{
+    // Images needing more GPU memory are streamed.
+    return static_cast<qint64>(applicationSettings.textureMemory) * 1024 * 1024;
+}
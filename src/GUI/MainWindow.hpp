@@ -38,11 +38,19 @@
 #include "LogOutputWidget.hpp"
 #include "Widgets/FileTabWidget.hpp"
 #include "src/Core/ApplicationDefaults.hpp"
+#include "src/Core/ProcessRunner.hpp"
 #include "src/GUI/Dialogs/SettingsDialog.hpp"
 #include "src/GUI/Dialogs/AboutDialog.hpp"
+#include "src/GUI/Dialogs/PermutationDialog.hpp"
+#include "src/GUI/Dialogs/ComputeDialog.hpp"
+#include "src/GUI/AsyncImageDecoder.hpp"
 #include "src/GL/Shader.hpp"
 #include "src/Project/ShaderProject.hpp"
 
+#ifdef SHADERIDE_SPIRV_EXPORT
+#include "src/GL/SPIRVCompiler.hpp"
+#endif
+
 using namespace ShaderIDE::GL;
 using namespace ShaderIDE::Project;
 
@@ -52,6 +60,11 @@ namespace ShaderIDE::GUI {
     {
         int numSamples{ SHADERIDE_SURFACEFORMAT_NUM_SAMPLES };
         int tabWidth{ SHADERIDE_CODE_EDITOR_TAB_WIDTH };
+        int compileDelay{ SHADERIDE_CODE_EDITOR_COMPILE_DELAY };
+        bool separableStages{ SHADERIDE_CODE_EDITOR_SEPARABLE_STAGES };
+        bool spirvOptimization{ false };
+        int textureMemory{ SHADERIDE_TEXTURE_MEMORY_PER_SLOT }; // Megabytes per slot
+        QString postExportCommand{ "" }; // {dir} is replaced by the export directory.
     };
 
     class MainWindow : public QMainWindow
@@ -72,11 +85,17 @@ namespace ShaderIDE::GUI {
     private slots:
         void OnVSCodeChanged(const QString& code);
         void OnFSCodeChanged(const QString& code);
-        void OnTextureBrowserImageChanged(TextureBrowserImage* image);
+        void OnCSCodeChanged(const QString& code);
+        void OnVSHotLiteralChanged(int index, float value);
+        void OnFSHotLiteralChanged(int index, float value);
+        void OnTextureBrowserImageRequested(TextureBrowserImage* image, const QString& path);
         void OnTextureBrowserImageCleared(TextureBrowserImage* image);
+        void OnTextureBrowserSlotCountRequested(int count);
+        void OnImageDecoded(const DecodedImage& result);
         void OnGLInitialized();
         void OnCompileSuccess(const QString& message);
         void OnCompileError(GLSLCompileError& error);
+        void OnComputeCompiled(const QString& message);
         void OnGeneralError(const QString& error);
         void OnGeneralError(const GeneralException& e);
         void OnUpdateStatusBarMessage(const QString& message);
@@ -88,6 +107,7 @@ namespace ShaderIDE::GUI {
         void OnMenuFileSaveProjectAs();
         void OnMenuFileExportShaders();
         void OnMenuFileExportSPIRV();
+        void OnMenuFileToggleSPIRVOptimization();
         void OnMenuFileSettings();
         void OnMenuFileExit();
 
@@ -100,16 +120,38 @@ namespace ShaderIDE::GUI {
         void OnMenuCodeCompile();
         void OnMenuCodeToggleRealtimeCompilation();
         void OnMenuCodeToggleWordWrap();
+        void OnMenuCodeToggleHotLiterals();
+        void OnMenuCodePermutations();
+        void OnMenuCodeCompute();
+        void OnMenuCodeProfileTiles();
+        void OnMenuCodeExportTileProfile();
+        void OnMenuCodeClearTileHeatmap();
 
         // Menu / Help
         void OnMenuHelpAbout();
 
+        // External Tools
+        void OnProcessOutput(uint64_t id, const QString& line);
+        void OnProcessErrorOutput(uint64_t id, const QString& line);
+        void OnProcessFinished(uint64_t id, const ShaderIDE::ProcessResult& result);
+
+        // Shader Permutations
+        void OnBuildPermutations(const QString& axes, bool benchmark);
+
+        // Compute Shader
+        void OnApplyComputeSettings();
+
         // OpenGL Widget
         void OnOpenGLWidgetMeshSelected(const QString& meshName);
         void OnOpenGLWidgetRealtimeToggled(const bool& realtimeActive);
         void OnOpenGLWidgetPlane2DToggled(const bool& plane2DActive);
         void OnOpenGLWidgetModelRotationChanged(const glm::vec3& modelRotation);
         void OnOpenGLWidgetCameraPositionChanged(const glm::vec3& cameraPosition);
+        void OnOpenGLWidgetLogMessage(const QString& message);
+        void OnOpenGLWidgetUniformsReflected(const ShaderUniforms& uniforms);
+
+        // Uniform Panel
+        void OnUniformPanelUniformChanged(const QString& name, const glm::vec4& value);
 
         // Project
         void OnShaderProjectMarkSaved();
@@ -143,6 +185,9 @@ namespace ShaderIDE::GUI {
         LogOutputWidget* logOutputWidget{ nullptr };
         SettingsDialog* settingsDialog{ nullptr };
         AboutDialog* aboutDialog{ nullptr };
+        PermutationDialog* permutationDialog{ nullptr };
+        ComputeDialog* computeDialog{ nullptr };
+        AsyncImageDecoder* imageDecoder{ nullptr };
         QStatusBar* statusBar{ nullptr };
 
         // File Menu
@@ -153,6 +198,7 @@ namespace ShaderIDE::GUI {
         QAction* saveProjectAsAction{ nullptr };
         QAction* exportShadersAction{ nullptr };
         QAction* exportSPIRVAction{ nullptr };
+        QAction* toggleSPIRVOptimizationAction{ nullptr };
         QAction* settingsAction{ nullptr };
         QAction* exitAction{ nullptr };
 
@@ -167,6 +213,12 @@ namespace ShaderIDE::GUI {
         QAction* compileCodeAction{ nullptr };
         QAction* toggleRealtimeCompilationAction{ nullptr };
         QAction* toggleWordWrapAction{ nullptr };
+        QAction* toggleHotLiteralsAction{ nullptr };
+        QAction* permutationsAction{ nullptr };
+        QAction* computeAction{ nullptr };
+        QAction* profileTilesAction{ nullptr };
+        QAction* exportTileProfileAction{ nullptr };
+        QAction* clearTileHeatmapAction{ nullptr };
 
         // Help Menu
         QMenu* helpMenu{ nullptr };
@@ -176,6 +228,14 @@ namespace ShaderIDE::GUI {
         QString lastShaderProjectOpenPath{ "" };
         ShaderProject* shaderProject{ nullptr };
 
+        // External Tools
+        ProcessRunner* processRunner{ nullptr };
+
+#ifdef SHADERIDE_SPIRV_EXPORT
+        // SPIR-V Export
+        SPIRVCompiler spirvCompiler;
+#endif
+
         // Init
         void InitLayout();
         void InitMenuBar();
@@ -188,14 +248,20 @@ namespace ShaderIDE::GUI {
         void InitLogOutputWidget();
         void InitSettingsDialog();
         void InitAboutDialog();
+        void InitPermutationDialog();
+        void InitComputeDialog();
+        void InitImageDecoder();
         void InitStatusBar();
         void InitShaderProject();
+        void InitProcessRunner();
 
         // UI
         void SwapLayout();
         void ResetLayout();
         void UpdateWindowTitle();
         void ApplyTextureSlots();
+        void ApplyTextureSlotCount(int count);
+        void ApplyTextureSlot(TextureBrowserImage* image);
 
         void LogMessage(const QString& message);
 
@@ -206,6 +272,7 @@ namespace ShaderIDE::GUI {
         bool ApplyUIFromProject();
         void ExportShaders(const QUrl& directory);
         void ExportSPIRV(const QUrl& directory);
+        void RunPostExportCommand(const QUrl& directory);
 
         void ConnectShaderProjectSignals();
 
@@ -220,6 +287,7 @@ namespace ShaderIDE::GUI {
 
         void SaveApplicationSettings();
         void LoadApplicationSettings();
+        qint64 TextureMemoryLimit() const; // Bytes
     };
 }
 
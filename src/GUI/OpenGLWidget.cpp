@@ -31,10 +31,9 @@
 #include <QMouseEvent>
 #include <glm/gtc/type_ptr.hpp>
 #include "OpenGLWidget.hpp"
-#include "src/Core/SyntaxErrorException.hpp"
 #include "src/Core/Memory.hpp"
 #include "src/GL/GLDefaults.hpp"
-#include "src/GL/GLUtility.hpp"
+#include "src/GL/TextureSlots.hpp"
 #include "src/GL/Loaders/OBJMeshLoader.hpp"
 #include "src/GUI/Style/OpenGLWidgetStyle.hpp"
 
@@ -50,6 +49,7 @@ OpenGLWidget::OpenGLWidget(QSplitter* splitter, QWidget* parent)
     InitTopLayout();
     InitQuickModelButtons();
     InitLoadingWidget();
+    InitTileHeatmap();
 
     // Load Default Mesh
     LoadOBJMesh(":/models/cube.obj");
@@ -59,20 +59,35 @@ OpenGLWidget::OpenGLWidget(QSplitter* splitter, QWidget* parent)
 
     ResetModelRotation();
     ResetCameraPosition();
+
+    // Realtime Compilation
+    connect(&compileScheduler, SIGNAL(NotifyCompile()),
+            this, SLOT(OnScheduledCompile()));
+
+    connect(&compileScheduler, SIGNAL(NotifyLogMessage(const QString&)),
+            this, SIGNAL(NotifyLogMessage(const QString&)));
 }
 
 OpenGLWidget::~OpenGLWidget()
 {
     // Loading Widget
     Memory::Release(loadingWidget);
+    Memory::Release(tileHeatmap);
+
+    // Renderer, GL resources are released on the render thread.
+    if (renderer != nullptr) {
+        renderer->Stop();
+    }
+
+    renderThread.quit();
+    renderThread.wait();
 
-    // Texture Slots
-    ReleaseTextures();
+    Memory::Release(renderer);
 
-    Memory::Release(slot0Texture);
-    Memory::Release(slot1Texture);
-    Memory::Release(slot2Texture);
-    Memory::Release(slot3Texture);
+    // Viewport GL resources require the widget context.
+    makeCurrent();
+    Memory::Release(screenQuad);
+    doneCurrent();
 
     // Quick Model Slots
     Memory::Release(btLoadBunny);
@@ -84,6 +99,8 @@ OpenGLWidget::~OpenGLWidget()
 
     // Top Left Layout
     Memory::Release(ibSquareViewport);
+    Memory::Release(cbAccumulation);
+    Memory::Release(cbProgressive);
     Memory::Release(cbPlane2D);
     Memory::Release(cbRealtimeUpdate);
     Memory::Release(topLayout);
@@ -91,13 +108,6 @@ OpenGLWidget::~OpenGLWidget()
     // Overlay
     Memory::Release(overlayLayout);
 
-    // VAO
-    glDeleteBuffers(1, &planeVertexBuffer);
-    glDeleteBuffers(1, &vertexBuffer);
-    glDeleteVertexArrays(1, &planeVAO);
-    glDeleteVertexArrays(1, &vao);
-    glDeleteProgram(program);
-
     modelLoaderThread.quit();
     modelLoaderThread.wait();
 }
@@ -158,6 +168,41 @@ bool OpenGLWidget::Plane2D()
     return plane2D;
 }
 
+void OpenGLWidget::CheckProgressive(bool progressiveChecked)
+{
+    cbProgressive->setChecked(progressiveChecked);
+}
+
+bool OpenGLWidget::Progressive()
+{
+    return progressive;
+}
+
+void OpenGLWidget::CheckAccumulation(bool accumulationChecked)
+{
+    cbAccumulation->setChecked(accumulationChecked);
+}
+
+bool OpenGLWidget::Accumulation()
+{
+    return accumulation;
+}
+
+void OpenGLWidget::SetSamples(int numSamples)
+{
+    if (numSamples == samples) {
+        return;
+    }
+
+    samples = numSamples;
+    UpdateRenderState();
+}
+
+int OpenGLWidget::Samples()
+{
+    return samples;
+}
+
 void OpenGLWidget::RotateModel(const glm::vec3& rotation)
 {
     // Reset model matrix first.
@@ -171,6 +216,7 @@ void OpenGLWidget::RotateModel(const glm::vec3& rotation)
     modelMatrix = glm::rotate(modelMatrix, modelRotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
     modelMatrix = glm::rotate(modelMatrix, modelRotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
 
+    UpdateRenderState();
     emit NotifyModelRotationChanged(modelRotation);
 }
 
@@ -179,6 +225,7 @@ void OpenGLWidget::MoveCamera(const glm::vec3& position)
     cameraPosition = position;
     viewMatrix = glm::translate(glm::mat4(1.0f), cameraPosition);
 
+    UpdateRenderState();
     emit NotifyCameraPositionChanged(cameraPosition);
 }
 
@@ -194,19 +241,49 @@ glm::vec3 OpenGLWidget::CameraPosition()
 
 void OpenGLWidget::SetVertexShaderSource(const QString& source)
 {
-    vertexShader->SetSource(source);
+    vertexShaderSource = source;
+
+    if (renderer != nullptr) {
+        renderer->SetVertexShaderSource(source);
+    }
 
     if (realtimeCompilation) {
-        OnCompileShaders();
+        compileScheduler.Request(vertexShaderSource, fragmentShaderSource, computeShaderSource);
     }
 }
 
 void OpenGLWidget::SetFragmentShaderSource(const QString& source)
 {
-    fragmentShader->SetSource(source);
+    fragmentShaderSource = source;
+
+    if (renderer != nullptr) {
+        renderer->SetFragmentShaderSource(source);
+    }
+
+    if (realtimeCompilation) {
+        compileScheduler.Request(vertexShaderSource, fragmentShaderSource, computeShaderSource);
+    }
+}
+
+void OpenGLWidget::SetComputeShaderSource(const QString& source)
+{
+    computeShaderSource = source;
+
+    if (renderer != nullptr) {
+        renderer->SetComputeShaderSource(source);
+    }
 
     if (realtimeCompilation) {
-        OnCompileShaders();
+        compileScheduler.Request(vertexShaderSource, fragmentShaderSource, computeShaderSource);
+    }
+}
+
+void OpenGLWidget::SetComputeSettings(const ComputeSettings& settings)
+{
+    computeSettings = settings;
+
+    if (renderer != nullptr) {
+        renderer->SetComputeSettings(computeSettings);
     }
 }
 
@@ -227,85 +304,151 @@ bool OpenGLWidget::RealtimeCompilation()
     return realtimeCompilation;
 }
 
-OpenGLWidget::SLOT OpenGLWidget::FindSlotByName(const QString& slotName)
+void OpenGLWidget::SetCompileDelay(int milliseconds)
 {
-    auto slot = OpenGLWidget::SLOT::TEX_0;
+    compileScheduler.SetDelay(milliseconds);
+}
 
-    if (slotName == GLSL_TEXTURE_SLOT_1_NAME) {
-        slot = OpenGLWidget::SLOT::TEX_1;
+int OpenGLWidget::CompileDelay()
+{
+    return compileScheduler.Delay();
+}
+
+void OpenGLWidget::SetSeparableStages(bool enabled)
+{
+    separableStages = enabled;
+
+    // The renderer recompiles the shaders, if the mode changed.
+    if (renderer != nullptr) {
+        renderer->SetSeparableStages(separableStages);
     }
+}
+
+bool OpenGLWidget::SeparableStages()
+{
+    return separableStages;
+}
 
-    if (slotName == GLSL_TEXTURE_SLOT_2_NAME) {
-        slot = OpenGLWidget::SLOT::TEX_2;
+void OpenGLWidget::SetHotLiteralsEnabled(bool enabled)
+{
+    hotLiterals = enabled;
+
+    // The renderer recompiles the shaders, if the mode changed.
+    if (renderer != nullptr) {
+        renderer->SetHotLiterals(hotLiterals);
     }
+}
+
+bool OpenGLWidget::HotLiteralsEnabled()
+{
+    return hotLiterals;
+}
 
-    if (slotName == GLSL_TEXTURE_SLOT_3_NAME) {
-        slot = OpenGLWidget::SLOT::TEX_3;
+void OpenGLWidget::SetHotLiteral(const ShaderType& shaderType, int index, float value)
+{
+    if (renderer != nullptr) {
+        renderer->SetHotLiteral(shaderType, index, value);
     }
+}
+
+void OpenGLWidget::SetIncludeDirectory(const QString& directory)
+{
+    includeDirectory = directory;
 
-    return slot;
+    if (renderer != nullptr) {
+        renderer->SetIncludeDirectory(includeDirectory);
+    }
 }
 
-void OpenGLWidget::ApplyTextureToSlot(const QImage& image, SLOT slot)
+void OpenGLWidget::BuildPermutations(const QList<PermutationDefines>& permutations, bool benchmark)
 {
-    // Image valid?
-    if (image.isNull()) {
-        return;
+    // Results are reported by NotifyPermutationResults.
+    if (renderer != nullptr) {
+        renderer->BuildPermutations(permutations, benchmark);
     }
+}
 
-    // QImage mirrored for each texture to not be applied upside down.
-    switch (slot)
-    {
-        case SLOT::TEX_0:
-            slot0Texture = new QOpenGLTexture(image.mirrored());
-            slot0Texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
-            break;
+void OpenGLWidget::ProfileTiles()
+{
+    // Results are reported by NotifyTileProfile.
+    if (renderer != nullptr) {
+        renderer->ProfileTiles();
+    }
+}
 
-        case SLOT::TEX_1:
-            slot1Texture = new QOpenGLTexture(image.mirrored());
-            slot1Texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
-            break;
+const TileTimings& OpenGLWidget::TileProfile()
+{
+    return tileHeatmap->Timings();
+}
 
-        case SLOT::TEX_2:
-            slot2Texture = new QOpenGLTexture(image.mirrored());
-            slot2Texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
-            break;
+void OpenGLWidget::ClearTileProfile()
+{
+    tileHeatmap->Clear();
+}
 
-        case SLOT::TEX_3:
-            slot3Texture = new QOpenGLTexture(image.mirrored());
-            slot3Texture->setMinMagFilters(QOpenGLTexture::Linear, QOpenGLTexture::Linear);
-            break;
+void OpenGLWidget::SetUniformValue(const QString& name, const glm::vec4& value)
+{
+    // Applied with the next frame, the program is not recompiled.
+    uniformValues.insert(name, value);
+
+    if (renderer != nullptr) {
+        renderer->SetUniformValue(name, value);
     }
+}
 
-    repaint();
+void OpenGLWidget::ClearUniformValues()
+{
+    uniformValues.clear();
+
+    if (renderer != nullptr) {
+        renderer->ClearUniformValues();
+    }
 }
 
-void OpenGLWidget::ClearTextureSlot(SLOT slot)
+void OpenGLWidget::SetTextureSlotCount(int count)
 {
-    // Create black clear image.
-    QImage clearImage(256, 256, QImage::Format_ARGB32);
-    clearImage.fill(Qt::black);
+    textureSlotCount = TextureSlots::ClampCount(count);
 
-    switch (slot)
-    {
-        case SLOT::TEX_0:
-            RecreateTexture(slot0Texture, clearImage);
-            break;
+    if (renderer != nullptr) {
+        renderer->SetTextureSlotCount(textureSlotCount);
+    }
+}
 
-        case SLOT::TEX_1:
-            RecreateTexture(slot1Texture, clearImage);
-            break;
+void OpenGLWidget::SetTextureMemoryLimit(qint64 bytes)
+{
+    textureMemoryLimit = bytes;
 
-        case SLOT::TEX_2:
-            RecreateTexture(slot2Texture, clearImage);
-            break;
+    if (renderer != nullptr) {
+        renderer->SetTextureMemoryLimit(textureMemoryLimit);
+    }
+}
 
-        case SLOT::TEX_3:
-            RecreateTexture(slot3Texture, clearImage);
-            break;
+void OpenGLWidget::ApplyTextureToSlot(const QImage& upload, int slot)
+{
+    if (renderer != nullptr) {
+        renderer->SetTexture(slot, upload);
     }
+}
+
+void OpenGLWidget::ApplyCompressedTextureToSlot(const CompressedImage& image, int slot)
+{
+    if (renderer != nullptr) {
+        renderer->SetCompressedTexture(slot, image);
+    }
+}
 
-    repaint();
+void OpenGLWidget::ApplyStreamedTextureToSlot(const QImage& proxyUpload, const TilePyramid& pyramid, int slot)
+{
+    if (renderer != nullptr) {
+        renderer->SetStreamedTexture(slot, proxyUpload, pyramid);
+    }
+}
+
+void OpenGLWidget::ClearTextureSlot(int slot)
+{
+    if (renderer != nullptr) {
+        renderer->ClearTexture(slot);
+    }
 }
 
 void OpenGLWidget::ResetUI()
@@ -313,50 +456,37 @@ void OpenGLWidget::ResetUI()
     // Uncheck top left layout checkboxes.
     cbRealtimeUpdate->setChecked(false);
     cbPlane2D->setChecked(false);
+    cbProgressive->setChecked(false);
+    cbAccumulation->setChecked(false);
 
     // Load default model and reset matrices.
     OnLoadModelCube();
     ResetModelRotation();
     ResetCameraPosition();
-
-    repaint();
 }
 
 void OpenGLWidget::OnCompileShaders()
 {
-    initializeOpenGLFunctions();
+    // Compiled and linked on the render thread, results
+    // are reported by NotifyCompileSuccess / NotifyCompileError.
+    compileScheduler.MarkCompiled(vertexShaderSource, fragmentShaderSource, computeShaderSource);
 
-    // Vertex Shader
-    try
-    {
-        vertexShader->Compile(program);
-        emit NotifyCompileSuccess("Vertex shader compilation finished without errors.");
-
-    }
-    catch (SyntaxErrorException& e)
-    {
-        LinkProgramAndRepaint();
-        auto error = GLSLCompileError(ShaderType::VertexShader, e.what());
-        emit NotifyCompileError(error);
-        return;
+    if (renderer != nullptr) {
+        renderer->CompileShaders();
     }
+}
 
-    // Fragment Shader
-    try
-    {
-        fragmentShader->Compile(program);
-        emit NotifyCompileSuccess("Fragment shader compilation finished without errors.");
-
-    }
-    catch (SyntaxErrorException& e)
-    {
-        LinkProgramAndRepaint();
-        auto error = GLSLCompileError(ShaderType::FragmentShader, e.what());
-        emit NotifyCompileError(error);
-        return;
+void OpenGLWidget::OnDispatchCompute()
+{
+    if (renderer != nullptr) {
+        renderer->DispatchCompute();
     }
+}
 
-    LinkProgramAndRepaint();
+void OpenGLWidget::OnRendererTileProfile(const TileTimings& timings)
+{
+    tileHeatmap->SetTimings(timings);
+    emit NotifyTileProfile(timings);
 }
 
 void OpenGLWidget::OnLoadModelCube()
@@ -390,9 +520,7 @@ void OpenGLWidget::OnModelLoaded(const QString& name)
     selectedMeshName = name;
     emit NotifyStateUpdated(QString("Model \"") + name + "\" loaded.");
 
-    InitVAO();
-    repaint();
-
+    ApplyVerticesToRenderer();
     emit NotifyMeshSelected(selectedMeshName);
 }
 
@@ -434,31 +562,68 @@ void OpenGLWidget::OnPlane2DStateChanged(const int& state)
     emit NotifyPlane2DToggled(Plane2D());
 }
 
+void OpenGLWidget::OnProgressiveStateChanged(const int& state)
+{
+    switch (state)
+    {
+        case Qt::Checked:
+            EnableProgressive();
+            break;
+
+        case Qt::Unchecked:
+            DisableProgressive();
+            break;
+
+        default:
+            break;
+    }
+}
+
+void OpenGLWidget::OnAccumulationStateChanged(const int& state)
+{
+    switch (state)
+    {
+        case Qt::Checked:
+            EnableAccumulation();
+            break;
+
+        case Qt::Unchecked:
+            DisableAccumulation();
+            break;
+
+        default:
+            break;
+    }
+}
+
 void OpenGLWidget::OnSquareViewportClicked()
 {
     SquareViewportAndUpdateSplitter();
 }
 
-void OpenGLWidget::OnTick()
+void OpenGLWidget::OnRendererCompileError(const GLSLCompileError& error)
 {
-    if (realtime)
-    {
-        repaint();
-        UpdateRenderTime();
-        UpdateRealtime();
+    compileScheduler.Invalidate();
+
+    auto compileError = error;
+    emit NotifyCompileError(compileError);
+}
+
+void OpenGLWidget::OnScheduledCompile()
+{
+    if (renderer != nullptr) {
+        renderer->CompileShaders();
     }
 }
 
 void OpenGLWidget::initializeGL()
 {
     initializeOpenGLFunctions();
-    InitShaders();
-    InitVAO();
-    InitPlaneVAO();
 
-    glEnable(GL_MULTISAMPLE);
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_STENCIL_TEST);
+    // Only used to present the frames of the renderer.
+    screenQuad = new ScreenQuad();
+
+    InitRenderer();
 
     emit NotifyGLInitialized();
 }
@@ -470,46 +635,24 @@ void OpenGLWidget::resizeGL(int w, int h)
 
     loadingWidget->move(w - loadingWidget->width() - 10,
                         h - loadingWidget->height() - 10);
+
+    // Tiles of the previous size do not match the new viewport.
+    tileHeatmap->Clear();
+    tileHeatmap->setGeometry(0, 0, w, h);
+
+    UpdateRenderState();
 }
 
 void OpenGLWidget::paintGL()
 {
     initializeOpenGLFunctions();
 
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
-    // Shader Uniforms
-    glUseProgram(program);
-
-    auto timeLocation = glGetUniformLocation(program, "time");
-    auto resolutionLocation = glGetUniformLocation(program, "resolution");
-    auto mousePosLocation = glGetUniformLocation(program, "mousePos");
-    auto modelMatLocation = glGetUniformLocation(program, "modelMat");
-    auto viewMatLocation = glGetUniformLocation(program, "viewMat");
-    auto projectionMatLocation = glGetUniformLocation(program, "projectionMat");
-
-    // TODO Lights, math constants, camera position etc.
-
-    // Apply Uniform Data
-    glUniform1f(timeLocation, renderTime);
-    glUniform2fv(resolutionLocation, 1, glm::value_ptr(glm::vec2(width(), height())));
-    glUniform2fv(mousePosLocation, 1, glm::value_ptr(mousePos));
-    glUniformMatrix4fv(modelMatLocation, 1, GL_FALSE, GetModelMatrix());
-    glUniformMatrix4fv(viewMatLocation, 1, GL_FALSE, GetViewMatrix());
-    glUniformMatrix4fv(projectionMatLocation, 1, GL_FALSE, GetProjectionMatrix());
-
-    // Samplers (Textures)
-    BindTextures();
-
-    // Draw
-    DrawVAO();
-    DrawPlaneVAO();
-
-    // Reset Shader Program
-    glUseProgram(0);
-
-    ReleaseTextures();
+    // Shaders are executed on the render thread,
+    // painting only presents its latest frame.
+    PresentFrame();
 }
 
 void OpenGLWidget::mousePressEvent(QMouseEvent* event)
@@ -543,7 +686,6 @@ void OpenGLWidget::mouseDoubleClickEvent(QMouseEvent* event)
 
     ResetModelRotation();
     ResetCameraPosition();
-    repaint();
 }
 
 void OpenGLWidget::mouseReleaseEvent(QMouseEvent* event)
@@ -576,55 +718,77 @@ void OpenGLWidget::mouseMoveEvent(QMouseEvent* event)
             static_cast<float>(event->pos().y()) / static_cast<float>(height())
     );
 
-    repaint();
+    // The renderer ignores the position, if
+    // the shader does not depend on it.
+    UpdateRenderState();
 }
 
-void OpenGLWidget::InitShaders()
+void OpenGLWidget::InitRenderer()
 {
-    program = glCreateProgram();
+    if (renderer != nullptr) {
+        return;
+    }
 
-    vertexShader = Shader::MakeShared("", ShaderType::VertexShader);
-    fragmentShader = Shader::MakeShared("", ShaderType::FragmentShader);
-}
+    try
+    {
+        renderer = new Renderer(context());
 
-void OpenGLWidget::InitVAO()
-{
-    if (!vao) {
-        glGenVertexArrays(1, &vao);
+    } catch (GeneralException& e) {
+        emit NotifyGeneralError(e);
+        return;
     }
 
-    glBindVertexArray(vao);
+    connect(renderer, SIGNAL(NotifyFrameReady()),
+            this, SLOT(update()));
 
-    if (!vertexBuffer) {
-        glGenBuffers(1, &vertexBuffer);
-    }
+    connect(renderer, SIGNAL(NotifyCompileSuccess(const QString&)),
+            this, SIGNAL(NotifyCompileSuccess(const QString&)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * STRIDE_SIZE * sizeof(GLfloat),
-                 vertices.data(), GL_STATIC_DRAW);
+    connect(renderer, SIGNAL(NotifyCompileError(const GLSLCompileError&)),
+            this, SLOT(OnRendererCompileError(const GLSLCompileError&)));
 
-    InitAttribsForVAO();
-    glBindVertexArray(0);
-}
+    connect(renderer, SIGNAL(NotifyStateUpdated(const QString&)),
+            this, SIGNAL(NotifyStateUpdated(const QString&)));
 
-void OpenGLWidget::InitPlaneVAO()
-{
-    if (!planeVAO) {
-        glGenVertexArrays(1, &planeVAO);
-    }
+    connect(renderer, SIGNAL(NotifyLogMessage(const QString&)),
+            this, SIGNAL(NotifyLogMessage(const QString&)));
 
-    glBindVertexArray(planeVAO);
+    connect(renderer, SIGNAL(NotifyPermutationResults(const PermutationResults&)),
+            this, SIGNAL(NotifyPermutationResults(const PermutationResults&)));
 
-    if (!planeVertexBuffer) {
-        glGenBuffers(1, &planeVertexBuffer);
-    }
+    connect(renderer, SIGNAL(NotifyUniformsReflected(const ShaderUniforms&)),
+            this, SIGNAL(NotifyUniformsReflected(const ShaderUniforms&)));
+
+    connect(renderer, SIGNAL(NotifyComputeCompiled(const QString&)),
+            this, SIGNAL(NotifyComputeCompiled(const QString&)));
+
+    connect(renderer, SIGNAL(NotifyComputeTimings(double, double, int)),
+            this, SIGNAL(NotifyComputeTimings(double, double, int)));
+
+    connect(renderer, SIGNAL(NotifyTileProfile(const TileTimings&)),
+            this, SLOT(OnRendererTileProfile(const TileTimings&)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, planeVertexBuffer);
-    glBufferData(GL_ARRAY_BUFFER, planeVertices.size() * STRIDE_SIZE * sizeof(GLfloat),
-                 planeVertices.data(), GL_STATIC_DRAW);
+    renderer->Start(&renderThread);
+    renderThread.start();
 
-    InitAttribsForVAO();
-    glBindVertexArray(0);
+    // Initial Scene
+    renderer->SetVertexShaderSource(vertexShaderSource);
+    renderer->SetFragmentShaderSource(fragmentShaderSource);
+    renderer->SetComputeShaderSource(computeShaderSource);
+    renderer->SetComputeSettings(computeSettings);
+    renderer->SetSeparableStages(separableStages);
+    renderer->SetHotLiterals(hotLiterals);
+    renderer->SetIncludeDirectory(includeDirectory);
+    renderer->SetTextureSlotCount(textureSlotCount);
+    renderer->SetTextureMemoryLimit(textureMemoryLimit);
+
+    for (auto it = uniformValues.constBegin(); it != uniformValues.constEnd(); ++it) {
+        renderer->SetUniformValue(it.key(), it.value());
+    }
+
+    renderer->SetPlaneVertices(planeVertices);
+    ApplyVerticesToRenderer();
+    UpdateRenderState();
 }
 
 void OpenGLWidget::InitOverlay()
@@ -657,6 +821,23 @@ void OpenGLWidget::InitTopLayout()
     connect(cbPlane2D, SIGNAL(stateChanged(int)),
             this, SLOT(OnPlane2DStateChanged(int)));
 
+    // Progressive Checkbox (Plane 2D only)
+    cbProgressive = new QCheckBox("Progressive");
+    cbProgressive->setToolTip("Render the plane tile by tile over multiple frames.");
+    cbProgressive->setVisible(false);
+    topLayout->addWidget(cbProgressive);
+
+    connect(cbProgressive, SIGNAL(stateChanged(int)),
+            this, SLOT(OnProgressiveStateChanged(int)));
+
+    // Accumulation Checkbox
+    cbAccumulation = new QCheckBox("Accumulate");
+    cbAccumulation->setToolTip("Average jittered frames while the scene is static.");
+    topLayout->addWidget(cbAccumulation);
+
+    connect(cbAccumulation, SIGNAL(stateChanged(int)),
+            this, SLOT(OnAccumulationStateChanged(int)));
+
     // Square Viewport
     ibSquareViewport = new ImageButton(":/images/64/square.png");
     ibSquareViewport->setToolTip("Square viewport.");
@@ -706,6 +887,11 @@ void OpenGLWidget::InitLoadingWidget()
     loadingWidget = new LoadingWidget(this);
 }
 
+void OpenGLWidget::InitTileHeatmap()
+{
+    tileHeatmap = new TileHeatmap(this);
+}
+
 void OpenGLWidget::ShowQuickLoadModelsLayout()
 {
     btLoadCube->setVisible(true);
@@ -748,32 +934,117 @@ void OpenGLWidget::SquareViewportAndUpdateSplitter()
 void OpenGLWidget::EnableRealtime()
 {
     realtime = true;
-    DetermineStartTime();
-    UpdateRealtime();
+    UpdateRenderState();
 }
 
 void OpenGLWidget::DisableRealtime()
 {
     realtime = false;
-}
-
-void OpenGLWidget::UpdateRealtime()
-{
-    QTimer::singleShot(0.0f, this, SLOT(OnTick()));
+    UpdateRenderState();
 }
 
 void OpenGLWidget::EnablePlane2D()
 {
     plane2D = true;
     HideQuickLoadModelsLayout();
-    repaint();
+    cbProgressive->setVisible(true);
+    UpdateRenderState();
 }
 
 void OpenGLWidget::DisablePlane2D()
 {
     plane2D = false;
     ShowQuickLoadModelsLayout();
-    repaint();
+    cbProgressive->setVisible(false);
+    UpdateRenderState();
+}
+
+void OpenGLWidget::EnableProgressive()
+{
+    progressive = true;
+    UpdateRenderState();
+}
+
+void OpenGLWidget::DisableProgressive()
+{
+    progressive = false;
+    UpdateRenderState();
+}
+
+void OpenGLWidget::EnableAccumulation()
+{
+    accumulation = true;
+    UpdateRenderState();
+}
+
+void OpenGLWidget::DisableAccumulation()
+{
+    accumulation = false;
+    UpdateRenderState();
+}
+
+void OpenGLWidget::UpdateRenderState()
+{
+    if (renderer == nullptr) {
+        return;
+    }
+
+    RenderState renderState;
+    renderState.modelMatrix = modelMatrix;
+    renderState.viewMatrix = viewMatrix;
+    renderState.projectionMatrix = projectionMatrix;
+    renderState.mousePos = mousePos;
+    renderState.resolution = glm::vec2(width(), height());
+    renderState.framebufferSize = FramebufferSize();
+    renderState.samples = samples;
+    renderState.realtime = realtime;
+    renderState.plane2D = plane2D;
+    renderState.progressive = progressive;
+    renderState.accumulation = accumulation;
+
+    renderer->SetState(renderState);
+}
+
+void OpenGLWidget::PresentFrame()
+{
+    if (renderer == nullptr) {
+        return;
+    }
+
+    GLuint texture = 0;
+    GLsync renderFence = nullptr;
+
+    if (!renderer->Frames().AcquireFront(texture, renderFence)) {
+        return;
+    }
+
+    // Wait on the GPU (not the CPU) for the renderer to finish the frame.
+    if (renderFence != nullptr)
+    {
+        glWaitSync(renderFence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(renderFence);
+    }
+
+    screenQuad->Draw(texture);
+
+    // The renderer waits for this fence, before it draws into the frame again.
+    auto presentFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    auto previousFence = renderer->Frames().ReplacePresentFence(presentFence);
+
+    if (previousFence != nullptr) {
+        glDeleteSync(previousFence);
+    }
+
+    glFlush();
+    renderer->FramePresented();
+}
+
+QSize OpenGLWidget::FramebufferSize() const
+{
+    return {
+        qRound(width() * devicePixelRatioF()),
+        qRound(height() * devicePixelRatioF())
+    };
 }
 
 void OpenGLWidget::EnableMouseDrag()
@@ -836,6 +1107,7 @@ void OpenGLWidget::ApplyMouseDrag(QMouseEvent* event)
     modelMatrix = glm::rotate(glm::mat4(1.0f), modelRotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
     modelMatrix = glm::rotate(modelMatrix, modelRotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
 
+    UpdateRenderState();
     emit NotifyModelRotationChanged(modelRotation);
 }
 
@@ -874,6 +1146,7 @@ void OpenGLWidget::ApplyMouseShift(QMouseEvent* event)
     );
 
     viewMatrix = glm::translate(glm::mat4(1.0f), cameraPosition);
+    UpdateRenderState();
 }
 
 void OpenGLWidget::ResetModelRotation()
@@ -962,145 +1235,13 @@ void OpenGLWidget::ApplyVertices(const VertexVec& newVertices)
     modelLoaderMutex.unlock();
 }
 
-GLfloat* OpenGLWidget::GetModelMatrix()
-{
-    if (plane2D) {
-        return glm::value_ptr(identityMatrix);
-    }
-
-    return glm::value_ptr(modelMatrix);
-}
-
-GLfloat* OpenGLWidget::GetViewMatrix()
-{
-    if (plane2D) {
-        return glm::value_ptr(identityMatrix);
-    }
-
-    return glm::value_ptr(viewMatrix);
-}
-
-GLfloat* OpenGLWidget::GetProjectionMatrix()
-{
-    if (plane2D) {
-        return glm::value_ptr(identityMatrix);
-    }
-
-    return glm::value_ptr(projectionMatrix);
-}
-
-void OpenGLWidget::DetermineStartTime()
-{
-    startTime = QDateTime::currentDateTime();
-}
-
-void OpenGLWidget::UpdateRenderTime()
-{
-    auto millisDiff = static_cast<float>(startTime.msecsTo(QDateTime::currentDateTime()));
-    renderTime = millisDiff / 1000.0f;
-}
-
-void OpenGLWidget::RecreateTexture(QOpenGLTexture* texture, const QImage& image)
-{
-    if (texture == nullptr) {
-        return;
-    }
-
-    texture->destroy();
-    texture->setData(image, QOpenGLTexture::MipMapGeneration::GenerateMipMaps);
-    texture->create();
-}
-
-void OpenGLWidget::BindTexture(QOpenGLTexture* texture,
-                               const QString& location,
-                               const uint8_t& unit)
-{
-    if (texture != nullptr)
-    {
-        auto uniformLocation = glGetUniformLocation(program, location.toStdString().c_str());
-
-        if (uniformLocation)
-        {
-            glUniform1i(uniformLocation, unit);
-            texture->bind(unit);
-        }
-    }
-}
-
-void OpenGLWidget::BindTextures()
-{
-    BindTexture(slot0Texture, GLSL_TEXTURE_SLOT_0_NAME, 0);
-    BindTexture(slot1Texture, GLSL_TEXTURE_SLOT_1_NAME, 1);
-    BindTexture(slot2Texture, GLSL_TEXTURE_SLOT_2_NAME, 2);
-    BindTexture(slot3Texture, GLSL_TEXTURE_SLOT_3_NAME, 3);
-}
-
-void OpenGLWidget::ReleaseTextures()
-{
-    if (slot0Texture) {
-        slot0Texture->release();
-    }
-
-    if (slot1Texture) {
-        slot1Texture->release();
-    }
-
-    if (slot2Texture) {
-        slot2Texture->release();
-    }
-
-    if (slot3Texture) {
-        slot3Texture->release();
-    }
-}
-
-void OpenGLWidget::InitAttribsForVAO()
-{
-    // Vertex Position Attrib
-    auto vPosLocation = glGetAttribLocation(program, "position");
-    glEnableVertexAttribArray(vPosLocation);
-    glVertexAttribPointer(vPosLocation, 3, GL_FLOAT, GL_FALSE,
-                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(0));
-
-    // Normal Attrib
-    auto vNormalLocation = glGetAttribLocation(program, "normal");
-    glEnableVertexAttribArray(vNormalLocation);
-    glVertexAttribPointer(vNormalLocation, 3, GL_FLOAT, GL_FALSE,
-                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(3));
-
-    // UV Attrib
-    auto vTexUVLocation = glGetAttribLocation(program, "uv");
-    glEnableVertexAttribArray(vTexUVLocation);
-    glVertexAttribPointer(vTexUVLocation, 2, GL_FLOAT, GL_FALSE,
-                          GLUtility::StrideSize(STRIDE_SIZE), GLUtility::StridePtr(6));
-}
-
-void OpenGLWidget::LinkProgramAndRepaint()
-{
-    glLinkProgram(program);
-    InitVAO();
-    InitPlaneVAO();
-    repaint();
-}
-
-void OpenGLWidget::DrawVAO()
+void OpenGLWidget::ApplyVerticesToRenderer()
 {
-    if (plane2D) {
+    if (renderer == nullptr) {
         return;
     }
 
-    glBindVertexArray(vao);
-    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
-    glBindVertexArray(0);
-}
-
-void OpenGLWidget::DrawPlaneVAO()
-{
-    if (!plane2D) {
-        return;
-    }
-
-    glBindVertexArray(planeVAO);
-    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(planeVertices.size()));
-    glBindVertexArray(0);
+    modelLoaderMutex.lock();
+    renderer->SetMeshVertices(vertices);
+    modelLoaderMutex.unlock();
 }
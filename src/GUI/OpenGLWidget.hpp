@@ -35,7 +35,6 @@
 #include <array>
 #include <QtOpenGLWidgets/QOpenGLWidget>
 #include <QtOpenGL/QOpenGLFunctions_4_5_Core>
-#include <QtOpenGL/QOpenGLTexture>
 #include <QThread>
 #include <QImage>
 #include <QHBoxLayout>
@@ -45,18 +44,23 @@
 #include <QSet>
 #include <QShortcut>
 #include <QTimer>
-#include <QDateTime>
 #include <QMap>
+#include <QHash>
 #include <QMutex>
 #include <QSplitter>
 #include <glm/glm.hpp>
 #include "src/Core/GeneralException.hpp"
+#include "src/Core/ApplicationDefaults.hpp"
 #include "Widgets/ImageButton.hpp"
 #include "Widgets/LoadingWidget.hpp"
+#include "Widgets/TileHeatmap.hpp"
 #include "src/GL/World/Mesh.hpp"
 #include "src/GL/Shader.hpp"
 #include "src/GL/GLSLCompileError.hpp"
+#include "src/GL/ScreenQuad.hpp"
+#include "src/GL/Renderer.hpp"
 #include "AsyncModelLoader.hpp"
+#include "CompileScheduler.hpp"
 
 using namespace ShaderIDE::GL;
 
@@ -71,17 +75,8 @@ namespace ShaderIDE::GUI {
         static constexpr float MODEL_ROTATION_INTENSITY = 0.5f;
         static constexpr float MODEL_ZOOM_INTENSITY = 0.02f;
         static constexpr float MODEL_SHIFT_INTENSITY = 0.008f;
-        static constexpr uint8_t STRIDE_SIZE = 8;
 
     public:
-        enum class SLOT
-        {
-            TEX_0,
-            TEX_1,
-            TEX_2,
-            TEX_3
-        };
-
         explicit OpenGLWidget(QSplitter* splitter, QWidget* parent = nullptr);
         ~OpenGLWidget() override;
 
@@ -94,6 +89,15 @@ namespace ShaderIDE::GUI {
         void CheckPlane2D(bool plane2DChecked);
         bool Plane2D();
 
+        void CheckProgressive(bool progressiveChecked);
+        bool Progressive();
+
+        void CheckAccumulation(bool accumulationChecked);
+        bool Accumulation();
+
+        void SetSamples(int numSamples);
+        int Samples();
+
         void RotateModel(const glm::vec3& rotation);
         void MoveCamera(const glm::vec3& position);
 
@@ -102,14 +106,41 @@ namespace ShaderIDE::GUI {
 
         void SetVertexShaderSource(const QString& source);
         void SetFragmentShaderSource(const QString& source);
+        void SetComputeShaderSource(const QString& source);
+
+        void SetComputeSettings(const ComputeSettings& settings);
 
         void SetRealtimeCompilationEnabled(bool value);
         void ToggleRealtimeCompilation();
         bool RealtimeCompilation();
 
-        static SLOT FindSlotByName(const QString& slotName);
-        void ApplyTextureToSlot(const QImage& image, SLOT slot);
-        void ClearTextureSlot(SLOT slot);
+        void SetCompileDelay(int milliseconds);
+        int CompileDelay();
+
+        void SetSeparableStages(bool enabled);
+        bool SeparableStages();
+
+        void SetIncludeDirectory(const QString& directory);
+
+        void SetHotLiteralsEnabled(bool enabled);
+        bool HotLiteralsEnabled();
+        void SetHotLiteral(const ShaderType& shaderType, int index, float value);
+
+        void BuildPermutations(const QList<PermutationDefines>& permutations, bool benchmark);
+
+        void ProfileTiles();
+        const TileTimings& TileProfile();
+        void ClearTileProfile();
+
+        void SetUniformValue(const QString& name, const glm::vec4& value);
+        void ClearUniformValues();
+
+        void SetTextureSlotCount(int count);
+        void SetTextureMemoryLimit(qint64 bytes); // Per slot, for streamed textures
+        void ApplyTextureToSlot(const QImage& upload, int slot); // See AsyncImageDecoder
+        void ApplyCompressedTextureToSlot(const CompressedImage& image, int slot);
+        void ApplyStreamedTextureToSlot(const QImage& proxyUpload, const TilePyramid& pyramid, int slot);
+        void ClearTextureSlot(int slot);
 
         void ResetUI();
 
@@ -118,6 +149,12 @@ namespace ShaderIDE::GUI {
         void NotifyCompileSuccess(const QString& message);
         void NotifyCompileError(GLSLCompileError& error);
         void NotifyStateUpdated(const QString& message);
+        void NotifyLogMessage(const QString& message);
+        void NotifyPermutationResults(const PermutationResults& results);
+        void NotifyUniformsReflected(const ShaderUniforms& uniforms);
+        void NotifyComputeCompiled(const QString& message);
+        void NotifyComputeTimings(double lastTime, double medianTime, int dispatches);
+        void NotifyTileProfile(const TileTimings& timings);
         void NotifyGeneralError(const GeneralException& error);
         void NotifyTriggerModelLoading();
 
@@ -129,6 +166,7 @@ namespace ShaderIDE::GUI {
 
     public slots:
         void OnCompileShaders();
+        void OnDispatchCompute();
 
     private slots:
         void OnLoadModelCube();
@@ -139,8 +177,12 @@ namespace ShaderIDE::GUI {
         void OnModelLoaded(const QString& name);
         void OnRealtimeUpdateStateChanged(const int& state);
         void OnPlane2DStateChanged(const int& state);
+        void OnProgressiveStateChanged(const int& state);
+        void OnAccumulationStateChanged(const int& state);
         void OnSquareViewportClicked();
-        void OnTick();
+        void OnRendererCompileError(const GLSLCompileError& error);
+        void OnScheduledCompile();
+        void OnRendererTileProfile(const TileTimings& timings);
 
     protected:
         void initializeGL() override;
@@ -155,12 +197,21 @@ namespace ShaderIDE::GUI {
     private:
         QSplitter* splitter{ nullptr }; // DO NOT DESTROY
 
-        GLuint program{ 0 };
-        ShaderSPtr vertexShader;
-        ShaderSPtr fragmentShader;
+        // Renderer (Render Thread)
+        QThread renderThread;
+        Renderer* renderer{ nullptr };
+        ScreenQuad* screenQuad{ nullptr };
+
+        QString vertexShaderSource{ "" };
+        QString fragmentShaderSource{ "" };
+        QString computeShaderSource{ "" };
+        ComputeSettings computeSettings;
+        QString includeDirectory{ "" };
+        int textureSlotCount{ GLSL_TEXTURE_SLOTS_DEFAULT };
+        qint64 textureMemoryLimit{ static_cast<qint64>(SHADERIDE_TEXTURE_MEMORY_PER_SLOT) * 1024 * 1024 };
+        QHash<QString, glm::vec4> uniformValues;
+        CompileScheduler compileScheduler;
 
-        GLuint vao{ 0 };
-        GLuint vertexBuffer{ 0 };
         VertexVec vertices;
         VertexVec cubeVertices;
         VertexVec sphereVertices;
@@ -169,8 +220,6 @@ namespace ShaderIDE::GUI {
         VertexVec bunnyVertices;
         QString selectedMeshName{ "" };
 
-        GLuint planeVAO{ 0 };
-        GLuint planeVertexBuffer{ 0 };
         VertexVec planeVertices;
 
         // Overlay Layout
@@ -180,6 +229,8 @@ namespace ShaderIDE::GUI {
         QHBoxLayout* topLayout{ nullptr };
         QCheckBox* cbRealtimeUpdate{ nullptr };
         QCheckBox* cbPlane2D{ nullptr };
+        QCheckBox* cbProgressive{ nullptr };
+        QCheckBox* cbAccumulation{ nullptr };
         ImageButton* ibSquareViewport{ nullptr };
 
         // Bottom Left (Quick Load Models)
@@ -195,19 +246,19 @@ namespace ShaderIDE::GUI {
         QMutex modelLoaderMutex;
         LoadingWidget* loadingWidget{ nullptr };
 
-        // Texture Slots
-        QOpenGLTexture* slot0Texture{ nullptr };
-        QOpenGLTexture* slot1Texture{ nullptr };
-        QOpenGLTexture* slot2Texture{ nullptr };
-        QOpenGLTexture* slot3Texture{ nullptr };
+        // Tile Heatmap
+        TileHeatmap* tileHeatmap{ nullptr };
 
         bool realtime{ false };
         bool plane2D{ false };
+        bool progressive{ false };
+        bool accumulation{ false };
         bool realtimeCompilation{ false };
+        bool separableStages{ false };
+        bool hotLiterals{ false };
 
-        // Render Time
-        QDateTime startTime;
-        float renderTime{ 0.0f };
+        // Multisampling
+        int samples{ SHADERIDE_SURFACEFORMAT_NUM_SAMPLES };
 
         // Mouse Model Controls
         glm::vec2 mousePos;
@@ -229,16 +280,14 @@ namespace ShaderIDE::GUI {
         glm::mat4 modelMatrix{ glm::mat4(1.0f) };
         glm::mat4 viewMatrix{ glm::mat4(1.0f) };
         glm::mat4 projectionMatrix{ glm::mat4(1.0f) };
-        glm::mat4 identityMatrix{ glm::mat4(1.0f) };
 
         // Init
-        void InitShaders();
-        void InitVAO();
-        void InitPlaneVAO();
+        void InitRenderer();
         void InitOverlay();
         void InitTopLayout();
         void InitQuickModelButtons();
         void InitLoadingWidget();
+        void InitTileHeatmap();
 
         // Layouts
         void ShowQuickLoadModelsLayout();
@@ -248,12 +297,24 @@ namespace ShaderIDE::GUI {
         // Realtime
         void EnableRealtime();
         void DisableRealtime();
-        void UpdateRealtime();
 
         // Plane 2D
         void EnablePlane2D();
         void DisablePlane2D();
 
+        // Progressive Rendering
+        void EnableProgressive();
+        void DisableProgressive();
+
+        // Temporal Accumulation
+        void EnableAccumulation();
+        void DisableAccumulation();
+
+        // Renderer
+        void UpdateRenderState();
+        void PresentFrame();
+        QSize FramebufferSize() const;
+
         // Mouse Model Controls
         void EnableMouseDrag();
         void DisableMouseDrag();
@@ -281,31 +342,7 @@ namespace ShaderIDE::GUI {
                                    VertexVec& buffer);
 
         void ApplyVertices(const VertexVec& newVertices);
-
-        // Value Pointers
-        GLfloat* GetModelMatrix();
-        GLfloat* GetViewMatrix();
-        GLfloat* GetProjectionMatrix();
-
-        // Render Time
-        void DetermineStartTime();
-        void UpdateRenderTime();
-
-        // Textures
-        void RecreateTexture(QOpenGLTexture* texture, const QImage& image);
-
-        void BindTexture(QOpenGLTexture* texture,
-                         const QString& location,
-                         const uint8_t& unit);
-
-        void BindTextures();
-        void ReleaseTextures();
-
-        // GL
-        void InitAttribsForVAO();
-        void LinkProgramAndRepaint();
-        void DrawVAO();
-        void DrawPlaneVAO();
+        void ApplyVerticesToRenderer();
     };
 }
 
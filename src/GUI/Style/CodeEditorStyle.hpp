@@ -42,6 +42,10 @@
 
 #define STYLE_CODEEDITOR_FONT_SIZE 12
 #define STYLE_CODEEDITOR_HIGHLIGHT_COLOR QColor(38, 38, 38)
+#define STYLE_CODEEDITOR_ERROR_COLOR QColor("#7A1F2F")
+#define STYLE_CODEEDITOR_WARNING_COLOR QColor("#6B5A1E")
+#define STYLE_CODEEDITOR_ERROR_UNDERLINE_COLOR QColor("#CF3550")
+#define STYLE_CODEEDITOR_WARNING_UNDERLINE_COLOR QColor("#E0B84A")
 
 // Line Number Area
 #define STYLE_LINENUMBERAREA_BG_COLOR QColor(40, 40, 40, 255)
@@ -39,11 +39,14 @@ EnvSettingsPanel::EnvSettingsPanel(QWidget* parent)
 {
     InitLayout();
     InitTextureBrowser();
+    InitUniformPanel();
 }
 
 EnvSettingsPanel::~EnvSettingsPanel()
 {
+    Memory::Release(uniformPanel);
     Memory::Release(textureBrowser);
+    Memory::Release(contentLayout);
     Memory::Release(mainLayout);
 }
 
@@ -52,6 +55,11 @@ TextureBrowser* EnvSettingsPanel::GetTextureBrowser()
     return textureBrowser;
 }
 
+UniformPanel* EnvSettingsPanel::GetUniformPanel()
+{
+    return uniformPanel;
+}
+
 void EnvSettingsPanel::Toggle()
 {
     setVisible(!isVisible());
@@ -65,6 +73,7 @@ void EnvSettingsPanel::Hide()
 void EnvSettingsPanel::ResetUI()
 {
     textureBrowser->ClearImages();
+    uniformPanel->ClearUniforms();
 }
 
 void EnvSettingsPanel::paintEvent(QPaintEvent* event)
@@ -84,19 +93,28 @@ void EnvSettingsPanel::InitLayout()
     mainLayout->setSpacing(0);
     mainLayout->setAlignment(Qt::AlignLeft);
     setLayout(mainLayout);
+
+    // Content Layout (Texture Slots | Uniforms)
+    contentLayout = new QHBoxLayout();
+    contentLayout->setContentsMargins(0, 0, 0, 0);
+    contentLayout->setSpacing(0);
+    mainLayout->addLayout(contentLayout, 1);
 }
 
 void EnvSettingsPanel::InitTextureBrowser()
 {
     textureBrowser = new TextureBrowser();
-    mainLayout->addWidget(textureBrowser, 1, Qt::AlignBottom);
+    contentLayout->addWidget(textureBrowser, 2, Qt::AlignBottom);
     LoadTextureBrowserSlots();
 }
 
+void EnvSettingsPanel::InitUniformPanel()
+{
+    uniformPanel = new UniformPanel();
+    contentLayout->addWidget(uniformPanel, 1);
+}
+
 void EnvSettingsPanel::LoadTextureBrowserSlots()
 {
-    textureBrowser->AddImage(GLSL_TEXTURE_SLOT_0_NAME, "");
-    textureBrowser->AddImage(GLSL_TEXTURE_SLOT_1_NAME, "");
-    textureBrowser->AddImage(GLSL_TEXTURE_SLOT_2_NAME, "");
-    textureBrowser->AddImage(GLSL_TEXTURE_SLOT_3_NAME, "");
+    textureBrowser->SetSlotCount(GLSL_TEXTURE_SLOTS_DEFAULT);
 }
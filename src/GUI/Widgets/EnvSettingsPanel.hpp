@@ -31,8 +31,10 @@
 
 #include <QWidget>
 #include <QVBoxLayout>
+#include <QHBoxLayout>
 #include <QFormLayout>
 #include "TextureBrowser.hpp"
+#include "UniformPanel.hpp"
 
 namespace ShaderIDE::GUI {
 
@@ -45,6 +47,7 @@ namespace ShaderIDE::GUI {
         ~EnvSettingsPanel() override;
 
         TextureBrowser* GetTextureBrowser();
+        UniformPanel* GetUniformPanel();
 
         void Toggle();
         void Hide();
@@ -56,10 +59,13 @@ namespace ShaderIDE::GUI {
 
     private:
         QVBoxLayout* mainLayout{ nullptr };
+        QHBoxLayout* contentLayout{ nullptr };
         TextureBrowser* textureBrowser{ nullptr };
+        UniformPanel* uniformPanel{ nullptr };
 
         void InitLayout();
         void InitTextureBrowser();
+        void InitUniformPanel();
 
         void LoadTextureBrowserSlots();
     };
@@ -59,13 +59,14 @@ FileTabWidget::~FileTabWidget()
     Memory::Release(findButton);
     Memory::Release(envSettingsPanelToggle);
     Memory::Release(envSettingsPanel);
+    Memory::Release(csCodeEditor);
     Memory::Release(fsCodeEditor);
     Memory::Release(vsCodeEditor);
 }
 
 bool FileTabWidget::CodeEditorsReady()
 {
-    return vsCodeEditor != nullptr && fsCodeEditor != nullptr;
+    return vsCodeEditor != nullptr && fsCodeEditor != nullptr && csCodeEditor != nullptr;
 }
 
 void FileTabWidget::SetVertexShaderSource(const QString& source)
@@ -88,16 +89,28 @@ QString FileTabWidget::FragmentShaderSource()
     return fsCodeEditor->toPlainText();
 }
 
+void FileTabWidget::SetComputeShaderSource(const QString& source)
+{
+    csCodeEditor->setPlainText(source);
+}
+
+QString FileTabWidget::ComputeShaderSource()
+{
+    return csCodeEditor->toPlainText();
+}
+
 void FileTabWidget::ToggleWordWrap()
 {
     vsCodeEditor->ToggleWordWrap();
     fsCodeEditor->ToggleWordWrap();
+    csCodeEditor->ToggleWordWrap();
 }
 
 void FileTabWidget::SetWordWrapMode(QTextOption::WrapMode& mode)
 {
     vsCodeEditor->setWordWrapMode(mode);
     fsCodeEditor->setWordWrapMode(mode);
+    csCodeEditor->setWordWrapMode(mode);
 }
 
 QTextOption::WrapMode FileTabWidget::WordWrapMode()
@@ -112,6 +125,13 @@ bool FileTabWidget::WordWrap()
     return WordWrapMode() == QTextOption::WordWrap;
 }
 
+void FileTabWidget::SetHotLiteralsEnabled(bool enabled)
+{
+    // Compute shaders are compiled separately, their literals are not scrubbed.
+    vsCodeEditor->SetHotLiteralsEnabled(enabled);
+    fsCodeEditor->SetHotLiteralsEnabled(enabled);
+}
+
 CodeEditor* FileTabWidget::GetVSCodeEditor()
 {
     return vsCodeEditor;
@@ -122,11 +142,21 @@ CodeEditor* FileTabWidget::GetFSCodeEditor()
     return fsCodeEditor;
 }
 
+CodeEditor* FileTabWidget::GetCSCodeEditor()
+{
+    return csCodeEditor;
+}
+
 TextureBrowser* FileTabWidget::GetTextureBrowser()
 {
     return envSettingsPanel->GetTextureBrowser();
 }
 
+UniformPanel* FileTabWidget::GetUniformPanel()
+{
+    return envSettingsPanel->GetUniformPanel();
+}
+
 void FileTabWidget::ResetUI()
 {
     envSettingsPanel->ResetUI();
@@ -148,6 +178,7 @@ void FileTabWidget::keyPressEvent(QKeyEvent* event)
     {
         vsCodeEditor->ResetSearchLines();
         fsCodeEditor->ResetSearchLines();
+        csCodeEditor->ResetSearchLines();
         findWidget->Hide();
     }
 }
@@ -162,6 +193,11 @@ void FileTabWidget::OnFSCodeChanged(const QString& code)
     emit NotifyFSCodeChanged(code);
 }
 
+void FileTabWidget::OnCSCodeChanged(const QString& code)
+{
+    emit NotifyCSCodeChanged(code);
+}
+
 void FileTabWidget::OnHideEnvSettingsPanel()
 {
     envSettingsPanel->Hide();
@@ -189,6 +225,10 @@ void FileTabWidget::OnTabChanged(const int& index)
             findWidget->SetCodeEditor(fsCodeEditor);
             break;
 
+        case CS_TAB_INDEX:
+            findWidget->SetCodeEditor(csCodeEditor);
+            break;
+
         default:
             break;
     }
@@ -215,6 +255,9 @@ void FileTabWidget::InitCodeEditors()
     connect(vsCodeEditor, SIGNAL(NotifyMouseReleased()),
             this, SLOT(OnHideEnvSettingsPanel()));
 
+    connect(vsCodeEditor, SIGNAL(NotifyHotLiteralChanged(int, float)),
+            this, SIGNAL(NotifyVSHotLiteralChanged(int, float)));
+
     // Fragment Shader Code Editor
     fsCodeEditor = new CodeEditor();
     fsCodeEditor->LoadSyntaxFile(":/config/glsl460.json");
@@ -226,6 +269,20 @@ void FileTabWidget::InitCodeEditors()
     connect(fsCodeEditor, SIGNAL(NotifyMouseReleased()),
             this, SLOT(OnHideEnvSettingsPanel()));
 
+    connect(fsCodeEditor, SIGNAL(NotifyHotLiteralChanged(int, float)),
+            this, SIGNAL(NotifyFSHotLiteralChanged(int, float)));
+
+    // Compute Shader Code Editor
+    csCodeEditor = new CodeEditor();
+    csCodeEditor->LoadSyntaxFile(":/config/glsl460.json");
+    addTab(csCodeEditor, "Compute Shader");
+
+    connect(csCodeEditor, SIGNAL(NotifyCodeChanged(const QString&)),
+            this, SLOT(OnCSCodeChanged(const QString&)));
+
+    connect(csCodeEditor, SIGNAL(NotifyMouseReleased()),
+            this, SLOT(OnHideEnvSettingsPanel()));
+
     // Find Button
     findButton = new ImageButton(":/icons/icon-find.png", this);
 
@@ -43,6 +43,7 @@ namespace ShaderIDE::GUI {
         Q_OBJECT
         static constexpr int VS_TAB_INDEX = 0;
         static constexpr int FS_TAB_INDEX = 1;
+        static constexpr int CS_TAB_INDEX = 2;
 
     public:
         explicit FileTabWidget(QWidget* parent = nullptr);
@@ -56,20 +57,30 @@ namespace ShaderIDE::GUI {
         void SetFragmentShaderSource(const QString& source);
         QString FragmentShaderSource();
 
+        void SetComputeShaderSource(const QString& source);
+        QString ComputeShaderSource();
+
         void ToggleWordWrap();
         void SetWordWrapMode(QTextOption::WrapMode& mode);
         QTextOption::WrapMode WordWrapMode();
         bool WordWrap();
 
+        void SetHotLiteralsEnabled(bool enabled);
+
         CodeEditor* GetVSCodeEditor();
         CodeEditor* GetFSCodeEditor();
+        CodeEditor* GetCSCodeEditor();
         TextureBrowser* GetTextureBrowser();
+        UniformPanel* GetUniformPanel();
 
         void ResetUI();
 
     signals:
         void NotifyVSCodeChanged(const QString&);
         void NotifyFSCodeChanged(const QString&);
+        void NotifyCSCodeChanged(const QString&);
+        void NotifyVSHotLiteralChanged(int index, float value);
+        void NotifyFSHotLiteralChanged(int index, float value);
 
     protected:
         void resizeEvent(QResizeEvent* event) override;
@@ -78,6 +89,7 @@ namespace ShaderIDE::GUI {
     private slots:
         void OnVSCodeChanged(const QString& code);
         void OnFSCodeChanged(const QString& code);
+        void OnCSCodeChanged(const QString& code);
         void OnHideEnvSettingsPanel();
         void OnFindButtonClicked();
         void OnToggleEnvSettingsPanel();
@@ -86,6 +98,7 @@ namespace ShaderIDE::GUI {
     private:
         CodeEditor* vsCodeEditor{ nullptr };
         CodeEditor* fsCodeEditor{ nullptr };
+        CodeEditor* csCodeEditor{ nullptr };
         EnvSettingsPanel* envSettingsPanel{ nullptr };
         ImageButton* findButton{ nullptr };
         ImageButton* envSettingsPanelToggle{ nullptr };
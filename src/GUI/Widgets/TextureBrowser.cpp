@@ -33,6 +33,8 @@
 #include "src/Core/Memory.hpp"
 #include "src/Core/QtUtility.hpp"
 #include "src/Core/GeneralException.hpp"
+#include "src/GL/TextureSlots.hpp"
+#include "src/GL/GLDefaults.hpp"
 
 using namespace ShaderIDE::GUI;
 
@@ -64,8 +66,8 @@ void TextureBrowser::AddImage(const QString& name, const QString& path)
     scrollLayout->addWidget(image);
     ResizeScrollWidget();
 
-    connect(image, SIGNAL(NotifyImageChanged(TextureBrowserImage*)),
-            this, SLOT(OnImageChanged(TextureBrowserImage*)));
+    connect(image, SIGNAL(NotifyImageRequested(TextureBrowserImage*, const QString&)),
+            this, SLOT(OnImageRequested(TextureBrowserImage*, const QString&)));
 
     connect(image, SIGNAL(NotifyImageCleared(TextureBrowserImage*)),
             this, SLOT(OnImageCleared(TextureBrowserImage*)));
@@ -88,8 +90,10 @@ void TextureBrowser::RemoveImage(const QString& name)
 
     if (it != images.end())
     {
+        auto* image = it.value();
         images.erase(it);
-        Memory::Release(*it);
+        Memory::Release(image);
+        ResizeScrollWidget();
     }
 }
 
@@ -100,14 +104,36 @@ void TextureBrowser::ClearImages()
     }
 }
 
+void TextureBrowser::SetSlotCount(int count)
+{
+    count = GL::TextureSlots::ClampCount(count);
+
+    for (int slot = count; slot < slotCount; slot++) {
+        RemoveImage(GL::TextureSlots::Name(slot));
+    }
+
+    for (int slot = slotCount; slot < count; slot++) {
+        AddImage(GL::TextureSlots::Name(slot), "");
+    }
+
+    slotCount = count;
+    btAddSlot->setEnabled(slotCount < GLSL_TEXTURE_SLOTS_MAX);
+    btRemoveSlot->setEnabled(slotCount > 1);
+}
+
+int TextureBrowser::SlotCount() const
+{
+    return slotCount;
+}
+
 void TextureBrowser::paintEvent(QPaintEvent* event)
 {
     QtUtility::PaintQObjectStyleSheets(this);
 }
 
-void TextureBrowser::OnImageChanged(TextureBrowserImage* image)
+void TextureBrowser::OnImageRequested(TextureBrowserImage* image, const QString& path)
 {
-    emit NotifyImageChanged(image);
+    emit NotifyImageRequested(image, path);
 }
 
 void TextureBrowser::OnImageCleared(TextureBrowserImage* image)
@@ -128,11 +154,36 @@ void TextureBrowser::InitLayout()
     mainLayout->setAlignment(Qt::AlignLeft);
     setLayout(mainLayout);
 
-    // Title Label
+    // Title Layout
+    titleLayout = new QHBoxLayout();
+    titleLayout->setContentsMargins(20, 20, 20, 0);
+    titleLayout->setSpacing(5);
+
     titleLabel = new QLabel("Texture Slots");
     titleLabel->setProperty("class", "title");
-    titleLabel->setContentsMargins(20, 20, 20, 0);
-    mainLayout->addWidget(titleLabel);
+    titleLayout->addWidget(titleLabel);
+    titleLayout->addStretch();
+
+    btRemoveSlot = new QPushButton("-");
+    btRemoveSlot->setFixedSize(22, 22);
+    btRemoveSlot->setToolTip("Remove the last texture slot");
+    titleLayout->addWidget(btRemoveSlot);
+
+    btAddSlot = new QPushButton("+");
+    btAddSlot->setFixedSize(22, 22);
+    btAddSlot->setToolTip("Add a texture slot");
+    titleLayout->addWidget(btAddSlot);
+
+    mainLayout->addLayout(titleLayout);
+
+    // Slots change with the project, see SetSlotCount().
+    connect(btRemoveSlot, &QPushButton::clicked, this, [this]() {
+        emit NotifySlotCountRequested(slotCount - 1);
+    });
+
+    connect(btAddSlot, &QPushButton::clicked, this, [this]() {
+        emit NotifySlotCountRequested(slotCount + 1);
+    });
 
     // Scroll Widget / Layout
     scrollWidget = new QWidget();
@@ -33,6 +33,7 @@
 #include <QScrollArea>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
+#include <QPushButton>
 #include <QMap>
 #include "TextureBrowserImage.hpp"
 
@@ -54,21 +55,30 @@ namespace ShaderIDE::GUI {
 
         void ClearImages();
 
+        // Texture slots tex0 ... texN-1, images of removed slots are destroyed.
+        void SetSlotCount(int count);
+        int SlotCount() const;
+
     signals:
-        void NotifyImageChanged(TextureBrowserImage* image);
+        void NotifyImageRequested(TextureBrowserImage* image, const QString& path);
         void NotifyImageCleared(TextureBrowserImage* image);
+        void NotifySlotCountRequested(int count);
 
     protected:
         void paintEvent(QPaintEvent* event) override;
 
     private slots:
-        void OnImageChanged(TextureBrowserImage* image);
+        void OnImageRequested(TextureBrowserImage* image, const QString& path);
         void OnImageCleared(TextureBrowserImage* image);
 
     private:
         QVBoxLayout* mainLayout{ nullptr };
         QWidget* scrollWidget{ nullptr };
+        QHBoxLayout* titleLayout{ nullptr };
         QLabel* titleLabel{ nullptr };
+        QPushButton* btAddSlot{ nullptr };
+        QPushButton* btRemoveSlot{ nullptr };
+        int slotCount{ 0 };
         QHBoxLayout* scrollLayout{ nullptr };
         QScrollArea* scrollArea{ nullptr };
         QMap<QString, TextureBrowserImage*> images;
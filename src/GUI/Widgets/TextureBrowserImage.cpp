@@ -31,6 +31,7 @@
 #include <QFileDialog>
 #include <QMenu>
 #include "TextureBrowserImage.hpp"
+#include "src/GUI/AsyncImageDecoder.hpp"
 #include "src/Core/Application.hpp"
 #include "src/Core/Memory.hpp"
 #include "src/Core/QtUtility.hpp"
@@ -85,16 +86,23 @@ QImage TextureBrowserImage::ImageHQ()
     return imageHQ;
 }
 
-void TextureBrowserImage::UpdateImage(const QImage& image)
+void TextureBrowserImage::SetDecodedImage(const QImage& image, const QImage& thumbnail, const QString& description)
 {
     imageHQ = image;
-    imageLabel->setPixmap(QPixmap::fromImage(MakeThumbnail(image)));
-    emit NotifyImageChanged(this);
+    imageLabel->setToolTip(description);
+
+    if (thumbnail.isNull() && !description.isEmpty()) {
+        imageLabel->setText(description);
+
+    } else {
+        imageLabel->setPixmap(QPixmap::fromImage(thumbnail));
+    }
 }
 
 void TextureBrowserImage::OnClearImage()
 {
     imageHQ = QImage();
+    imageLabel->setToolTip("");
     imageLabel->setPixmap(QPixmap());
     imageLabel->setText(STYLE_TEXTUREBROWSERIMAGE_NOIMAGE_TEXT);
     emit NotifyImageCleared(this);
@@ -118,16 +126,6 @@ void TextureBrowserImage::mouseReleaseEvent(QMouseEvent* event)
     }
 }
 
-QImage TextureBrowserImage::MakeThumbnail(const QImage& image)
-{
-    return image.scaled(
-            IMAGELABEL_SIZE,
-            IMAGELABEL_SIZE,
-            Qt::KeepAspectRatio,
-            Qt::SmoothTransformation
-    );
-}
-
 void TextureBrowserImage::InitLayout()
 {
     // Style
@@ -182,7 +180,7 @@ void TextureBrowserImage::SetImageLabelImage(const QImage& image)
     {
         imageHQ = image;
         imageLabel->setText("");
-        imageLabel->setPixmap(QPixmap::fromImage(MakeThumbnail(image)));
+        imageLabel->setPixmap(QPixmap::fromImage(AsyncImageDecoder::MakeThumbnail(image)));
     }
 
     mainLayout->addWidget(imageLabel, 1, Qt::AlignTop);
@@ -196,11 +194,12 @@ void TextureBrowserImage::OpenImageFileDialog()
             this,
             "Open Texture Image",
             QString(),
-            QString("Image Files (*.png *.jpg *.jpeg *.tga *.gif *.bmp)")
+            QString("Image Files (*.png *.jpg *.jpeg *.tga *.gif *.bmp *.ktx2 *.dds)")
     );
 
+    // Decoded on a worker thread, see AsyncImageDecoder.
     if (!path.isEmpty()) {
-        UpdateImage(QImage(path));
+        emit NotifyImageRequested(this, path);
     }
 }
 
@@ -56,10 +56,11 @@ namespace ShaderIDE::GUI {
         QImage Image();
         QImage ImageHQ();
 
-        void UpdateImage(const QImage& image);
+        // Decoded by AsyncImageDecoder, the description is shown without thumbnail.
+        void SetDecodedImage(const QImage& image, const QImage& thumbnail, const QString& description = "");
 
     signals:
-        void NotifyImageChanged(TextureBrowserImage* image);
+        void NotifyImageRequested(TextureBrowserImage* image, const QString& path);
         void NotifyImageCleared(TextureBrowserImage* image);
 
     public slots:
@@ -70,8 +71,6 @@ namespace ShaderIDE::GUI {
         void mouseReleaseEvent(QMouseEvent* event) override;
 
     private:
-        static QImage MakeThumbnail(const QImage& image);
-
         QVBoxLayout* mainLayout{ nullptr };
         QLabel* imageLabel{ nullptr };
         QLabel* nameLabel{ nullptr };
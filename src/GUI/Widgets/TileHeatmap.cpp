@@ -0,0 +1,108 @@
+/**
+ * TileHeatmap Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <QPainter>
+#include "TileHeatmap.hpp"
+
+using namespace ShaderIDE::GUI;
+
+TileHeatmap::TileHeatmap(QWidget* parent)
+        : QWidget(parent)
+{
+    setObjectName("TileHeatmap");
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_NoSystemBackground);
+    setVisible(false);
+}
+
+void TileHeatmap::SetTimings(const TileTimings& newTimings)
+{
+    timings = newTimings;
+    setVisible(!timings.Empty());
+    raise();
+    update();
+}
+
+const TileTimings& TileHeatmap::Timings() const
+{
+    return timings;
+}
+
+void TileHeatmap::Clear()
+{
+    timings = TileTimings();
+    setVisible(false);
+}
+
+void TileHeatmap::paintEvent(QPaintEvent* event)
+{
+    if (timings.Empty()) {
+        return;
+    }
+
+    QPainter painter(this);
+    painter.setFont(QFont(font().family(), 8));
+
+    const auto maxMedian = timings.MaxMedian();
+
+    for (int i = 0; i < timings.TileCount(); i++)
+    {
+        const auto rect = TileToWidget(timings.TileRect(i));
+        const auto median = timings.Median(i);
+
+        painter.fillRect(rect, HeatColor(maxMedian > 0.0 ? median / maxMedian : 0.0));
+
+        if (rect.width() >= LABEL_MIN_TILE_SIZE && rect.height() >= LABEL_MIN_TILE_SIZE / 2)
+        {
+            painter.setPen(Qt::white);
+            painter.drawText(rect, Qt::AlignCenter, QString::number(median, 'f', 3));
+        }
+    }
+}
+
+QRectF TileHeatmap::TileToWidget(const QRect& tile) const
+{
+    // Tiles are in framebuffer pixels with the origin at the bottom left.
+    const auto size = timings.Size();
+    const auto scaleX = static_cast<qreal>(width()) / size.width();
+    const auto scaleY = static_cast<qreal>(height()) / size.height();
+
+    return {
+            tile.x() * scaleX,
+            (size.height() - tile.y() - tile.height()) * scaleY,
+            tile.width() * scaleX,
+            tile.height() * scaleY
+    };
+}
+
+QColor TileHeatmap::HeatColor(double value)
+{
+    // Blue (cheap) -> Red (expensive)
+    const auto hue = static_cast<int>(240.0 * (1.0 - qBound(0.0, value, 1.0)));
+    return QColor::fromHsv(hue, 255, 255, HEATMAP_ALPHA);
+}
@@ -0,0 +1,66 @@
+/**
+ * TileHeatmap Class
+ *
+ * Transparent overlay, which shows the per tile
+ * costs of a Plane 2D shader as a heatmap.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GUI_WIDGETS_TILEHEATMAP_HPP
+#define SHADERIDE_GUI_WIDGETS_TILEHEATMAP_HPP
+
+#include <QWidget>
+#include "src/GL/TileTimings.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace ShaderIDE::GUI {
+
+    class TileHeatmap : public QWidget
+    {
+        Q_OBJECT
+        static constexpr int HEATMAP_ALPHA = 140;
+        static constexpr int LABEL_MIN_TILE_SIZE = 40; // Widget pixels
+
+    public:
+        explicit TileHeatmap(QWidget* parent = nullptr);
+
+        void SetTimings(const TileTimings& timings);
+        const TileTimings& Timings() const;
+        void Clear();
+
+    protected:
+        void paintEvent(QPaintEvent* event) override;
+
+    private:
+        TileTimings timings;
+
+        QRectF TileToWidget(const QRect& tile) const;
+        static QColor HeatColor(double value);
+    };
+}
+
+#endif // SHADERIDE_GUI_WIDGETS_TILEHEATMAP_HPP
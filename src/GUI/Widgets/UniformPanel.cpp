@@ -0,0 +1,338 @@
+/**
+ * UniformPanel Class
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cmath>
+#include <QHBoxLayout>
+#include <QSlider>
+#include <QDoubleSpinBox>
+#include <QSpinBox>
+#include <QCheckBox>
+#include <QColorDialog>
+#include <QSignalBlocker>
+#include "UniformPanel.hpp"
+#include "src/GUI/Style/UniformPanelStyle.hpp"
+#include "src/Core/Memory.hpp"
+#include "src/Core/QtUtility.hpp"
+
+using namespace ShaderIDE::GUI;
+
+UniformPanel::UniformPanel(QWidget* parent)
+        : QWidget(parent)
+{
+    InitLayout();
+}
+
+UniformPanel::~UniformPanel()
+{
+    Memory::Release(scrollArea);
+}
+
+void UniformPanel::SetUniforms(const ShaderUniforms& newUniforms,
+                               const std::unordered_map<QString, glm::vec4>& storedValues)
+{
+    // Recompiling with the same uniforms keeps the controls (and the values).
+    if (newUniforms == uniforms) {
+        return;
+    }
+
+    ClearUniforms();
+    uniforms = newUniforms;
+
+    for (const auto& uniform : uniforms)
+    {
+        auto it = storedValues.find(uniform.name);
+        values[uniform.name] = (it != storedValues.end()) ? it->second : uniform.value;
+        AddUniformRow(uniform);
+    }
+
+    emptyLabel->setVisible(uniforms.isEmpty());
+}
+
+void UniformPanel::ClearUniforms()
+{
+    while (formLayout->rowCount() > 0) {
+        formLayout->removeRow(0);
+    }
+
+    uniforms.clear();
+    values.clear();
+    emptyLabel->setVisible(true);
+}
+
+void UniformPanel::paintEvent(QPaintEvent* event)
+{
+    QtUtility::PaintQObjectStyleSheets(this);
+}
+
+void UniformPanel::InitLayout()
+{
+    setMinimumHeight(240);
+    setMinimumWidth(320);
+    setObjectName("UniformPanel");
+    setStyleSheet(STYLE_UNIFORMPANEL);
+
+    // Main Layout
+    mainLayout = new QVBoxLayout();
+    mainLayout->setContentsMargins(0, 0, 0, 0);
+    mainLayout->setSpacing(0);
+    setLayout(mainLayout);
+
+    // Title Label
+    titleLabel = new QLabel("Uniforms");
+    titleLabel->setProperty("class", "title");
+    titleLabel->setContentsMargins(20, 20, 20, 0);
+    mainLayout->addWidget(titleLabel);
+
+    // Scroll Widget / Layout
+    scrollWidget = new QWidget();
+    scrollWidget->setStyleSheet("QWidget { border: none; background: transparent; }");
+
+    formLayout = new QFormLayout();
+    formLayout->setContentsMargins(20, 20, 20, 20);
+    formLayout->setSpacing(6);
+    formLayout->setLabelAlignment(Qt::AlignLeft);
+
+    emptyLabel = new QLabel(STYLE_UNIFORMPANEL_EMPTY_TEXT);
+    emptyLabel->setStyleSheet(STYLE_UNIFORMPANEL_EMPTY_LABEL);
+
+    auto* scrollWidgetLayout = new QVBoxLayout();
+    scrollWidgetLayout->setContentsMargins(0, 0, 0, 0);
+    scrollWidgetLayout->addLayout(formLayout);
+    scrollWidgetLayout->addWidget(emptyLabel);
+    scrollWidgetLayout->addStretch();
+    scrollWidget->setLayout(scrollWidgetLayout);
+
+    // Scroll Area
+    scrollArea = new QScrollArea();
+
+    scrollArea->setStyleSheet(
+            "QWidget { border: none; background: transparent; }"
+            STYLE_SCROLLBAR
+    );
+
+    scrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarPolicy::ScrollBarAlwaysOff);
+    scrollArea->setWidgetResizable(true);
+    scrollArea->setWidget(scrollWidget);
+    mainLayout->addWidget(scrollArea);
+}
+
+void UniformPanel::AddUniformRow(const ShaderUniform& uniform)
+{
+    QWidget* control = nullptr;
+
+    if (uniform.color) {
+        control = CreateColorControl(uniform);
+
+    } else {
+        switch (uniform.type)
+        {
+            case ShaderUniform::TYPE::FLOAT:
+                control = CreateFloatControl(uniform);
+                break;
+
+            case ShaderUniform::TYPE::VEC2:
+            case ShaderUniform::TYPE::VEC3:
+            case ShaderUniform::TYPE::VEC4:
+                control = CreateVectorControl(uniform);
+                break;
+
+            case ShaderUniform::TYPE::INT:
+                control = CreateIntControl(uniform);
+                break;
+
+            case ShaderUniform::TYPE::BOOL:
+                control = CreateBoolControl(uniform);
+                break;
+        }
+    }
+
+    formLayout->addRow(uniform.name, control);
+}
+
+QWidget* UniformPanel::CreateFloatControl(const ShaderUniform& uniform)
+{
+    const auto name = uniform.name;
+    const auto value = static_cast<double>(values[name].x);
+
+    // The slider range is guessed from the initial value,
+    // the spin box accepts any value beyond it.
+    double minimum = value < 0.0 ? -1.0 : 0.0;
+    double maximum = 1.0;
+
+    if (std::abs(value) > 1.0)
+    {
+        maximum = 2.0 * std::abs(value);
+        minimum = value < 0.0 ? -maximum : 0.0;
+    }
+
+    auto* control = new QWidget();
+    auto* layout = new QHBoxLayout();
+    layout->setContentsMargins(0, 0, 0, 0);
+    control->setLayout(layout);
+
+    auto* slider = new QSlider(Qt::Horizontal);
+    slider->setRange(0, SLIDER_STEPS);
+    layout->addWidget(slider, 1);
+
+    auto* spinBox = new QDoubleSpinBox();
+    spinBox->setDecimals(3);
+    spinBox->setSingleStep((maximum - minimum) / 100.0);
+    spinBox->setRange(-SPINBOX_RANGE, SPINBOX_RANGE);
+    spinBox->setValue(value);
+    layout->addWidget(spinBox);
+
+    const auto toSlider = [minimum, maximum](double v) {
+        return static_cast<int>(std::round((v - minimum) / (maximum - minimum) * SLIDER_STEPS));
+    };
+
+    slider->setValue(toSlider(value));
+
+    connect(slider, &QSlider::valueChanged, this, [this, name, spinBox, minimum, maximum](int position) {
+        const auto v = minimum + (maximum - minimum) * position / static_cast<double>(SLIDER_STEPS);
+        const QSignalBlocker blocker(spinBox);
+        spinBox->setValue(v);
+        ChangeValue(name, glm::vec4(static_cast<float>(v), 0.0f, 0.0f, 0.0f));
+    });
+
+    connect(spinBox, &QDoubleSpinBox::valueChanged, this, [this, name, slider, toSlider](double v) {
+        const QSignalBlocker blocker(slider);
+        slider->setValue(toSlider(v));
+        ChangeValue(name, glm::vec4(static_cast<float>(v), 0.0f, 0.0f, 0.0f));
+    });
+
+    return control;
+}
+
+QWidget* UniformPanel::CreateVectorControl(const ShaderUniform& uniform)
+{
+    const auto name = uniform.name;
+
+    auto* control = new QWidget();
+    auto* layout = new QHBoxLayout();
+    layout->setContentsMargins(0, 0, 0, 0);
+    control->setLayout(layout);
+
+    for (int i = 0; i < UniformReflection::Components(uniform.type); i++)
+    {
+        auto* spinBox = new QDoubleSpinBox();
+        spinBox->setDecimals(3);
+        spinBox->setSingleStep(0.01);
+        spinBox->setRange(-SPINBOX_RANGE, SPINBOX_RANGE);
+        spinBox->setValue(static_cast<double>(values[name][i]));
+        layout->addWidget(spinBox);
+
+        connect(spinBox, &QDoubleSpinBox::valueChanged, this, [this, name, i](double v) {
+            auto value = values[name];
+            value[i] = static_cast<float>(v);
+            ChangeValue(name, value);
+        });
+    }
+
+    return control;
+}
+
+QWidget* UniformPanel::CreateColorControl(const ShaderUniform& uniform)
+{
+    const auto name = uniform.name;
+    const bool alpha = uniform.type == ShaderUniform::TYPE::VEC4;
+
+    auto* button = new QPushButton();
+    button->setFixedHeight(22);
+    ApplyButtonColor(button, values[name]);
+
+    connect(button, &QPushButton::clicked, this, [this, name, alpha, button]() {
+        const auto initial = values[name];
+
+        auto* dialog = new QColorDialog(QColor::fromRgbF(initial.r, initial.g, initial.b, alpha ? initial.a : 1.0f), button);
+        dialog->setAttribute(Qt::WA_DeleteOnClose);
+        dialog->setOption(QColorDialog::ShowAlphaChannel, alpha);
+
+        // Colors are previewed while picking and restored on cancel.
+        connect(dialog, &QColorDialog::currentColorChanged, this, [this, name, button](const QColor& color) {
+            const auto value = glm::vec4(color.redF(), color.greenF(), color.blueF(), color.alphaF());
+            ApplyButtonColor(button, value);
+            ChangeValue(name, value);
+        });
+
+        connect(dialog, &QColorDialog::rejected, this, [this, name, button, initial]() {
+            ApplyButtonColor(button, initial);
+            ChangeValue(name, initial);
+        });
+
+        dialog->open();
+    });
+
+    return button;
+}
+
+QWidget* UniformPanel::CreateIntControl(const ShaderUniform& uniform)
+{
+    const auto name = uniform.name;
+
+    auto* spinBox = new QSpinBox();
+    spinBox->setRange(-static_cast<int>(SPINBOX_RANGE), static_cast<int>(SPINBOX_RANGE));
+    spinBox->setValue(static_cast<int>(values[name].x));
+
+    connect(spinBox, &QSpinBox::valueChanged, this, [this, name](int v) {
+        ChangeValue(name, glm::vec4(static_cast<float>(v), 0.0f, 0.0f, 0.0f));
+    });
+
+    return spinBox;
+}
+
+QWidget* UniformPanel::CreateBoolControl(const ShaderUniform& uniform)
+{
+    const auto name = uniform.name;
+
+    auto* checkBox = new QCheckBox();
+    checkBox->setChecked(values[name].x != 0.0f);
+
+    connect(checkBox, &QCheckBox::toggled, this, [this, name](bool checked) {
+        ChangeValue(name, glm::vec4(checked ? 1.0f : 0.0f, 0.0f, 0.0f, 0.0f));
+    });
+
+    return checkBox;
+}
+
+void UniformPanel::ChangeValue(const QString& name, const glm::vec4& value)
+{
+    values[name] = value;
+    emit NotifyUniformChanged(name, value);
+}
+
+void UniformPanel::ApplyButtonColor(QPushButton* button, const glm::vec4& value)
+{
+    const auto color = QColor::fromRgbF(
+            glm::clamp(value.r, 0.0f, 1.0f),
+            glm::clamp(value.g, 0.0f, 1.0f),
+            glm::clamp(value.b, 0.0f, 1.0f)
+    );
+
+    button->setStyleSheet(QString("QPushButton { border: 1px solid #233151; border-radius: 2px; background: %1; }")
+                                  .arg(color.name()));
+}
@@ -0,0 +1,98 @@
+/**
+ * UniformPanel Class
+ *
+ * Generates controls for the reflected user uniforms, changed
+ * values are applied by the renderer without recompiling.
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHADERIDE_GUI_WIDGETS_UNIFORMPANEL_HPP
+#define SHADERIDE_GUI_WIDGETS_UNIFORMPANEL_HPP
+
+#include <unordered_map>
+#include <QWidget>
+#include <QLabel>
+#include <QScrollArea>
+#include <QVBoxLayout>
+#include <QFormLayout>
+#include <QPushButton>
+#include <QMap>
+#include <glm/glm.hpp>
+#include "src/GL/UniformReflection.hpp"
+
+using namespace ShaderIDE::GL;
+
+namespace ShaderIDE::GUI {
+
+    class UniformPanel : public QWidget
+    {
+        Q_OBJECT
+
+        static constexpr int SLIDER_STEPS = 1000;
+        static constexpr double SPINBOX_RANGE = 100000.0;
+
+    public:
+        explicit UniformPanel(QWidget* parent = nullptr);
+        ~UniformPanel() override;
+
+        // Controls are only rebuilt, if names or types changed.
+        void SetUniforms(const ShaderUniforms& newUniforms,
+                         const std::unordered_map<QString, glm::vec4>& storedValues);
+
+        void ClearUniforms();
+
+    signals:
+        void NotifyUniformChanged(const QString& name, const glm::vec4& value);
+
+    protected:
+        void paintEvent(QPaintEvent* event) override;
+
+    private:
+        QVBoxLayout* mainLayout{ nullptr };
+        QLabel* titleLabel{ nullptr };
+        QLabel* emptyLabel{ nullptr };
+        QWidget* scrollWidget{ nullptr };
+        QFormLayout* formLayout{ nullptr };
+        QScrollArea* scrollArea{ nullptr };
+
+        ShaderUniforms uniforms;
+        QMap<QString, glm::vec4> values;
+
+        void InitLayout();
+
+        void AddUniformRow(const ShaderUniform& uniform);
+        QWidget* CreateFloatControl(const ShaderUniform& uniform);
+        QWidget* CreateVectorControl(const ShaderUniform& uniform);
+        QWidget* CreateColorControl(const ShaderUniform& uniform);
+        QWidget* CreateIntControl(const ShaderUniform& uniform);
+        QWidget* CreateBoolControl(const ShaderUniform& uniform);
+
+        void ChangeValue(const QString& name, const glm::vec4& value);
+        static void ApplyButtonColor(QPushButton* button, const glm::vec4& value);
+    };
+}
+
+#endif // SHADERIDE_GUI_WIDGETS_UNIFORMPANEL_HPP
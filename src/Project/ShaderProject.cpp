@@ -28,10 +28,13 @@
 
 #include <utility>
 #include <fstream>
+#include <algorithm>
 #include <QJsonObject>
 #include <QJsonDocument>
+#include <QJsonArray>
 #include "ShaderProject.hpp"
 #include "ProjectException.hpp"
+#include "src/GL/TextureSlots.hpp"
 
 using namespace ShaderIDE::Project;
 
@@ -67,6 +70,35 @@ ShaderProject* ShaderProject::Load(const QString& path)
         shaderProject->SetFragmentShaderSource(project.find("fsSource")->toString());
     }
 
+    // CS Source
+    if (project.find("csSource") != project.end()) {
+        shaderProject->SetComputeShaderSource(project.find("csSource")->toString());
+    }
+
+    // Compute (Throws GeneralException for invalid bindings)
+    if (project.find("compute") != project.end())
+    {
+        const auto co = project.find("compute")->toObject();
+        const auto groups = co.value("groups").toArray();
+        auto compute = shaderProject->Compute();
+
+        compute.enabled = co.value("enabled").toBool(compute.enabled);
+        compute.everyFrame = co.value("everyFrame").toBool(compute.everyFrame);
+
+        if (groups.size() == 3)
+        {
+            compute.groupsX = groups.at(0).toInt(compute.groupsX);
+            compute.groupsY = groups.at(1).toInt(compute.groupsY);
+            compute.groupsZ = groups.at(2).toInt(compute.groupsZ);
+        }
+
+        if (co.contains("bindings")) {
+            compute.bindings = GL::ComputeBindings::Parse(co.value("bindings").toString());
+        }
+
+        shaderProject->SetCompute(compute);
+    }
+
     // Mesh Name
     if (project.find("meshName") != project.end()) {
         shaderProject->SetMeshName(project.find("meshName")->toString());
@@ -82,6 +114,48 @@ ShaderProject* ShaderProject::Load(const QString& path)
         }
     }
 
+    // Streamed Texture Paths
+    if (project.find("texturePaths") != project.end())
+    {
+        auto tp = project.find("texturePaths")->toObject();
+
+        for (auto it = tp.begin(); it != tp.end(); ++it) {
+            shaderProject->SetTexturePath(it.key(), it.value().toString());
+        }
+    }
+
+    // Texture Slots (Projects without slot count keep all of their textures)
+    if (project.find("textureSlots") != project.end()) {
+        shaderProject->SetTextureSlots(project.find("textureSlots")->toInt(GLSL_TEXTURE_SLOTS_DEFAULT));
+
+    } else {
+        auto slots = GLSL_TEXTURE_SLOTS_DEFAULT;
+
+        for (const auto& it : shaderProject->TextureData()) {
+            slots = std::max(slots, GL::TextureSlots::Index(it.first) + 1);
+        }
+
+        shaderProject->SetTextureSlots(slots);
+    }
+
+    // Uniform Values
+    if (project.find("uniformValues") != project.end())
+    {
+        auto uv = project.find("uniformValues")->toObject();
+
+        for (auto it = uv.begin(); it != uv.end(); ++it)
+        {
+            const auto values = it.value().toArray();
+            glm::vec4 value(0.0f);
+
+            for (int i = 0; i < std::min(static_cast<int>(values.size()), 4); i++) {
+                value[i] = static_cast<float>(values.at(i).toDouble());
+            }
+
+            shaderProject->SetUniformValue(it.key(), value);
+        }
+    }
+
     // Realtime
     if (project.find("realtime") != project.end()) {
         shaderProject->SetRealtime(project.find("realtime")->toBool());
@@ -112,7 +186,9 @@ ShaderProject* ShaderProject::Load(const QString& path)
 
 ShaderProject::ShaderProject(QString path)
         : path(std::move(path))
-{}
+{
+    compute.bindings = GL::ComputeBindings::Parse(GLSL_DEFAULT_COMPUTE_BINDINGS);
+}
 
 QString ShaderProject::Version()
 {
@@ -134,6 +210,16 @@ QString ShaderProject::FragmentShaderSource()
     return fsSource;
 }
 
+QString ShaderProject::ComputeShaderSource()
+{
+    return csSource;
+}
+
+ShaderIDE::GL::ComputeSettings ShaderProject::Compute()
+{
+    return compute;
+}
+
 QString ShaderProject::MeshName()
 {
     return meshName;
@@ -144,6 +230,21 @@ std::unordered_map<QString, QString> ShaderProject::TextureData()
     return textureData;
 }
 
+std::unordered_map<QString, QString> ShaderProject::TexturePaths()
+{
+    return texturePaths;
+}
+
+int ShaderProject::TextureSlots() const
+{
+    return textureSlots;
+}
+
+std::unordered_map<QString, glm::vec4> ShaderProject::UniformValues()
+{
+    return uniformValues;
+}
+
 bool ShaderProject::Realtime() const
 {
     return realtime;
@@ -204,6 +305,18 @@ void ShaderProject::SetFragmentShaderSource(const QString& newFSSource)
     MarkUnsaved();
 }
 
+void ShaderProject::SetComputeShaderSource(const QString& newCSSource)
+{
+    csSource = newCSSource;
+    MarkUnsaved();
+}
+
+void ShaderProject::SetCompute(const GL::ComputeSettings& newCompute)
+{
+    compute = newCompute;
+    MarkUnsaved();
+}
+
 void ShaderProject::SetMeshName(const QString& newMeshName)
 {
     meshName = newMeshName;
@@ -237,6 +350,15 @@ void ShaderProject::SetCameraPosition(const glm::vec3& newCameraPosition)
 void ShaderProject::SetTextureData(const QString& name, const QString& data)
 {
     textureData[name] = data;
+    texturePaths.erase(name);
+    MarkUnsaved();
+}
+
+void ShaderProject::SetTexturePath(const QString& name, const QString& texturePath)
+{
+    // Images too large to embed are read from their file.
+    texturePaths[name] = texturePath;
+    textureData.erase(name);
     MarkUnsaved();
 }
 
@@ -246,6 +368,46 @@ void ShaderProject::ClearTextureData(const QString& name)
         textureData[name] = "";
     }
 
+    texturePaths.erase(name);
+    MarkUnsaved();
+}
+
+void ShaderProject::SetTextureSlots(int newTextureSlots)
+{
+    textureSlots = GL::TextureSlots::ClampCount(newTextureSlots);
+
+    for (auto it = textureData.begin(); it != textureData.end();)
+    {
+        if (GL::TextureSlots::Index(it->first) >= textureSlots) {
+            it = textureData.erase(it);
+
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto it = texturePaths.begin(); it != texturePaths.end();)
+    {
+        if (GL::TextureSlots::Index(it->first) >= textureSlots) {
+            it = texturePaths.erase(it);
+
+        } else {
+            ++it;
+        }
+    }
+
+    MarkUnsaved();
+}
+
+void ShaderProject::SetUniformValue(const QString& name, const glm::vec4& value)
+{
+    uniformValues[name] = value;
+    MarkUnsaved();
+}
+
+void ShaderProject::ClearUniformValues()
+{
+    uniformValues.clear();
     MarkUnsaved();
 }
 
@@ -265,8 +427,13 @@ void ShaderProject::Save()
     project["file_version"] = SHADERIDE_VERSION;
     project["vsSource"] = vsSource;
     project["fsSource"] = fsSource;
+    project["csSource"] = csSource;
+    project["compute"] = MakeJsonObjectFromCompute();
     project["meshName"] = meshName;
     project["textureData"] = MakeJsonObjectFromTextureData();
+    project["texturePaths"] = MakeJsonObjectFromTexturePaths();
+    project["textureSlots"] = textureSlots;
+    project["uniformValues"] = MakeJsonObjectFromUniformValues();
     project["realtime"] = realtime;
     project["plane2D"] = plane2D;
     project["modelRotation"] = modelRotation.ToJsonArray();
@@ -332,6 +499,38 @@ QJsonObject ShaderProject::MakeJsonObjectFromTextureData()
     return jsonArray;
 }
 
+QJsonObject ShaderProject::MakeJsonObjectFromTexturePaths()
+{
+    QJsonObject jsonObject;
+
+    for (auto& it : texturePaths) {
+        jsonObject[it.first] = it.second;
+    }
+
+    return jsonObject;
+}
+
+QJsonObject ShaderProject::MakeJsonObjectFromUniformValues()
+{
+    QJsonObject jsonObject;
+
+    for (auto& it : uniformValues) {
+        jsonObject[it.first] = QJsonArray({ it.second.x, it.second.y, it.second.z, it.second.w });
+    }
+
+    return jsonObject;
+}
+
+QJsonObject ShaderProject::MakeJsonObjectFromCompute()
+{
+    QJsonObject jsonObject;
+    jsonObject["enabled"] = compute.enabled;
+    jsonObject["everyFrame"] = compute.everyFrame;
+    jsonObject["groups"] = QJsonArray({ compute.groupsX, compute.groupsY, compute.groupsZ });
+    jsonObject["bindings"] = GL::ComputeBindings::Format(compute.bindings);
+    return jsonObject;
+}
+
 size_t ShaderProject::LastSlashPos()
 {
     const auto npos = std::string::npos;
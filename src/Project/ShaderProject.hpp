@@ -35,6 +35,7 @@
 #include "SerializableVector3.hpp"
 #include "src/version.hpp"
 #include "src/GL/GLDefaults.hpp"
+#include "src/GL/ComputeBindings.hpp"
 
 namespace ShaderIDE::GUI {
     class MainWindow;
@@ -56,8 +57,13 @@ namespace ShaderIDE::Project {
         QString Path();
         QString VertexShaderSource();
         QString FragmentShaderSource();
+        QString ComputeShaderSource();
+        GL::ComputeSettings Compute();
         QString MeshName();
         std::unordered_map<QString, QString> TextureData();
+        std::unordered_map<QString, QString> TexturePaths(); // Streamed textures
+        int TextureSlots() const;
+        std::unordered_map<QString, glm::vec4> UniformValues();
         bool Realtime() const;
         bool Plane2D() const;
         glm::vec3 ModelRotation();
@@ -71,6 +77,8 @@ namespace ShaderIDE::Project {
         void SetPath(const QString& newPath);
         void SetVertexShaderSource(const QString& newVSSource);
         void SetFragmentShaderSource(const QString& newFSSource);
+        void SetComputeShaderSource(const QString& newCSSource);
+        void SetCompute(const GL::ComputeSettings& newCompute);
         void SetMeshName(const QString& newMeshName);
         void SetRealtime(bool newRealtime);
         void SetPlane2D(bool newPlane2D);
@@ -78,7 +86,12 @@ namespace ShaderIDE::Project {
         void SetCameraPosition(const glm::vec3& newCameraPosition);
 
         void SetTextureData(const QString& name, const QString& data);
-        void ClearTextureData(const QString& name);
+        void SetTexturePath(const QString& name, const QString& texturePath); // Replaces the data
+        void ClearTextureData(const QString& name); // And the path
+        void SetTextureSlots(int newTextureSlots); // Data and paths of removed slots are dropped
+
+        void SetUniformValue(const QString& name, const glm::vec4& value);
+        void ClearUniformValues();
 
         void Save();
 
@@ -97,14 +110,22 @@ namespace ShaderIDE::Project {
         QString path{ "" };
         QString vsSource{ "" };
         QString fsSource{ "" };
+        QString csSource{ GLSL_DEFAULT_CS_SOURCE };
+        GL::ComputeSettings compute;
         QString meshName{ "" };
         std::unordered_map<QString, QString> textureData;
+        std::unordered_map<QString, QString> texturePaths;
+        int textureSlots{ GLSL_TEXTURE_SLOTS_DEFAULT };
+        std::unordered_map<QString, glm::vec4> uniformValues;
         bool realtime{ false };
         bool plane2D{ false };
         SerializableVector3 modelRotation{ OPENGLWIDGET_DEFAULT_MODEL_ROTATION };
         SerializableVector3 cameraPosition{ OPENGLWIDGET_DEFAULT_CAMERA_POSITION };
 
         QJsonObject MakeJsonObjectFromTextureData();
+        QJsonObject MakeJsonObjectFromTexturePaths();
+        QJsonObject MakeJsonObjectFromUniformValues();
+        QJsonObject MakeJsonObjectFromCompute();
 
         size_t LastSlashPos();
 
@@ -0,0 +1,124 @@
+/**
+ * Async Image Decoder Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE AsyncImageDecoderTest
+#include <boost/test/unit_test.hpp>
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include "src/GUI/AsyncImageDecoder.hpp"
+
+using namespace ShaderIDE::GUI;
+
+static QImage MakeTestImage()
+{
+    // Red top row, blue bottom row.
+    QImage image(1024, 512, QImage::Format_RGB32);
+    image.fill(Qt::blue);
+
+    for (int x = 0; x < image.width(); x++) {
+        image.setPixel(x, 0, qRgb(255, 0, 0));
+    }
+
+    return image;
+}
+
+BOOST_AUTO_TEST_SUITE(AsyncImageDecoderTestSuite)
+
+BOOST_AUTO_TEST_CASE(DecodeTestCase)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    BOOST_REQUIRE(MakeTestImage().save(&buffer, "PNG"));
+
+    ImageRequest request;
+    request.name = "texture0";
+    request.data = data;
+
+    const auto result = AsyncImageDecoder::Decode(request);
+    BOOST_REQUIRE(result.error.isEmpty());
+    BOOST_CHECK(result.base64.isEmpty());
+
+    // GL rows start at the bottom.
+    BOOST_CHECK(result.upload.format() == QImage::Format_RGBA8888);
+    BOOST_CHECK(result.upload.pixelColor(0, result.upload.height() - 1) == QColor(255, 0, 0));
+    BOOST_CHECK(result.upload.pixelColor(0, 0) == QColor(0, 0, 255));
+
+    BOOST_CHECK_EQUAL(result.thumbnail.width(), AsyncImageDecoder::THUMBNAIL_SIZE);
+    BOOST_CHECK_EQUAL(result.thumbnail.height(), AsyncImageDecoder::THUMBNAIL_SIZE / 2);
+
+    request.data.clear();
+    request.path = "does-not-exist.png";
+    BOOST_CHECK(!AsyncImageDecoder::Decode(request).error.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(SupersededRequestTestCase)
+{
+    int argc = 1;
+    char name[] = "AsyncImageDecoderTest";
+    char* argv[] = { name, nullptr };
+    QGuiApplication app(argc, argv);
+
+    AsyncImageDecoder decoder;
+    QList<DecodedImage> results;
+
+    QObject::connect(&decoder, &AsyncImageDecoder::NotifyImageDecoded, [&results](const DecodedImage& result) {
+        results << result;
+    });
+
+    // Only the latest request of a slot is reported.
+    QImage small(16, 16, QImage::Format_RGB32);
+    small.fill(Qt::green);
+
+    decoder.DecodeImage("texture0", MakeTestImage());
+    decoder.DecodeImage("texture0", small);
+    decoder.DecodeImage("texture1", small);
+    decoder.DecodeImage("texture2", small);
+    decoder.Cancel("texture2");
+
+    QElapsedTimer timer;
+    timer.start();
+
+    while (results.size() < 2 && timer.elapsed() < 5000) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    }
+
+    // Cancelled and superseded results may arrive late.
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+
+    BOOST_REQUIRE_EQUAL(results.size(), 2);
+
+    for (const auto& result : results)
+    {
+        BOOST_CHECK(result.name != "texture2");
+        BOOST_CHECK(result.image.size() == QSize(16, 16));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,189 @@
+/**
+ * CompressedImage Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE CompressedImageTest
+#include <boost/test/unit_test.hpp>
+#include <QtEndian>
+#include "src/GL/CompressedImage.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+namespace {
+
+    void Append32(QByteArray& data, quint32 value)
+    {
+        char bytes[4];
+        qToLittleEndian(value, bytes);
+        data.append(bytes, 4);
+    }
+
+    void Append64(QByteArray& data, quint64 value)
+    {
+        char bytes[8];
+        qToLittleEndian(value, bytes);
+        data.append(bytes, 8);
+    }
+
+    QByteArray ColorBlock(quint16 color0, quint16 color1, quint32 indices)
+    {
+        QByteArray block;
+        char bytes[2];
+        qToLittleEndian(color0, bytes);
+        block.append(bytes, 2);
+        qToLittleEndian(color1, bytes);
+        block.append(bytes, 2);
+        Append32(block, indices);
+        return block;
+    }
+
+    QByteArray ChannelBlock(uchar value0, uchar value1, quint64 index)
+    {
+        QByteArray block;
+        block.append(static_cast<char>(value0));
+        block.append(static_cast<char>(value1));
+        quint64 indices = 0;
+
+        for (int i = 0; i < 16; i++) {
+            indices |= index << (3 * i);
+        }
+
+        for (int i = 0; i < 6; i++) {
+            block.append(static_cast<char>((indices >> (8 * i)) & 0xFF));
+        }
+
+        return block;
+    }
+
+    QByteArray DDSHeader(int width, int height, int levels, const char* fourCC)
+    {
+        QByteArray data("DDS ");
+        Append32(data, 124);
+        Append32(data, 0x000A1007); // Caps, height, width, pixel format, mipmap count
+        Append32(data, height);
+        Append32(data, width);
+        Append32(data, 0);
+        Append32(data, 0);
+        Append32(data, levels);
+        data.append(QByteArray(44, '\0'));
+        Append32(data, 32);
+        Append32(data, 0x4); // FourCC
+        data.append(fourCC, 4);
+        data.append(QByteArray(40, '\0')); // Masks and caps
+        return data;
+    }
+
+    QByteArray KTX2Header(quint32 vkFormat, int width, int height, quint32 supercompression)
+    {
+        const char identifier[] = { '\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n' };
+        QByteArray data(identifier, 12);
+        Append32(data, vkFormat);
+        Append32(data, 1);
+        Append32(data, width);
+        Append32(data, height);
+        Append32(data, 0);
+        Append32(data, 0);
+        Append32(data, 1);
+        Append32(data, 1);
+        Append32(data, supercompression);
+        data.append(QByteArray(32, '\0')); // Descriptor, key/value and global data
+        return data;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(CompressedImageTestSuite)
+
+BOOST_AUTO_TEST_CASE(DDSTestCase)
+{
+    // BC1, 8x4 with two blocks and the 4x2, 2x1 and 1x1 levels.
+    auto data = DDSHeader(8, 4, 4, "DXT1");
+    data.append(ColorBlock(0xF800, 0x001F, 0x00000000)); // Red
+    data.append(ColorBlock(0xF800, 0x001F, 0x55555555)); // Blue
+
+    for (int level = 1; level < 4; level++) {
+        data.append(ColorBlock(0x07E0, 0x0000, 0x00000000));
+    }
+
+    BOOST_REQUIRE(CompressedImage::IsCompressed(data));
+    const auto image = CompressedImage::FromData(data);
+
+    BOOST_CHECK(image.Format() == CompressedImage::FORMAT::BC1);
+    BOOST_CHECK(image.Size() == QSize(8, 4));
+    BOOST_REQUIRE_EQUAL(image.Levels().size(), 4);
+    BOOST_CHECK(image.Levels().at(2).size == QSize(2, 1));
+    BOOST_CHECK_EQUAL(image.Bytes(), 5 * 8);
+    BOOST_CHECK_EQUAL(image.InternalFormat(), static_cast<GLenum>(0x83F1));
+    BOOST_CHECK_EQUAL(image.LevelForExtent(4), 1);
+
+    const auto decoded = image.Decode(0);
+    BOOST_REQUIRE(decoded.size() == QSize(8, 4));
+    BOOST_CHECK(decoded.pixel(0, 0) == qRgba(255, 0, 0, 255));
+    BOOST_CHECK(decoded.pixel(7, 3) == qRgba(0, 0, 255, 255));
+
+    // Partial blocks of small levels.
+    BOOST_CHECK(image.Decode(3).pixel(0, 0) == qRgba(0, 255, 0, 255));
+
+    // Missing levels
+    data.chop(8);
+    BOOST_CHECK_THROW(CompressedImage::FromData(data), GeneralException);
+}
+
+BOOST_AUTO_TEST_CASE(KTX2TestCase)
+{
+    // BC5, 4x4 with one level, red and green are interpolated.
+    auto data = KTX2Header(141, 4, 4, 0);
+    Append64(data, data.size() + 24);
+    Append64(data, 16);
+    Append64(data, 16);
+    data.append(ChannelBlock(200, 100, 2));
+    data.append(ChannelBlock(100, 200, 7));
+
+    const auto image = CompressedImage::FromData(data);
+    BOOST_CHECK(image.Format() == CompressedImage::FORMAT::BC5);
+    BOOST_REQUIRE_EQUAL(image.Levels().size(), 1);
+
+    const auto decoded = image.Decode(0);
+    BOOST_CHECK(decoded.pixel(1, 2) == qRgba((6 * 200 + 100) / 7, 255, 0, 255));
+
+    // BC7 blocks are left to the driver.
+    auto bc7 = KTX2Header(145, 4, 4, 0);
+    Append64(bc7, bc7.size() + 24);
+    Append64(bc7, 16);
+    Append64(bc7, 16);
+    bc7.append(QByteArray(16, '\0'));
+
+    BOOST_CHECK(!CompressedImage::FromData(bc7).Decodable());
+    BOOST_CHECK(CompressedImage::FromData(bc7).Decode(0).isNull());
+
+    // Basis Universal
+    BOOST_CHECK_THROW(CompressedImage::FromData(KTX2Header(0, 4, 4, 1)), GeneralException);
+    BOOST_CHECK(!CompressedImage::IsCompressed(QByteArray("\x89PNG\r\n")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+/**
+ * Compute Bindings Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+ */
+
+#define BOOST_TEST_MODULE ComputeBindingsTest
+#include <boost/test/unit_test.hpp>
+#include "src/Core/GeneralException.hpp"
+#include "src/GL/ComputeBindings.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(ComputeBindingsTestSuite)
+
+BOOST_AUTO_TEST_CASE(ComputeBindingsTestCase)
+{
+    // Bindings
+    const auto bindings = ComputeBindings::Parse("buffer 1 4096\n\n// Output\nimage 0 512 x 256\nimage 2 64x64\n");
+    BOOST_REQUIRE_EQUAL(bindings.size(), 3);
+    BOOST_CHECK(bindings.at(0).type == ComputeBinding::TYPE::BUFFER);
+    BOOST_CHECK_EQUAL(bindings.at(0).binding, 1);
+    BOOST_CHECK_EQUAL(bindings.at(0).size, 4096);
+    BOOST_CHECK(bindings.at(1).type == ComputeBinding::TYPE::IMAGE);
+    BOOST_CHECK_EQUAL(bindings.at(1).width, 512);
+    BOOST_CHECK_EQUAL(bindings.at(1).height, 256);
+
+    // The first image is the output, buffers are skipped.
+    BOOST_CHECK_EQUAL(ComputeBindings::OutputIndex(bindings), 1);
+    BOOST_CHECK_EQUAL(ComputeBindings::OutputIndex(ComputeBindings::Parse("buffer 0 16")), -1);
+
+    // Buffers and images have separate binding points.
+    BOOST_CHECK_EQUAL(ComputeBindings::Parse("buffer 0 16\nimage 0 8x8").size(), 2);
+
+    BOOST_CHECK_THROW(ComputeBindings::Parse("image 0 8x8\nimage 0 16x16"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("image 0 8"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("texture 0 8x8"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("buffer 0 0"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("buffer 0 99999999999"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("image 0 8193x8"), GeneralException);
+    BOOST_CHECK_THROW(ComputeBindings::Parse("image 8 8x8"), GeneralException);
+
+    // Round Trip
+    BOOST_CHECK(ComputeBindings::Format(bindings) == "buffer 1 4096\nimage 0 512x256\nimage 2 64x64");
+    BOOST_CHECK(ComputeBindings::Parse(ComputeBindings::Format(bindings)) == bindings);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * GLSL Diagnostics Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE GLSLDiagnosticsTest
+#include <boost/test/unit_test.hpp>
+#include "src/GL/GLSLDiagnostics.hpp"
+#include "src/GL/GLSLCompileError.hpp"
+
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(GLSLDiagnosticsTestSuite)
+
+BOOST_AUTO_TEST_CASE(GLSLDiagnosticsTestCase)
+{
+    using Severity = GLSLDiagnostic::SEVERITY;
+
+    // NVIDIA
+    auto diagnostics = GLSLDiagnostics::Parse(
+            "0(12) : error C0000: syntax error, unexpected '}'\n"
+            "0(14) : warning C7022: unrecognized profile specifier\n"
+            "2(3) : error C1008: undefined variable \"PI\"\n");
+
+    BOOST_REQUIRE_EQUAL(diagnostics.size(), 3);
+    BOOST_CHECK(diagnostics.at(0).severity == Severity::FAILURE);
+    BOOST_CHECK_EQUAL(diagnostics.at(0).line, 12);
+    BOOST_CHECK(diagnostics.at(0).code == "C0000");
+    BOOST_CHECK(diagnostics.at(1).severity == Severity::WARNING);
+    BOOST_CHECK_EQUAL(diagnostics.at(2).sourceIndex, 2);
+    BOOST_CHECK(diagnostics.at(2).message == "undefined variable \"PI\"");
+
+    // Mesa
+    diagnostics = GLSLDiagnostics::Parse(
+            "0:12(3): error: syntax error, unexpected '}'\n"
+            "0:20(15): warning: `color' used uninitialized\n");
+
+    BOOST_REQUIRE_EQUAL(diagnostics.size(), 2);
+    BOOST_CHECK_EQUAL(diagnostics.at(0).line, 12);
+    BOOST_CHECK_EQUAL(diagnostics.at(0).column, 3);
+    BOOST_CHECK(diagnostics.at(1).severity == Severity::WARNING);
+    BOOST_CHECK_EQUAL(diagnostics.at(1).column, 15);
+
+    // AMD
+    diagnostics = GLSLDiagnostics::Parse("ERROR: 0:7: 'vec5' : undeclared identifier\nERROR: 1 compilation errors.");
+    BOOST_REQUIRE_EQUAL(diagnostics.size(), 1);
+    BOOST_CHECK_EQUAL(diagnostics.at(0).line, 7);
+
+    // Unknown
+    diagnostics = GLSLDiagnostics::Parse("Vertex info\n-----------\nlink failed");
+    BOOST_REQUIRE_EQUAL(diagnostics.size(), 1);
+    BOOST_CHECK_EQUAL(diagnostics.at(0).line, 0);
+
+    // The first error is reported, not the first warning.
+    GLSLCompileError error(ShaderType::FragmentShader, "0:4(1): warning: unused\n0:9(2): error: bad\n");
+    BOOST_CHECK_EQUAL(error.Line(), 9);
+    BOOST_CHECK_EQUAL(error.ErrorCount(), 1);
+    BOOST_CHECK_EQUAL(error.WarningCount(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+/**
+ * GLSLFingerprint Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE GLSLFingerprintTest
+#include <boost/test/unit_test.hpp>
+#include "src/GL/GLSLFingerprint.hpp"
+
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(GLSLFingerprintTestSuite)
+
+BOOST_AUTO_TEST_CASE(GLSLFingerprintTestCase)
+{
+    const QString SOURCE = "#version 450 core\nout vec4 color;\nvoid main() { color = vec4(1.0); }";
+    const auto fingerprint = GLSLFingerprint::Compute(SOURCE);
+
+    // Comment-only edits collide.
+    BOOST_CHECK_EQUAL(GLSLFingerprint::Compute(
+            "#version 450 core\n// Output\nout vec4 color;\nvoid main() { /* white */ color = vec4(1.0); }"),
+            fingerprint);
+
+    // Whitespace-only edits collide.
+    BOOST_CHECK_EQUAL(GLSLFingerprint::Compute(
+            "#version   450 core\n\n  out vec4   color;\r\nvoid main()\n{\n    color = vec4( 1.0 );\n}\n"),
+            fingerprint);
+
+    // Newlines terminate directives and still matter.
+    BOOST_CHECK_NE(GLSLFingerprint::Compute("#define A 1\nfloat x = A;"),
+                   GLSLFingerprint::Compute("#define A 1 float x = A;"));
+
+    // Token changes do not collide.
+    BOOST_CHECK_NE(GLSLFingerprint::Compute(
+            "#version 450 core\nout vec4 color;\nvoid main() { color = vec4(0.5); }"),
+            fingerprint);
+
+    // A function-like macro differs from an object-like one with a parenthesized body.
+    BOOST_CHECK_NE(GLSLFingerprint::Compute("#define F(x) x*2\nfloat y = F(1.0);"),
+                   GLSLFingerprint::Compute("#define F (x) x*2\nfloat y = F(1.0);"));
+
+    // Only the macro name is affected, whitespace elsewhere in the directive is not.
+    BOOST_CHECK_EQUAL(GLSLFingerprint::Compute("#define F(x) x*2\nfloat y = F(1.0);"),
+                      GLSLFingerprint::Compute("#  define F(x)  x * 2\nfloat y = F (1.0);"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/**
+ * GLSL Preprocessor Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE GLSLPreprocessorTest
+#include <boost/test/unit_test.hpp>
+#include <QFile>
+#include <QTemporaryDir>
+#include "src/Core/SyntaxErrorException.hpp"
+#include "src/GL/GLSLPreprocessor.hpp"
+#include "src/GL/GLSLCompileError.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+static void WriteFile(const QString& path, const QString& content)
+{
+    QFile file(path);
+    BOOST_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(content.toUtf8());
+}
+
+BOOST_AUTO_TEST_SUITE(GLSLPreprocessorTestSuite)
+
+BOOST_AUTO_TEST_CASE(GLSLPreprocessorTestCase)
+{
+    const QString MAIN_SOURCE = "#version 450 core\n#include \"lighting.glsl\"\nvoid main() {}";
+
+    QTemporaryDir directory;
+    BOOST_REQUIRE(directory.isValid());
+
+    const auto lightingPath = directory.filePath("lighting.glsl");
+    const auto mathPath = directory.filePath("math.glsl");
+    WriteFile(lightingPath, "#include \"math.glsl\"\nfloat Light() { return PI; }");
+    WriteFile(mathPath, "#define PI 3.14159");
+
+    GLSLPreprocessor preprocessor;
+    preprocessor.SetIncludeDirectory(directory.path());
+
+    // Sources without includes are not changed.
+    BOOST_CHECK(preprocessor.Expand("void main() {}") == "void main() {}");
+
+    // Expansion with #line directives (source string numbers of the files).
+    const auto expanded = preprocessor.Expand(MAIN_SOURCE);
+    const auto lines = expanded.split('\n');
+
+    BOOST_REQUIRE_EQUAL(lines.size(), 8);
+    BOOST_CHECK(lines.at(0) == "#version 450 core");
+    BOOST_CHECK(lines.at(1) == "#line 1 1");
+    BOOST_CHECK(lines.at(2) == "#line 1 2");
+    BOOST_CHECK(lines.at(3) == "#define PI 3.14159");
+    BOOST_CHECK(lines.at(4) == "#line 2 1");
+    BOOST_CHECK(lines.at(5) == "float Light() { return PI; }");
+    BOOST_CHECK(lines.at(6) == "#line 3 0");
+    BOOST_CHECK(lines.at(7) == "void main() {}");
+    BOOST_CHECK_EQUAL(preprocessor.ExpandedFiles(), 2);
+    BOOST_CHECK_EQUAL(preprocessor.Dependencies().size(), 2);
+    BOOST_CHECK(preprocessor.Dependents(mathPath).contains(lightingPath));
+
+    // Unchanged files are taken from the cache.
+    BOOST_CHECK(preprocessor.Expand(MAIN_SOURCE) == expanded);
+    BOOST_CHECK_EQUAL(preprocessor.ExpandedFiles(), 0);
+    BOOST_CHECK_EQUAL(preprocessor.CachedFiles(), 2);
+
+    // A changed dependency is expanded again with its dependents.
+    WriteFile(mathPath, "#define PI 3.14159265359");
+    BOOST_CHECK(preprocessor.Expand(MAIN_SOURCE).contains("3.14159265359"));
+    BOOST_CHECK_EQUAL(preprocessor.ExpandedFiles(), 2);
+
+    // Driver errors are mapped back to the included file.
+    GLSLCompileError error(ShaderType::FragmentShader, "2(1) : error C1008: undefined variable \"PI\"");
+    BOOST_CHECK_EQUAL(error.SourceIndex(), 2);
+    BOOST_CHECK_EQUAL(error.Line(), 1);
+    BOOST_CHECK(preprocessor.FileName(static_cast<int>(error.SourceIndex())) == mathPath);
+
+    // Missing files and cycles are reported at the #include line.
+    BOOST_CHECK_THROW(preprocessor.Expand("#include \"missing.glsl\""), SyntaxErrorException);
+
+    WriteFile(mathPath, "#include \"lighting.glsl\"");
+    BOOST_CHECK_THROW(preprocessor.Expand(MAIN_SOURCE), SyntaxErrorException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,89 @@
+/**
+ * Hot Literals Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#define BOOST_TEST_MODULE HotLiteralsTest
+#include <boost/test/unit_test.hpp>
+#include "src/GL/HotLiterals.hpp"
+
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(HotLiteralsTestSuite)
+
+BOOST_AUTO_TEST_CASE(HotLiteralsTestCase)
+{
+    const QString source =
+            "#version 450 core\n"
+            "#define SCALE 2.0\n"
+            "const float PI = 3.14159;\n"
+            "out vec4 fragColor;\n"
+            "void main()\n"
+            "{\n"
+            "    // 9.0 is a comment\n"
+            "    const float k = 0.5;\n"
+            "    float lightInt = 1.8f;\n"
+            "    vec4 lightPos = vec4(-0.2f, 3, 1e-2, 2.0lf);\n"
+            "    fragColor = vec4(lightInt * .25);\n"
+            "}";
+
+    // Globals, const declarations, directives, comments, ints and doubles are skipped.
+    const auto literals = HotLiterals::Find(source);
+    BOOST_REQUIRE_EQUAL(literals.size(), 4);
+    BOOST_CHECK_CLOSE(literals.at(0).value, 1.8f, 0.001f);
+    BOOST_CHECK(literals.at(0).suffix);
+    BOOST_CHECK_EQUAL(literals.at(0).decimals, 1);
+    BOOST_CHECK_CLOSE(literals.at(1).value, 0.2f, 0.001f);
+    BOOST_CHECK_CLOSE(literals.at(2).value, 0.01f, 0.001f);
+    BOOST_CHECK_CLOSE(literals.at(3).value, 0.25f, 0.001f);
+    BOOST_CHECK(source.mid(literals.at(0).position, literals.at(0).length) == "1.8f");
+
+    BOOST_CHECK_EQUAL(HotLiterals::IndexAt(literals, literals.at(2).position + 1), 2);
+    BOOST_CHECK_EQUAL(HotLiterals::IndexAt(literals, 0), -1);
+
+    // The declaration follows #version, the next line keeps its number.
+    const auto injected = HotLiterals::Inject(source, literals, "_hotLiteralsFS");
+    const auto lines = injected.split('\n');
+    BOOST_CHECK(lines.at(1) == "uniform float _hotLiteralsFS[4];");
+    BOOST_CHECK(lines.at(2) == "#line 2 0");
+    BOOST_CHECK(injected.contains("float lightInt = _hotLiteralsFS[0];"));
+    BOOST_CHECK(injected.contains("vec4(-_hotLiteralsFS[1], 3, _hotLiteralsFS[2], 2.0lf)"));
+    BOOST_CHECK(injected.contains("#define SCALE 2.0"));
+
+    // Values are baked with the suffix of the source.
+    BOOST_CHECK(HotLiterals::Format(literals.at(0), 2.5f) == "2.5f");
+    BOOST_CHECK(HotLiterals::Format(literals.at(0), 1.2345f) == "1.235f");
+
+    auto edit = HotLiterals::Bake(source, literals.at(1), -0.4f);
+    BOOST_CHECK_EQUAL(edit.position, literals.at(1).position - 1);
+    BOOST_CHECK(edit.text == "+0.4f");
+
+    edit = HotLiterals::Bake(source, literals.at(3), -0.5f);
+    BOOST_CHECK(edit.text == "-0.5");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+/**
+ * Process Runner Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE ProcessRunnerTest
+#include <functional>
+#include <boost/test/unit_test.hpp>
+#include <QMap>
+#include <QElapsedTimer>
+#include <QCoreApplication>
+#include "src/Core/ProcessRunner.hpp"
+
+using namespace ShaderIDE;
+
+static bool ProcessEventsUntil(const std::function<bool()>& condition, qint64 timeout)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!condition() && timer.elapsed() < timeout) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1);
+    }
+
+    return condition();
+}
+
+BOOST_AUTO_TEST_SUITE(ProcessRunnerTestSuite)
+
+BOOST_AUTO_TEST_CASE(ProcessRunnerTestCase)
+{
+    const qint64 TIMEOUT = 10000; // Milliseconds
+    const int SLEEP_TIMEOUT = 200; // Milliseconds
+    const int MAX_CONCURRENT = 2;
+
+    int argc = 1;
+    char name[] = "ProcessRunnerTest";
+    char* argv[] = { name, nullptr };
+    QCoreApplication app(argc, argv);
+
+    ProcessRunner runner(MAX_CONCURRENT);
+    QMap<uint64_t, ProcessResult> results;
+    QStringList errorLines;
+    int maxRunning = 0;
+
+    QObject::connect(&runner, &ProcessRunner::NotifyErrorOutput, &app, [&](uint64_t, const QString& line) {
+        errorLines << line;
+    });
+
+    QObject::connect(&runner, &ProcessRunner::NotifyFinished, &app, [&](uint64_t id, const ProcessResult& result) {
+        results.insert(id, result);
+    });
+
+    // Output, error output and exit code
+    const auto outputID = runner.Run("sh", { "-c", "echo first; echo second; echo failed >&2; exit 3" });
+
+    // Killed after the timeout
+    const auto timeoutID = runner.Run("sh", { "-c", "sleep 5" }, SLEEP_TIMEOUT);
+
+    // Missing executable
+    const auto missingID = runner.Run("shaderide-missing-executable", {});
+
+    // Queued, until a slot is free
+    BOOST_CHECK_EQUAL(runner.Running(), MAX_CONCURRENT);
+    BOOST_CHECK_EQUAL(runner.Queued(), 1);
+
+    BOOST_REQUIRE(ProcessEventsUntil([&]() {
+        maxRunning = qMax(maxRunning, runner.Running());
+        return runner.Idle();
+    }, TIMEOUT));
+
+    BOOST_CHECK_LE(maxRunning, MAX_CONCURRENT);
+    BOOST_REQUIRE_EQUAL(results.size(), 3);
+
+    const auto output = results.value(outputID);
+    BOOST_CHECK(output.started);
+    BOOST_CHECK(!output.timedOut);
+    BOOST_CHECK_EQUAL(output.exitCode, 3);
+    BOOST_CHECK(output.standardOutput == "first\nsecond\n");
+    BOOST_CHECK(output.standardError == "failed\n");
+    BOOST_CHECK(errorLines.contains("failed"));
+
+    const auto timedOut = results.value(timeoutID);
+    BOOST_CHECK(timedOut.started);
+    BOOST_CHECK(timedOut.timedOut);
+    BOOST_CHECK(!timedOut.Succeeded());
+    BOOST_CHECK_LT(timedOut.duration, 5000);
+
+    const auto missing = results.value(missingID);
+    BOOST_CHECK(!missing.started);
+    BOOST_CHECK(!missing.Succeeded());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
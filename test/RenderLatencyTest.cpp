@@ -0,0 +1,260 @@
+/**
+ * Render Latency Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE RenderLatencyTest
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <boost/test/unit_test.hpp>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QKeyEvent>
+#include <QSurfaceFormat>
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include "src/Core/Application.hpp"
+#include "src/Core/GeneralException.hpp"
+#include "src/GL/GLDefaults.hpp"
+#include "src/GL/Renderer.hpp"
+#include "src/GL/Loaders/OBJMeshLoader.hpp"
+#include "src/GUI/Code/CodeEditor.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+using namespace ShaderIDE::GUI;
+
+// Expensive plane shader, each frame takes far longer than a keystroke.
+#define SLOW_FS_SOURCE \
+    "#version 450 core\n" \
+    "\n" \
+    "in vec2 vUV;\n" \
+    "uniform float time;\n" \
+    "uniform float frequency = 1.0;\n" \
+    "out vec4 fragColor;\n" \
+    "\n" \
+    "void main()\n" \
+    "{\n" \
+    "    float value = 0.0;\n" \
+    "\n" \
+    "    for (int i = 0; i < 20000; ++i) {\n" \
+    "        value += sin(vUV.x * float(i) * frequency + time) * cos(vUV.y * float(i));\n" \
+    "    }\n" \
+    "\n" \
+    "    fragColor = vec4(vec3(fract(value)), 1.0);\n" \
+    "}\n"
+
+class PaintWatcher : public QObject
+{
+public:
+    bool painted{ false };
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override
+    {
+        if (event->type() == QEvent::Paint) {
+            painted = true;
+        }
+
+        return QObject::eventFilter(watched, event);
+    }
+};
+
+// QApplication aborts without a display, the platform is checked first.
+static bool OpenGLAvailable(int& argc, char** argv)
+{
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MACOS)
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")
+        && qEnvironmentVariableIsEmpty("DISPLAY")
+        && qEnvironmentVariableIsEmpty("WAYLAND_DISPLAY"))
+    {
+        return false;
+    }
+#endif
+
+    QGuiApplication app(argc, argv);
+
+    QOffscreenSurface surface;
+    surface.create();
+
+    QOpenGLContext context;
+    return context.create() && context.makeCurrent(&surface);
+}
+
+static qint64 Median(std::vector<qint64> values)
+{
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0 : values[values.size() / 2];
+}
+
+static bool ProcessEventsUntil(const std::function<bool()>& condition, qint64 timeout)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    while (!condition() && timer.elapsed() < timeout) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 1);
+    }
+
+    return condition();
+}
+
+BOOST_AUTO_TEST_SUITE(RenderLatencyTestSuite)
+
+BOOST_AUTO_TEST_CASE(KeypressToPaintLatencyTestCase)
+{
+    const int NUM_KEYPRESSES = 20;
+    const qint64 MAX_MEDIAN_LATENCY = 50; // Milliseconds
+    const qint64 TIMEOUT = 5000; // Milliseconds
+
+    QSurfaceFormat format;
+    format.setVersion(4, 5);
+    format.setProfile(QSurfaceFormat::CoreProfile);
+    QSurfaceFormat::setDefaultFormat(format);
+
+    int argc = 1;
+    char name[] = "RenderLatencyTest";
+    char* argv[] = { name, nullptr };
+
+    if (!OpenGLAvailable(argc, argv))
+    {
+        BOOST_TEST_MESSAGE("Skipped, no display or OpenGL context available.");
+        return;
+    }
+
+    Application app(argc, argv);
+
+    Renderer* renderer{ nullptr };
+
+    try
+    {
+        renderer = new Renderer(nullptr);
+
+    } catch (GeneralException& e) {
+        BOOST_TEST_MESSAGE("Skipped, no OpenGL context available: " << e.what());
+        return;
+    }
+
+    // Frames are "presented" instantly on the GUI thread, like the viewport does.
+    std::vector<qint64> frameTimes;
+    QElapsedTimer frameTimer;
+    bool slowProgramLinked = false;
+    bool compileFailed = false;
+
+    QObject::connect(renderer, &Renderer::NotifyFrameReady, &app, [&]() {
+        if (frameTimer.isValid()) {
+            frameTimes.push_back(frameTimer.restart());
+        } else {
+            frameTimer.start();
+        }
+
+        renderer->FramePresented();
+    });
+
+    // Only the slow shader has a user uniform, messages of other
+    // compiles (i.e. the default program) don't count as its result.
+    QObject::connect(renderer, &Renderer::NotifyUniformsReflected, &app, [&](const ShaderUniforms& uniforms) {
+        for (const auto& uniform : uniforms) {
+            slowProgramLinked |= uniform.name == "frequency";
+        }
+    });
+
+    QObject::connect(renderer, &Renderer::NotifyCompileError, &app, [&](const GLSLCompileError&) {
+        compileFailed = true;
+    });
+
+    QThread renderThread;
+    renderer->Start(&renderThread);
+    renderThread.start();
+
+    RenderState state;
+    state.resolution = glm::vec2(512.0f, 512.0f);
+    state.framebufferSize = QSize(512, 512);
+    state.realtime = true;
+    state.plane2D = true;
+
+    auto meshLoader = OBJMeshLoader(":/models/plane.obj");
+    auto mesh = meshLoader.GetMesh();
+
+    renderer->SetPlaneVertices(mesh.ComposedVertices());
+    renderer->SetVertexShaderSource(GLSL_DEFAULT_VS_SOURCE);
+    renderer->SetFragmentShaderSource(SLOW_FS_SOURCE);
+    renderer->CompileShaders();
+    renderer->SetState(state);
+
+    BOOST_REQUIRE(ProcessEventsUntil([&]() { return slowProgramLinked || compileFailed; }, TIMEOUT));
+    BOOST_REQUIRE(!compileFailed);
+
+    // Let a few slow frames pass, so that the render thread is busy.
+    ProcessEventsUntil([&]() { return frameTimes.size() >= 3; }, TIMEOUT);
+
+    CodeEditor editor;
+    editor.resize(640, 480);
+    editor.show();
+
+    PaintWatcher watcher;
+    editor.viewport()->installEventFilter(&watcher);
+    ProcessEventsUntil([&]() { return watcher.painted; }, TIMEOUT);
+
+    std::vector<qint64> latencies;
+
+    for (int i = 0; i < NUM_KEYPRESSES; ++i)
+    {
+        watcher.painted = false;
+
+        QElapsedTimer latencyTimer;
+        latencyTimer.start();
+
+        QCoreApplication::postEvent(&editor, new QKeyEvent(QEvent::KeyPress, Qt::Key_A, Qt::NoModifier, "a"));
+        QCoreApplication::postEvent(&editor, new QKeyEvent(QEvent::KeyRelease, Qt::Key_A, Qt::NoModifier, "a"));
+
+        BOOST_REQUIRE(ProcessEventsUntil([&]() { return watcher.painted; }, TIMEOUT));
+        latencies.push_back(latencyTimer.elapsed());
+    }
+
+    auto medianLatency = Median(latencies);
+    auto medianFrameTime = Median(frameTimes);
+
+    BOOST_TEST_MESSAGE("Median keypress to paint latency: " << medianLatency << " ms, "
+                       << "median frame time: " << medianFrameTime << " ms");
+
+    // Typing must not be bound to the frame time of the shader.
+    BOOST_CHECK_LT(medianLatency, MAX_MEDIAN_LATENCY);
+
+    if (medianFrameTime > MAX_MEDIAN_LATENCY) {
+        BOOST_CHECK_LT(medianLatency, medianFrameTime);
+    }
+
+    renderer->Stop();
+    renderThread.quit();
+    renderThread.wait();
+    delete renderer;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
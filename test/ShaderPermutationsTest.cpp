@@ -0,0 +1,65 @@
+/**
+ * Shader Permutations Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE ShaderPermutationsTest
+#include <boost/test/unit_test.hpp>
+#include "src/Core/GeneralException.hpp"
+#include "src/GL/ShaderPermutations.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(ShaderPermutationsTestSuite)
+
+BOOST_AUTO_TEST_CASE(ShaderPermutationsTestCase)
+{
+    // Axes
+    const auto axes = ShaderPermutations::ParseAxes("USE_SHADOWS={0,1}\n\n// Comment\nQUALITY={0, 1, 2}\n");
+    BOOST_REQUIRE_EQUAL(axes.size(), 2);
+    BOOST_CHECK(axes.at(1).name == "QUALITY");
+    BOOST_CHECK(axes.at(1).values == QStringList({ "0", "1", "2" }));
+
+    BOOST_CHECK_THROW(ShaderPermutations::ParseAxes("USE_SHADOWS=0,1"), GeneralException);
+    BOOST_CHECK_THROW(ShaderPermutations::ParseAxes("A={0}\nA={1}"), GeneralException);
+
+    // Variants
+    const auto permutations = ShaderPermutations::Enumerate(axes);
+    BOOST_REQUIRE_EQUAL(permutations.size(), 6);
+    BOOST_CHECK(ShaderPermutations::Name(permutations.at(0)) == "USE_SHADOWS=0 QUALITY=0");
+    BOOST_CHECK(ShaderPermutations::Name(permutations.at(5)) == "USE_SHADOWS=1 QUALITY=2");
+
+    BOOST_CHECK_THROW(ShaderPermutations::Enumerate(
+            ShaderPermutations::ParseAxes("A={0,1,2,3,4,5,6,7}\nB={0,1,2,3,4,5,6,7}\nC={0,1,2,3,4,5,6,7}")),
+            GeneralException);
+
+    // Defines follow #version, the next line keeps its number.
+    const auto source = ShaderPermutations::ApplyDefines("#version 450 core\nvoid main() {}", permutations.at(5));
+    BOOST_CHECK(source == "#version 450 core\n#define USE_SHADOWS 1\n#define QUALITY 2\n#line 2 0\nvoid main() {}");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
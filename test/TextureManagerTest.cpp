@@ -0,0 +1,252 @@
+/**
+ * Texture Manager Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE TextureManagerTest
+#include <atomic>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QGuiApplication>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QSurfaceFormat>
+#include <QtOpenGL/QOpenGLFunctions_4_5_Core>
+#include "src/GL/TextureManager.hpp"
+#include "src/GL/TextureStreamer.hpp"
+
+using namespace ShaderIDE::GL;
+
+struct GLContextFixture
+{
+    int argc{ 1 };
+    char name[19]{ "TextureManagerTest" };
+    char* argv[2]{ name, nullptr };
+    QGuiApplication app{ argc, argv };
+
+    QOffscreenSurface surface;
+    QOpenGLContext context;
+    QOpenGLFunctions_4_5_Core gl;
+
+    GLContextFixture()
+    {
+        QSurfaceFormat format;
+        format.setVersion(4, 5);
+        format.setProfile(QSurfaceFormat::CoreProfile);
+
+        surface.setFormat(format);
+        surface.create();
+
+        context.setFormat(format);
+        BOOST_REQUIRE(context.create());
+        BOOST_REQUIRE(context.makeCurrent(&surface));
+        BOOST_REQUIRE(gl.initializeOpenGLFunctions());
+    }
+
+    ~GLContextFixture()
+    {
+        context.doneCurrent();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(TextureManagerTestSuite)
+
+BOOST_AUTO_TEST_CASE(StorageBytesTestCase)
+{
+    BOOST_CHECK_EQUAL(TextureManager::StorageBytes(QSize(256, 128), 1, 4), 256 * 128 * 4);
+
+    // Mip levels are at least one pixel wide.
+    BOOST_CHECK_EQUAL(TextureManager::StorageBytes(QSize(4, 1), 3, 4), (4 + 2 + 1) * 4);
+
+    BOOST_CHECK_EQUAL(TextureManager::MipLevels(QSize(1, 1)), 1);
+    BOOST_CHECK_EQUAL(TextureManager::MipLevels(QSize(64, 32)), 7);
+    BOOST_CHECK_EQUAL(TextureManager::MipLevels(QSize(100, 3)), 7);
+}
+
+BOOST_FIXTURE_TEST_CASE(TextureSwapSoakTestCase, GLContextFixture)
+{
+    const int NUM_SWAPS = 5000;
+    const int NUM_SLOTS = 4;
+
+    TextureManager textureManager(NUM_SLOTS);
+    textureManager.Init();
+
+    // Empty slots share the fallback.
+    BOOST_CHECK(textureManager.Empty(0));
+    BOOST_CHECK_NE(textureManager.Texture(0), 0);
+    BOOST_CHECK_EQUAL(textureManager.Texture(0), textureManager.Texture(3));
+    BOOST_CHECK_EQUAL(textureManager.LiveTextures(), 1);
+
+    QImage small(64, 32, QImage::Format_ARGB32);
+    small.fill(Qt::red);
+    QImage large(128, 128, QImage::Format_RGB32);
+    large.fill(Qt::green);
+
+    for (int i = 0; i < NUM_SWAPS; i++)
+    {
+        const auto slot = i % NUM_SLOTS;
+
+        // Slot 0 keeps its size, the storage is reused.
+        if (slot == 0) {
+            textureManager.SetImage(slot, small);
+
+        } else if (slot == 3) {
+            textureManager.Clear(slot);
+
+        } else {
+            textureManager.SetImage(slot, (i / NUM_SLOTS) % 2 == 0 ? small : large);
+        }
+    }
+
+    gl.glFinish();
+    BOOST_CHECK_EQUAL(gl.glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    // Fallback and the slots 0 - 2, the replaced textures are deleted.
+    BOOST_CHECK_EQUAL(textureManager.LiveTextures(), 4);
+    BOOST_CHECK(textureManager.Empty(3));
+    BOOST_CHECK_EQUAL(textureManager.SlotBytes(0), TextureManager::StorageBytes(QSize(64, 32), 7, 4));
+    BOOST_CHECK_EQUAL(textureManager.SlotBytes(3), 0);
+
+    // Slot 0 was allocated once, slots 1 and 2 with each swap.
+    BOOST_CHECK_EQUAL(textureManager.Allocations(), 1 + 1 + 2 * (NUM_SWAPS / NUM_SLOTS));
+
+    BOOST_CHECK_EQUAL(textureManager.TotalBytes(),
+                      4 + textureManager.SlotBytes(0) + textureManager.SlotBytes(1) + textureManager.SlotBytes(2));
+
+    textureManager.Release();
+    BOOST_CHECK_EQUAL(textureManager.LiveTextures(), 0);
+    BOOST_CHECK_EQUAL(textureManager.TotalBytes(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(TextureArrayTestCase, GLContextFixture)
+{
+    TextureManager textureManager(3);
+    textureManager.Init();
+
+    QImage red(32, 16, QImage::Format_RGB32);
+    red.fill(Qt::red);
+    QImage blue(64, 64, QImage::Format_RGB32);
+    blue.fill(Qt::blue);
+
+    textureManager.SetImage(0, red);
+    textureManager.SetImage(1, blue);
+    textureManager.SetImage(2, red);
+
+    // Layers follow the slots, slots of another size stay empty.
+    const auto skipped = textureManager.UpdateArray();
+    BOOST_REQUIRE_EQUAL(skipped.size(), 1);
+    BOOST_CHECK_EQUAL(skipped.at(0), 1);
+    BOOST_REQUIRE_NE(textureManager.ArrayTexture(), 0);
+
+    std::vector<uint8_t> pixels(32 * 16 * 4 * 3);
+    gl.glGetTextureImage(textureManager.ArrayTexture(), 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         static_cast<GLsizei>(pixels.size()), pixels.data());
+
+    const auto layerBytes = 32 * 16 * 4;
+    BOOST_CHECK_EQUAL(pixels.at(0), 255);
+    BOOST_CHECK_EQUAL(pixels.at(layerBytes + 2), 0);
+    BOOST_CHECK_EQUAL(pixels.at(2 * layerBytes), 255);
+
+    // Removed slots release their textures.
+    textureManager.SetSlotCount(1);
+    BOOST_CHECK_EQUAL(textureManager.SlotCount(), 1);
+    BOOST_CHECK_EQUAL(textureManager.Texture(2), textureManager.Texture(-1));
+    BOOST_CHECK_EQUAL(textureManager.LiveTextures(), 3);
+    BOOST_CHECK_EQUAL(gl.glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    textureManager.Release();
+    BOOST_CHECK_EQUAL(textureManager.LiveTextures(), 0);
+    BOOST_CHECK_EQUAL(textureManager.TotalBytes(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(TextureStreamTestCase, GLContextFixture)
+{
+    const int NUM_FRAMES = 200;
+
+    TextureManager textureManager(1);
+    textureManager.Init();
+
+    TextureStreamer textureStreamer;
+    textureStreamer.Init();
+
+    // Image sequence, the ring is reused after the GPU read each region.
+    QImage frame(256, 256, QImage::Format_RGBA8888);
+    int streamed = 0;
+
+    for (int i = 0; i < NUM_FRAMES; i++)
+    {
+        frame.fill(QColor(i % 256, 0, 255 - i % 256));
+
+        std::atomic<int> copiedRegion{ -1 };
+        const auto region = textureStreamer.Stream(frame, [&copiedRegion](int region) {
+            copiedRegion = region;
+        });
+
+        if (region == -1)
+        {
+            // Busy, the GPU did not read any region yet.
+            textureManager.SetUploadImage(0, frame);
+            gl.glFinish();
+            continue;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        while (copiedRegion == -1 && timer.elapsed() < 5000) {
+            QThread::yieldCurrentThread();
+        }
+
+        BOOST_REQUIRE_EQUAL(copiedRegion, region);
+
+        textureManager.Allocate(0, frame.size());
+        textureStreamer.Upload(region, textureManager.Texture(0), frame.size());
+        textureManager.GenerateMipmaps(0);
+        streamed++;
+
+        // Level 0 holds the last frame.
+        std::vector<uint32_t> pixels(256 * 256);
+        gl.glGetTextureImage(textureManager.Texture(0), 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                             static_cast<GLsizei>(pixels.size() * sizeof(uint32_t)), pixels.data());
+
+        BOOST_REQUIRE(pixels.at(1000) == *reinterpret_cast<const uint32_t*>(frame.constBits()));
+    }
+
+    BOOST_CHECK_GT(streamed, NUM_FRAMES / 2);
+    BOOST_CHECK_EQUAL(textureManager.Allocations(), 2);
+    BOOST_CHECK_EQUAL(gl.glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+    // Larger images are uploaded directly.
+    QImage large(8192, 4096, QImage::Format_RGBA8888);
+    BOOST_CHECK_EQUAL(textureStreamer.Stream(large, [](int) {}), -1);
+
+    textureStreamer.Release();
+    textureManager.Release();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+/**
+ * TextureSlots Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE TextureSlotsTest
+#include <boost/test/unit_test.hpp>
+#include "src/GL/TextureSlots.hpp"
+#include "src/GL/TextureBindings.hpp"
+#include "src/GL/GLDefaults.hpp"
+
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(TextureSlotsTestSuite)
+
+BOOST_AUTO_TEST_CASE(SlotNamesTestCase)
+{
+    BOOST_CHECK_EQUAL(TextureSlots::Name(0).toStdString(), "tex0");
+    BOOST_CHECK_EQUAL(TextureSlots::Name(12).toStdString(), "tex12");
+
+    BOOST_CHECK_EQUAL(TextureSlots::Index("tex0"), 0);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("tex15"), 15);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("tex16"), -1);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("tex01"), -1);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("tex"), -1);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("texArray"), -1);
+    BOOST_CHECK_EQUAL(TextureSlots::Index("mytex0"), -1);
+
+    BOOST_CHECK_EQUAL(TextureSlots::ClampCount(0), 1);
+    BOOST_CHECK_EQUAL(TextureSlots::ClampCount(7), 7);
+    BOOST_CHECK_EQUAL(TextureSlots::ClampCount(100), GLSL_TEXTURE_SLOTS_MAX);
+}
+
+BOOST_AUTO_TEST_CASE(SamplerSourceTestCase)
+{
+    SamplerBinding binding;
+
+    BOOST_CHECK(TextureBindings::SamplerSource("tex3", GL_SAMPLER_2D, binding));
+    BOOST_CHECK(binding.source == SamplerBinding::SOURCE::SLOT);
+    BOOST_CHECK_EQUAL(binding.slot, 3);
+
+    BOOST_CHECK(TextureBindings::SamplerSource("texArray", GL_SAMPLER_2D_ARRAY, binding));
+    BOOST_CHECK(binding.source == SamplerBinding::SOURCE::ARRAY);
+
+    BOOST_CHECK(TextureBindings::SamplerSource("computeOutput", GL_SAMPLER_2D, binding));
+    BOOST_CHECK(binding.source == SamplerBinding::SOURCE::COMPUTE_OUTPUT);
+
+    // Samplers of other types or names are left to the shader.
+    BOOST_CHECK(!TextureBindings::SamplerSource("tex3", GL_SAMPLER_CUBE, binding));
+    BOOST_CHECK(!TextureBindings::SamplerSource("texArray", GL_SAMPLER_2D, binding));
+    BOOST_CHECK(!TextureBindings::SamplerSource("noise", GL_SAMPLER_2D, binding));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
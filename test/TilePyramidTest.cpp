@@ -0,0 +1,129 @@
+/**
+ * TilePyramid Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE TilePyramidTest
+#include <boost/test/unit_test.hpp>
+#include <QFile>
+#include <QTemporaryDir>
+#include "src/GL/TilePyramid.hpp"
+#include "src/GL/TextureManager.hpp"
+#include "src/Core/GeneralException.hpp"
+
+using namespace ShaderIDE;
+using namespace ShaderIDE::GL;
+
+static QImage MakeTestImage()
+{
+    // Red left half, blue right half.
+    QImage image(600, 300, QImage::Format_RGBA8888);
+    image.fill(Qt::blue);
+
+    for (int y = 0; y < image.height(); y++)
+    {
+        for (int x = 0; x < image.width() / 2; x++) {
+            image.setPixelColor(x, y, Qt::red);
+        }
+    }
+
+    return image;
+}
+
+BOOST_AUTO_TEST_SUITE(TilePyramidTestSuite)
+
+BOOST_AUTO_TEST_CASE(LevelSizesTestCase)
+{
+    const auto sizes = TilePyramid::LevelSizes(QSize(600, 300));
+    BOOST_REQUIRE_EQUAL(sizes.size(), 3);
+    BOOST_CHECK(sizes.at(1) == QSize(300, 150));
+    BOOST_CHECK(sizes.at(2) == QSize(150, 75));
+
+    // The coarsest level fits into one tile.
+    const auto large = TilePyramid::LevelSizes(QSize(16384, 16384));
+    BOOST_CHECK_EQUAL(large.size(), 7);
+    BOOST_CHECK(large.last() == QSize(TilePyramid::TILE_SIZE, TilePyramid::TILE_SIZE));
+
+    BOOST_CHECK(TilePyramid::LevelSizes(QSize()).isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(BuildTestCase)
+{
+    QTemporaryDir directory;
+    BOOST_REQUIRE(directory.isValid());
+
+    const auto sourcePath = directory.filePath("source.png");
+    const auto pyramidPath = directory.filePath("pyramid");
+    BOOST_REQUIRE(MakeTestImage().save(sourcePath));
+
+    const auto pyramid = TilePyramid::Build(sourcePath, pyramidPath);
+    BOOST_REQUIRE_EQUAL(pyramid.Levels(), 3);
+    BOOST_CHECK_EQUAL(pyramid.Columns(0), 3);
+    BOOST_CHECK_EQUAL(pyramid.Rows(0), 2);
+    BOOST_CHECK(pyramid.TileRect(0, 2, 1) == QRect(512, 256, 88, 44));
+
+    // Edge tiles are cut to the image.
+    const auto tile = pyramid.ReadTile(0, 2, 1);
+    BOOST_CHECK(tile.size() == QSize(88, 44));
+    BOOST_CHECK(tile.pixelColor(0, 0) == QColor(Qt::blue));
+
+    BOOST_CHECK(pyramid.ReadLevel(0) == MakeTestImage());
+
+    const auto coarsest = pyramid.ReadLevel(2);
+    BOOST_REQUIRE(coarsest.size() == QSize(150, 75));
+    BOOST_CHECK(coarsest.pixelColor(10, 40) == QColor(Qt::red));
+    BOOST_CHECK(coarsest.pixelColor(140, 40) == QColor(Qt::blue));
+
+    // Complete pyramids are reused, not built again.
+    BOOST_REQUIRE(QFile::remove(pyramidPath + "/2/0_0.raw"));
+    const auto reused = TilePyramid::Build(sourcePath, pyramidPath);
+    BOOST_CHECK(reused.ReadTile(2, 0, 0).isNull());
+    BOOST_CHECK(reused.ReadLevel(2).isNull());
+
+    BOOST_CHECK_THROW(TilePyramid::Build(directory.filePath("missing.png"), pyramidPath), GeneralException);
+}
+
+BOOST_AUTO_TEST_CASE(LevelForExtentTestCase)
+{
+    QTemporaryDir directory;
+    BOOST_REQUIRE(directory.isValid());
+
+    const auto sourcePath = directory.filePath("source.png");
+    BOOST_REQUIRE(MakeTestImage().save(sourcePath));
+    const auto pyramid = TilePyramid::Build(sourcePath, directory.filePath("pyramid"));
+
+    BOOST_CHECK_EQUAL(pyramid.LevelForExtent(100), 2);
+    BOOST_CHECK_EQUAL(pyramid.LevelForExtent(300), 1);
+    BOOST_CHECK_EQUAL(pyramid.LevelForExtent(1000), 0);
+
+    // The memory limit wins over the extent, the coarsest level is always available.
+    const auto levelSize = pyramid.LevelSize(1);
+    const auto levelBytes = TextureManager::StorageBytes(levelSize, TextureManager::MipLevels(levelSize), 4);
+    BOOST_CHECK_EQUAL(pyramid.LevelForExtent(1000, levelBytes), 1);
+    BOOST_CHECK_EQUAL(pyramid.LevelForExtent(1000, 1), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+/**
+ * Tile Timings Test
+ *
+ * -------------------------------------------------------------------------------
+ * This file is part of "Shader IDE" -> https://github.com/thedamncoder/shaderide.
+ * -------------------------------------------------------------------------------
+ *
+ * Copyright (c) 2019 - 2021 Florian Roth (The Damn Coder)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BOOST_TEST_MODULE TileTimingsTest
+#include <boost/test/unit_test.hpp>
+#include "src/GL/TileTimings.hpp"
+
+using namespace ShaderIDE::GL;
+
+BOOST_AUTO_TEST_SUITE(TileTimingsTestSuite)
+
+BOOST_AUTO_TEST_CASE(TileTimingsTestCase)
+{
+    // 100x70 in 64 pixel tiles, the last row and column are partial.
+    TileTimings timings(QSize(100, 70), 64, TileTimings::TIMER::GPU);
+    BOOST_REQUIRE_EQUAL(timings.TileCount(), 4);
+    BOOST_CHECK_EQUAL(timings.Columns(), 2);
+    BOOST_CHECK_EQUAL(timings.Rows(), 2);
+
+    // GL coordinates, the first tile is the top left one.
+    BOOST_CHECK(timings.TileRect(0) == QRect(0, 6, 64, 64));
+    BOOST_CHECK(timings.TileRect(3) == QRect(64, 0, 36, 6));
+
+    // Median, the single stall is ignored.
+    for (const auto sample : { 1.0, 1.2, 9.0, 1.1, 0.9 }) {
+        timings.AddSample(0, sample);
+    }
+
+    timings.AddSample(1, 3.0);
+
+    BOOST_CHECK_CLOSE(timings.Median(0), 1.1, 0.001);
+    BOOST_CHECK_CLOSE(timings.MaxMedian(), 3.0, 0.001);
+    BOOST_CHECK_CLOSE(timings.TotalMedian(), 4.1, 0.001);
+    BOOST_CHECK_EQUAL(timings.Median(2), 0.0);
+
+    // CSV, image coordinates with the origin at the top left.
+    const auto lines = timings.ToCSV().split('\n', Qt::SkipEmptyParts);
+    BOOST_REQUIRE_EQUAL(lines.size(), 5);
+    BOOST_CHECK_EQUAL(lines.at(0).toStdString(), "row,column,x,y,width,height,median_ms,min_ms,max_ms,samples");
+    BOOST_CHECK_EQUAL(lines.at(1).toStdString(), "0,0,0,0,64,64,1.1000,0.9000,9.0000,5");
+    BOOST_CHECK_EQUAL(lines.at(4).toStdString(), "1,1,64,64,36,6,0.0000,0.0000,0.0000,0");
+
+    BOOST_CHECK(TileTimings().Empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()